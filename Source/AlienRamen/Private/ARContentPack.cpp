@@ -0,0 +1,509 @@
+// ARContentPack.cpp
+
+#include "ARContentPack.h"
+#include "ARLog.h"
+#include "ContentLookupSubsystem.h"
+#include "Async/MappedFileHandle.h"
+#include "Engine/DataTable.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+struct FARContentPackHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 RouteCount = 0;
+	uint32 RowCount = 0;
+	uint64 RoutesOffset = 0;
+	uint64 RowsOffset = 0;
+	uint64 StringsOffset = 0;
+	uint64 StringsSize = 0;
+	uint64 PayloadOffset = 0;
+	uint64 PayloadSize = 0;
+};
+static_assert(sizeof(FARContentPackHeader) == 64, "Content pack header layout changed; bump FARContentPack::Version.");
+
+struct FARContentPackRouteRecord
+{
+	uint32 RootTagString = 0;
+	uint32 TablePathString = 0;
+	uint32 RowStructPathString = 0;
+	uint32 FirstRow = 0;
+	uint32 RowCount = 0;
+	uint32 Reserved = 0;
+};
+static_assert(sizeof(FARContentPackRouteRecord) == 24, "Content pack route layout changed; bump FARContentPack::Version.");
+
+struct FARContentPackRowRecord
+{
+	uint64 NameHash = 0;
+	uint64 PayloadOffset = 0;
+	uint32 PayloadSize = 0;
+	uint32 RowNameString = 0;
+};
+static_assert(sizeof(FARContentPackRowRecord) == 24, "Content pack row layout changed; bump FARContentPack::Version.");
+
+namespace ARContentPackInternal
+{
+	static constexpr int64 SectionAlignment = 8;
+
+	static void SerializeRowPayload(const UScriptStruct* RowStruct, const uint8* RowData, TArray<uint8>& InOutPayload)
+	{
+		FMemoryWriter Writer(InOutPayload, /*bIsPersistent*/ true, /*bSetOffset*/ true);
+		FObjectAndNameAsStringProxyArchive Ar(Writer, /*bInLoadIfFindFails*/ false);
+		RowStruct->SerializeItem(Ar, const_cast<uint8*>(RowData), nullptr);
+	}
+
+	static void PadTo(TArray<uint8>& Bytes, const int64 Alignment)
+	{
+		Bytes.AddZeroed(static_cast<int32>(Align(static_cast<int64>(Bytes.Num()), Alignment) - Bytes.Num()));
+	}
+
+	template <typename T>
+	static void AppendRaw(TArray<uint8>& Bytes, const T* Items, const int32 Count)
+	{
+		Bytes.Append(reinterpret_cast<const uint8*>(Items), Count * static_cast<int32>(sizeof(T)));
+	}
+}
+
+FARContentPack::FARContentPack() = default;
+
+FARContentPack::~FARContentPack()
+{
+	Reset();
+}
+
+void FARContentPack::Reset()
+{
+	Header = nullptr;
+	Routes = nullptr;
+	Rows = nullptr;
+	Data = nullptr;
+	Size = 0;
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	OwnedBytes.Empty();
+}
+
+bool FARContentPack::LoadFromFile(const FString& Path, FString& OutError)
+{
+	Reset();
+	OutError.Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*Path);
+	if (MappedResult.HasValue())
+	{
+		MappedHandle = MappedResult.StealValue();
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+		if (MappedRegion)
+		{
+			return BindMemory(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize(), OutError);
+		}
+		MappedHandle.Reset();
+	}
+
+	// Mapping is unavailable for files inside pak/IoStore containers and on some platforms; read once instead.
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		OutError = FString::Printf(TEXT("Could not read content pack '%s'."), *Path);
+		return false;
+	}
+
+	return LoadFromMemory(MoveTemp(Bytes), OutError);
+}
+
+bool FARContentPack::LoadFromMemory(TArray<uint8>&& Bytes, FString& OutError)
+{
+	Reset();
+	OwnedBytes = MoveTemp(Bytes);
+	return BindMemory(OwnedBytes.GetData(), OwnedBytes.Num(), OutError);
+}
+
+bool FARContentPack::BindMemory(const uint8* InData, const int64 InSize, FString& OutError)
+{
+	auto Fail = [this, &OutError](const TCHAR* Reason)
+	{
+		OutError = Reason;
+		Reset();
+		return false;
+	};
+
+	if (!InData || InSize < static_cast<int64>(sizeof(FARContentPackHeader)))
+	{
+		return Fail(TEXT("Content pack is truncated."));
+	}
+
+	const FARContentPackHeader* InHeader = reinterpret_cast<const FARContentPackHeader*>(InData);
+	if (InHeader->Magic != Magic)
+	{
+		return Fail(TEXT("Content pack has a bad magic number."));
+	}
+	if (InHeader->Version != Version)
+	{
+		OutError = FString::Printf(TEXT("Content pack version %u does not match runtime version %u."), InHeader->Version, Version);
+		Reset();
+		return false;
+	}
+
+	const uint64 FileSize = static_cast<uint64>(InSize);
+	const bool bSectionsInBounds =
+		InHeader->RoutesOffset + static_cast<uint64>(InHeader->RouteCount) * sizeof(FARContentPackRouteRecord) <= FileSize
+		&& InHeader->RowsOffset + static_cast<uint64>(InHeader->RowCount) * sizeof(FARContentPackRowRecord) <= FileSize
+		&& InHeader->StringsOffset + InHeader->StringsSize <= FileSize
+		&& InHeader->PayloadOffset + InHeader->PayloadSize <= FileSize
+		&& InHeader->RoutesOffset % ARContentPackInternal::SectionAlignment == 0
+		&& InHeader->RowsOffset % ARContentPackInternal::SectionAlignment == 0;
+	if (!bSectionsInBounds)
+	{
+		return Fail(TEXT("Content pack section table is out of bounds."));
+	}
+	if (InHeader->StringsSize == 0 || InData[InHeader->StringsOffset + InHeader->StringsSize - 1] != 0)
+	{
+		return Fail(TEXT("Content pack string block is not terminated."));
+	}
+
+	const FARContentPackRouteRecord* InRoutes = reinterpret_cast<const FARContentPackRouteRecord*>(InData + InHeader->RoutesOffset);
+	const FARContentPackRowRecord* InRows = reinterpret_cast<const FARContentPackRowRecord*>(InData + InHeader->RowsOffset);
+	for (uint32 RouteIndex = 0; RouteIndex < InHeader->RouteCount; ++RouteIndex)
+	{
+		const FARContentPackRouteRecord& Route = InRoutes[RouteIndex];
+		if (static_cast<uint64>(Route.FirstRow) + Route.RowCount > InHeader->RowCount)
+		{
+			return Fail(TEXT("Content pack route references rows out of range."));
+		}
+	}
+	for (uint32 RowIndex = 0; RowIndex < InHeader->RowCount; ++RowIndex)
+	{
+		const FARContentPackRowRecord& Row = InRows[RowIndex];
+		if (Row.PayloadOffset + Row.PayloadSize > InHeader->PayloadSize || Row.RowNameString >= InHeader->StringsSize)
+		{
+			return Fail(TEXT("Content pack row record is out of range."));
+		}
+	}
+
+	Data = InData;
+	Size = InSize;
+	Header = InHeader;
+	Routes = InRoutes;
+	Rows = InRows;
+	return true;
+}
+
+FString FARContentPack::GetString(const uint32 Offset) const
+{
+	if (!Header || Offset >= Header->StringsSize)
+	{
+		return FString();
+	}
+
+	return FString(UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Data + Header->StringsOffset + Offset)));
+}
+
+int32 FARContentPack::GetRouteCount() const
+{
+	return Header ? static_cast<int32>(Header->RouteCount) : 0;
+}
+
+int32 FARContentPack::FindRoute(const FGameplayTag& RootTag) const
+{
+	if (!Header || !RootTag.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	const FString RootString = RootTag.ToString();
+	for (uint32 RouteIndex = 0; RouteIndex < Header->RouteCount; ++RouteIndex)
+	{
+		if (GetString(Routes[RouteIndex].RootTagString).Equals(RootString, ESearchCase::IgnoreCase))
+		{
+			return static_cast<int32>(RouteIndex);
+		}
+	}
+	return INDEX_NONE;
+}
+
+FString FARContentPack::GetRouteTablePath(const int32 RouteIndex) const
+{
+	return RouteIndex >= 0 && RouteIndex < GetRouteCount() ? GetString(Routes[RouteIndex].TablePathString) : FString();
+}
+
+FString FARContentPack::GetRouteRowStructPath(const int32 RouteIndex) const
+{
+	return RouteIndex >= 0 && RouteIndex < GetRouteCount() ? GetString(Routes[RouteIndex].RowStructPathString) : FString();
+}
+
+void FARContentPack::GetRouteRowNames(const int32 RouteIndex, TArray<FName>& OutRowNames) const
+{
+	OutRowNames.Reset();
+	if (RouteIndex < 0 || RouteIndex >= GetRouteCount())
+	{
+		return;
+	}
+
+	const FARContentPackRouteRecord& Route = Routes[RouteIndex];
+	OutRowNames.Reserve(Route.RowCount);
+	for (uint32 Offset = 0; Offset < Route.RowCount; ++Offset)
+	{
+		OutRowNames.Add(FName(*GetString(Rows[Route.FirstRow + Offset].RowNameString)));
+	}
+}
+
+uint64 FARContentPack::HashRowName(const FName RowName)
+{
+	// FName comparison is case-insensitive, so the hash is too.
+	const FString Lower = RowName.ToString().ToLower();
+	const FTCHARToUTF8 Utf8(*Lower);
+	return CityHash64(Utf8.Get(), Utf8.Length());
+}
+
+int32 FARContentPack::FindRow(const int32 RouteIndex, const FName RowName) const
+{
+	if (RouteIndex < 0 || RouteIndex >= GetRouteCount() || RowName.IsNone())
+	{
+		return INDEX_NONE;
+	}
+
+	const FARContentPackRouteRecord& Route = Routes[RouteIndex];
+	const FARContentPackRowRecord* First = Rows + Route.FirstRow;
+	const uint64 Hash = HashRowName(RowName);
+
+	int32 Low = 0;
+	int32 High = static_cast<int32>(Route.RowCount);
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+		if (First[Mid].NameHash < Hash)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	// Confirm the name on every hash match (collisions are possible, just unlikely).
+	for (int32 Index = Low; Index < static_cast<int32>(Route.RowCount) && First[Index].NameHash == Hash; ++Index)
+	{
+		if (FName(*GetString(First[Index].RowNameString)) == RowName)
+		{
+			return static_cast<int32>(Route.FirstRow) + Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+bool FARContentPack::DeserializeRow(const int32 RowIndex, const UScriptStruct* RowStruct, void* Dest) const
+{
+	if (!Header || !RowStruct || !Dest || RowIndex < 0 || RowIndex >= static_cast<int32>(Header->RowCount))
+	{
+		return false;
+	}
+
+	const FARContentPackRowRecord& Row = Rows[RowIndex];
+	const uint8* Payload = Data + Header->PayloadOffset + Row.PayloadOffset;
+	FMemoryReaderView Reader(TArrayView<const uint8>(Payload, static_cast<int32>(Row.PayloadSize)), /*bIsPersistent*/ true);
+	FObjectAndNameAsStringProxyArchive Ar(Reader, /*bInLoadIfFindFails*/ true);
+	const_cast<UScriptStruct*>(RowStruct)->SerializeItem(Ar, Dest, nullptr);
+	return !Ar.IsError() && !Reader.IsError();
+}
+
+bool FARContentPack::Build(TConstArrayView<FARContentPackSourceRoute> SourceRoutes, TArray<uint8>& OutBytes, FString& OutError)
+{
+	using namespace ARContentPackInternal;
+
+	OutBytes.Reset();
+	OutError.Reset();
+
+	TArray<FARContentPackRouteRecord> RouteRecords;
+	TArray<FARContentPackRowRecord> RowRecords;
+	TArray<uint8> Strings;
+	TArray<uint8> Payload;
+
+	auto AddString = [&Strings](const FString& Value) -> uint32
+	{
+		const uint32 Offset = static_cast<uint32>(Strings.Num());
+		const FTCHARToUTF8 Utf8(*Value);
+		Strings.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		Strings.Add(0);
+		return Offset;
+	};
+
+	for (const FARContentPackSourceRoute& Source : SourceRoutes)
+	{
+		const UScriptStruct* RowStruct = Source.Table ? Source.Table->GetRowStruct() : nullptr;
+		if (!Source.RootTag.IsValid() || !RowStruct)
+		{
+			OutError = FString::Printf(TEXT("Route '%s' has no loaded table or row struct."), *Source.RootTag.ToString());
+			return false;
+		}
+
+		FARContentPackRouteRecord& Route = RouteRecords.AddDefaulted_GetRef();
+		Route.RootTagString = AddString(Source.RootTag.ToString());
+		Route.TablePathString = AddString(Source.TablePath.ToString());
+		Route.RowStructPathString = AddString(RowStruct->GetPathName());
+		Route.FirstRow = static_cast<uint32>(RowRecords.Num());
+		Route.RowCount = static_cast<uint32>(Source.Table->GetRowMap().Num());
+
+		TArray<FARContentPackRowRecord> RouteRows;
+		RouteRows.Reserve(Route.RowCount);
+		for (const TPair<FName, uint8*>& SourceRow : Source.Table->GetRowMap())
+		{
+			FARContentPackRowRecord& Row = RouteRows.AddDefaulted_GetRef();
+			Row.NameHash = HashRowName(SourceRow.Key);
+			Row.RowNameString = AddString(SourceRow.Key.ToString());
+			Row.PayloadOffset = static_cast<uint64>(Payload.Num());
+			SerializeRowPayload(RowStruct, SourceRow.Value, Payload);
+			Row.PayloadSize = static_cast<uint32>(static_cast<uint64>(Payload.Num()) - Row.PayloadOffset);
+		}
+
+		RouteRows.StableSort([](const FARContentPackRowRecord& A, const FARContentPackRowRecord& B)
+		{
+			return A.NameHash < B.NameHash;
+		});
+		RowRecords.Append(RouteRows);
+	}
+
+	if (Strings.Num() == 0)
+	{
+		Strings.Add(0);
+	}
+
+	FARContentPackHeader PackHeader;
+	PackHeader.Magic = Magic;
+	PackHeader.Version = Version;
+	PackHeader.RouteCount = static_cast<uint32>(RouteRecords.Num());
+	PackHeader.RowCount = static_cast<uint32>(RowRecords.Num());
+
+	OutBytes.AddZeroed(sizeof(FARContentPackHeader));
+	PadTo(OutBytes, SectionAlignment);
+	PackHeader.RoutesOffset = static_cast<uint64>(OutBytes.Num());
+	AppendRaw(OutBytes, RouteRecords.GetData(), RouteRecords.Num());
+	PadTo(OutBytes, SectionAlignment);
+	PackHeader.RowsOffset = static_cast<uint64>(OutBytes.Num());
+	AppendRaw(OutBytes, RowRecords.GetData(), RowRecords.Num());
+	PadTo(OutBytes, SectionAlignment);
+	PackHeader.StringsOffset = static_cast<uint64>(OutBytes.Num());
+	PackHeader.StringsSize = static_cast<uint64>(Strings.Num());
+	OutBytes.Append(Strings);
+	PadTo(OutBytes, SectionAlignment);
+	PackHeader.PayloadOffset = static_cast<uint64>(OutBytes.Num());
+	PackHeader.PayloadSize = static_cast<uint64>(Payload.Num());
+	OutBytes.Append(Payload);
+
+	FMemory::Memcpy(OutBytes.GetData(), &PackHeader, sizeof(FARContentPackHeader));
+	return true;
+}
+
+bool FARContentPack::Verify(TConstArrayView<FARContentPackSourceRoute> SourceRoutes, TArray<FString>& OutMismatches) const
+{
+	OutMismatches.Reset();
+	if (!Header)
+	{
+		OutMismatches.Add(TEXT("Pack is not loaded."));
+		return false;
+	}
+
+	if (GetRouteCount() != SourceRoutes.Num())
+	{
+		OutMismatches.Add(FString::Printf(TEXT("Route count differs (pack=%d, source=%d)."), GetRouteCount(), SourceRoutes.Num()));
+	}
+
+	for (const FARContentPackSourceRoute& Source : SourceRoutes)
+	{
+		const FString RootString = Source.RootTag.ToString();
+		const UScriptStruct* RowStruct = Source.Table ? Source.Table->GetRowStruct() : nullptr;
+		const int32 RouteIndex = FindRoute(Source.RootTag);
+		if (RouteIndex == INDEX_NONE || !RowStruct)
+		{
+			OutMismatches.Add(FString::Printf(TEXT("Route '%s' is missing from the pack or has no source table."), *RootString));
+			continue;
+		}
+
+		if (GetRouteTablePath(RouteIndex) != Source.TablePath.ToString())
+		{
+			OutMismatches.Add(FString::Printf(TEXT("Route '%s' table path differs (pack=%s, source=%s)."),
+				*RootString, *GetRouteTablePath(RouteIndex), *Source.TablePath.ToString()));
+		}
+		if (GetRouteRowStructPath(RouteIndex) != RowStruct->GetPathName())
+		{
+			OutMismatches.Add(FString::Printf(TEXT("Route '%s' row struct differs (pack=%s, source=%s)."),
+				*RootString, *GetRouteRowStructPath(RouteIndex), *RowStruct->GetPathName()));
+			continue;
+		}
+		if (static_cast<int32>(Routes[RouteIndex].RowCount) != Source.Table->GetRowMap().Num())
+		{
+			OutMismatches.Add(FString::Printf(TEXT("Route '%s' row count differs (pack=%u, source=%d)."),
+				*RootString, Routes[RouteIndex].RowCount, Source.Table->GetRowMap().Num()));
+		}
+
+		uint8* Scratch = static_cast<uint8*>(FMemory::Malloc(RowStruct->GetStructureSize(), RowStruct->GetMinAlignment()));
+		for (const TPair<FName, uint8*>& SourceRow : Source.Table->GetRowMap())
+		{
+			const int32 RowIndex = FindRow(RouteIndex, SourceRow.Key);
+			if (RowIndex == INDEX_NONE)
+			{
+				OutMismatches.Add(FString::Printf(TEXT("Route '%s' is missing row '%s'."), *RootString, *SourceRow.Key.ToString()));
+				continue;
+			}
+
+			RowStruct->InitializeStruct(Scratch);
+			if (!DeserializeRow(RowIndex, RowStruct, Scratch))
+			{
+				OutMismatches.Add(FString::Printf(TEXT("Route '%s' row '%s' failed to deserialize."), *RootString, *SourceRow.Key.ToString()));
+			}
+			else if (!RowStruct->CompareScriptStruct(Scratch, SourceRow.Value, PPF_None))
+			{
+				OutMismatches.Add(FString::Printf(TEXT("Route '%s' row '%s' differs from the source table."), *RootString, *SourceRow.Key.ToString()));
+			}
+			RowStruct->DestroyStruct(Scratch);
+		}
+		FMemory::Free(Scratch);
+	}
+
+	return OutMismatches.Num() == 0;
+}
+
+void FARContentPack::GatherSourceRoutes(const UContentLookupRegistry* Registry, const FGameplayTagContainer& ExcludedRootTags, TArray<FARContentPackSourceRoute>& OutRoutes)
+{
+	OutRoutes.Reset();
+	if (!Registry)
+	{
+		return;
+	}
+
+	TSet<FGameplayTag> SeenRoots;
+	for (const FContentLookupRoute& Route : Registry->Routes)
+	{
+		// Same first-route-wins rule as the lookup index.
+		if (!Route.RootTag.IsValid() || Route.DataTable.IsNull() || SeenRoots.Contains(Route.RootTag))
+		{
+			continue;
+		}
+		SeenRoots.Add(Route.RootTag);
+
+		if (ExcludedRootTags.HasTagExact(Route.RootTag))
+		{
+			continue;
+		}
+
+		UDataTable* Table = Route.DataTable.LoadSynchronous();
+		if (!Table)
+		{
+			UE_LOG(ARLog, Warning, TEXT("[ContentPack] Could not load DataTable '%s' for route '%s'; route not baked."),
+				*Route.DataTable.ToSoftObjectPath().ToString(), *Route.RootTag.ToString());
+			continue;
+		}
+
+		FARContentPackSourceRoute& Source = OutRoutes.AddDefaulted_GetRef();
+		Source.RootTag = Route.RootTag;
+		Source.TablePath = Route.DataTable.ToSoftObjectPath();
+		Source.Table = Table;
+	}
+}
@@ -0,0 +1,174 @@
+#include "ARContinuousFireAbility.h"
+
+#include "ARAttributeSetCore.h"
+#include "ARPlayerCharacterInvader.h"
+#include "ARWeaponDefinition.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "TimerManager.h"
+
+UARContinuousFireAbility::UARContinuousFireAbility()
+{
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+}
+
+void UARContinuousFireAbility::ActivateAbility(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData)
+{
+	(void)TriggerEventData;
+
+	UWorld* World = GetWorld();
+	if (!World || !CommitAbility(Handle, ActorInfo, ActivationInfo))
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	Accumulator.Begin(World->GetTimeSeconds(), GetCurrentFireRate());
+
+	World->GetTimerManager().SetTimer(StepTimerHandle, this, &UARContinuousFireAbility::StepFire, StepInterval, true);
+	StepFire();
+}
+
+void UARContinuousFireAbility::EndAbility(
+	const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo,
+	bool bReplicateEndAbility,
+	bool bWasCancelled)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(StepTimerHandle);
+	}
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
+
+void UARContinuousFireAbility::StepFire()
+{
+	const UWorld* World = GetWorld();
+	if (!World || !IsActive())
+	{
+		return;
+	}
+
+	const int32 ShotCount = Accumulator.Step(World->GetTimeSeconds(), GetCurrentFireRate(), MaxShotsPerStep);
+	if (ShotCount <= 0)
+	{
+		return;
+	}
+
+	AActor* Avatar = GetAvatarActorFromActorInfo();
+	if (Avatar && Avatar->HasAuthority())
+	{
+		SpawnShotProjectiles(ShotCount);
+
+		// One batched notification per step for simulated proxies; the owning client predicts its own.
+		if (AARPlayerCharacterInvader* Ship = Cast<AARPlayerCharacterInvader>(Avatar))
+		{
+			Ship->MulticastPrimaryShotsFired(
+				static_cast<uint8>(FMath::Min(ShotCount, 255)),
+				Accumulator.GetShotTimeOffset(ShotCount - 1, ShotCount),
+				Accumulator.GetShotInterval());
+		}
+	}
+	BP_OnShotsFired(ShotCount);
+}
+
+float UARContinuousFireAbility::GetCurrentFireRate() const
+{
+	// Same floor as UMMC_FireCooldownDuration, so a zeroed FireRate slows fire instead of stopping it.
+	const UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
+	const float FireRate = ASC ? ASC->GetNumericAttribute(UARAttributeSetCore::GetFireRateAttribute()) : 0.f;
+	return FMath::Max(0.01f, FireRate);
+}
+
+void UARContinuousFireAbility::SpawnShotProjectiles_Implementation(const int32 ShotCount)
+{
+	AActor* Avatar = GetAvatarActorFromActorInfo();
+	const AARPlayerCharacterInvader* Ship = Cast<AARPlayerCharacterInvader>(Avatar);
+	const UARWeaponDefinition* WeaponDef = Ship ? Ship->GetPrimaryWeaponDefinition() : nullptr;
+	UWorld* World = Avatar ? Avatar->GetWorld() : nullptr;
+	if (!World || !WeaponDef || !WeaponDef->ProjectileClass)
+	{
+		return;
+	}
+
+	const FTransform MuzzleTransform(Avatar->GetActorRotation(), Avatar->GetActorTransform().TransformPosition(MuzzleOffset));
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Avatar;
+	SpawnParams.Instigator = Cast<APawn>(Avatar);
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 ShotIndex = 0; ShotIndex < ShotCount; ++ShotIndex)
+	{
+		AActor* Projectile = World->SpawnActor<AActor>(WeaponDef->ProjectileClass, MuzzleTransform, SpawnParams);
+		const float TimeOffset = GetShotTimeOffset(ShotIndex, ShotCount);
+		if (!Projectile || TimeOffset <= 0.f)
+		{
+			continue;
+		}
+
+		// Catch the shot up to where it would be had it spawned when due; swept so a close target still registers.
+		if (const UProjectileMovementComponent* Movement = Projectile->FindComponentByClass<UProjectileMovementComponent>())
+		{
+			Projectile->AddActorWorldOffset(Movement->Velocity * TimeOffset, true);
+		}
+	}
+}
+
+float UARContinuousFireAbility::GetShotTimeOffset(const int32 ShotIndex, const int32 ShotCount) const
+{
+	return Accumulator.GetShotTimeOffset(ShotIndex, ShotCount);
+}
+
+void FARFireAccumulator::Begin(const double Now, const float FireRate)
+{
+	// The first press fires immediately; a re-press inside the current cadence waits it out, as the cooldown did.
+	Pending = bHasFired
+		? FMath::Min(1.f, static_cast<float>(Now - LastShotTime) * FireRate)
+		: 1.f;
+	LastStepTime = Now;
+}
+
+int32 FARFireAccumulator::Step(const double Now, const float FireRate, const int32 MaxShots)
+{
+	Pending += static_cast<float>(Now - LastStepTime) * FireRate;
+	LastStepTime = Now;
+
+	const int32 ShotCount = FMath::Min(FMath::FloorToInt32(Pending), MaxShots);
+	if (ShotCount <= 0)
+	{
+		return 0;
+	}
+
+	Pending -= static_cast<float>(ShotCount);
+	if (Pending >= 1.f)
+	{
+		Pending = FMath::Frac(Pending);
+	}
+	LastShotTime = Now;
+	bHasFired = true;
+	LastRemainder = Pending;
+	LastFireRate = FireRate;
+	return ShotCount;
+}
+
+float FARFireAccumulator::GetShotTimeOffset(const int32 ShotIndex, const int32 ShotCount) const
+{
+	if (ShotIndex < 0 || ShotIndex >= ShotCount)
+	{
+		return 0.f;
+	}
+
+	// The newest shot came due LastRemainder shots ago; each older one a further 1/FireRate before it.
+	const float ShotsAgo = LastRemainder + static_cast<float>(ShotCount - 1 - ShotIndex);
+	return ShotsAgo / FMath::Max(LastFireRate, 0.01f);
+}
@@ -34,6 +34,18 @@ namespace
 		FARDialogueNodeRow ActiveRow;
 	};
 
+	// Dialogue rows grouped by NpcTag and pre-sorted by priority, rebuilt when the content lookup serial changes.
+	// The dependency maps record which NPCs have a node gated on each progression/unlock tag.
+	struct FARDialogueCandidateIndex
+	{
+		TMap<FGameplayTag, TArray<FARDialogueNodeRow>> RowsByNpc;
+		TMap<FGameplayTag, TArray<FGameplayTag>> NpcsByProgressionTag;
+		TMap<FGameplayTag, TArray<FGameplayTag>> NpcsByUnlockTag;
+		FGameplayTag RootTag;
+		uint32 ContentSerial = 0;
+		bool bBuilt = false;
+	};
+
 	static bool IsAuthorityWorld_Dialogue(const UWorld* World)
 	{
 		if (!World)
@@ -63,6 +75,7 @@ struct UARDialogueSubsystem::FARDialogueRuntimeState
 {
 	TArray<FARActiveDialogueSession> ActiveSessions;
 	TMap<EARPlayerSlot, EARPlayerSlot> ShopEavesdropTargetByViewer;
+	FARDialogueCandidateIndex CandidateIndex;
 };
 
 UARDialogueSubsystem::UARDialogueSubsystem() = default;
@@ -88,6 +101,17 @@ const UARDialogueSubsystem::FARDialogueRuntimeState& UARDialogueSubsystem::GetRu
 	return RuntimeState ? *RuntimeState : EmptyState;
 }
 
+void UARDialogueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Build the candidate index off the dialogue-start path once routed tables are resident.
+	if (UContentLookupSubsystem* Lookup = Collection.InitializeDependency<UContentLookupSubsystem>())
+	{
+		Lookup->OnWarmupCompleted.AddDynamic(this, &UARDialogueSubsystem::HandleContentWarmupCompleted);
+	}
+}
+
 void UARDialogueSubsystem::Deinitialize()
 {
 	delete RuntimeState;
@@ -152,32 +176,23 @@ static bool BuildDialogueNodeTagFromRootAndLeaf(const FGameplayTag& RootTag, FNa
 	return OutTag.IsValid();
 }
 
-static bool ResolveDialogueRow(UContentLookupSubsystem* Lookup, const FGameplayTag& NodeTag, FARDialogueNodeRow& OutRow)
+// Returns the resident dialogue row without copying it. Rows may leave NodeTag empty; callers fall back to the lookup tag.
+static const FARDialogueNodeRow* ResolveDialogueRow(UContentLookupSubsystem* Lookup, const FGameplayTag& NodeTag)
 {
 	if (!Lookup || !NodeTag.IsValid())
 	{
-		return false;
+		return nullptr;
 	}
 
-	FInstancedStruct RowData;
 	FString Error;
-	if (!Lookup->LookupWithGameplayTag(NodeTag, RowData, Error))
+	const TContentLookupRowView<FARDialogueNodeRow> Row = Lookup->FindRowViewByTag<FARDialogueNodeRow>(NodeTag, Error);
+	if (!Row)
 	{
 		UE_LOG(ARLog, Verbose, TEXT("[Dialogue] Resolve row failed for '%s': %s"), *NodeTag.ToString(), *Error);
-		return false;
-	}
-
-	if (const FARDialogueNodeRow* Typed = RowData.GetPtr<FARDialogueNodeRow>())
-	{
-		OutRow = *Typed;
-		if (!OutRow.NodeTag.IsValid())
-		{
-			OutRow.NodeTag = NodeTag;
-		}
-		return true;
+		return nullptr;
 	}
 
-	return false;
+	return Row.Get();
 }
 
 static bool GetSaveSubsystem(const UARDialogueSubsystem* Subsystem, UARSaveSubsystem*& OutSave)
@@ -244,7 +259,7 @@ static FARPlayerDialogueHistoryState* FindOrAddHistoryForIdentity(UARSaveGame* S
 		return nullptr;
 	}
 
-	for (FARPlayerDialogueHistoryState& Entry : SaveGame->PlayerDialogueHistoryStates)
+	for (FARPlayerDialogueHistoryState& Entry : SaveGame->GetMutablePlayerDialogueHistoryStates())
 	{
 		if (Entry.Identity.Matches(Identity))
 		{
@@ -252,7 +267,7 @@ static FARPlayerDialogueHistoryState* FindOrAddHistoryForIdentity(UARSaveGame* S
 		}
 	}
 
-	FARPlayerDialogueHistoryState& NewEntry = SaveGame->PlayerDialogueHistoryStates.AddDefaulted_GetRef();
+	FARPlayerDialogueHistoryState& NewEntry = SaveGame->GetMutablePlayerDialogueHistoryStates().AddDefaulted_GetRef();
 	NewEntry.Identity = Identity;
 	return &NewEntry;
 }
@@ -264,7 +279,7 @@ static FARDialogueCanonicalChoiceState* FindCanonicalChoice(UARSaveGame* SaveGam
 		return nullptr;
 	}
 
-	for (FARDialogueCanonicalChoiceState& State : SaveGame->DialogueCanonicalChoiceStates)
+	for (FARDialogueCanonicalChoiceState& State : SaveGame->GetMutableDialogueCanonicalChoiceStates())
 	{
 		if (State.NodeTag.MatchesTagExact(NodeTag))
 		{
@@ -287,7 +302,7 @@ static FARDialogueCanonicalChoiceState* FindOrAddCanonicalChoice(UARSaveGame* Sa
 		return Existing;
 	}
 
-	FARDialogueCanonicalChoiceState& Added = SaveGame->DialogueCanonicalChoiceStates.AddDefaulted_GetRef();
+	FARDialogueCanonicalChoiceState& Added = SaveGame->GetMutableDialogueCanonicalChoiceStates().AddDefaulted_GetRef();
 	Added.NodeTag = NodeTag;
 	return &Added;
 }
@@ -305,10 +320,17 @@ static bool IsNodeSeenBySpeaker(const UARDialogueSubsystem* Subsystem, const AAR
 		return false;
 	}
 
+	// A node no one has seen has no index yet, which answers most checks without touching the history rows.
+	const int32 NodeIndex = SaveGame->FindDialogueNodeIndex(NodeTag);
+	if (NodeIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
 	const FARPlayerIdentity Identity = BuildPlayerIdentityFromState(SpeakerState);
-	for (const FARPlayerDialogueHistoryState& Entry : SaveGame->PlayerDialogueHistoryStates)
+	for (const FARPlayerDialogueHistoryState& Entry : SaveGame->GetPlayerDialogueHistoryStates())
 	{
-		if (Entry.Identity.Matches(Identity) && Entry.SeenNodeTags.HasTagExact(NodeTag))
+		if (Entry.Identity.Matches(Identity) && Entry.HasSeenNodeIndex(NodeIndex))
 		{
 			return true;
 		}
@@ -342,9 +364,8 @@ static void MarkNodeSeenForSpeaker(const UARDialogueSubsystem* Subsystem, const
 		return;
 	}
 
-	if (!History->SeenNodeTags.HasTagExact(NodeTag))
+	if (History->MarkNodeIndexSeen(SaveGame->FindOrAddDialogueNodeIndex(NodeTag)))
 	{
-		History->SeenNodeTags.AddTag(NodeTag);
 		SaveSubsystem->MarkSaveDirty();
 	}
 }
@@ -408,52 +429,64 @@ static bool EvaluateRowUnlocked(const UARDialogueSubsystem* Subsystem, const FAR
 	return true;
 }
 
-static bool ResolveNpcState(const UARDialogueSubsystem* Subsystem, const FGameplayTag NpcTag, FARNpcRelationshipState& OutState)
+static const FARNpcRelationshipState* ResolveNpcState(const UARDialogueSubsystem* Subsystem, const FGameplayTag NpcTag)
 {
-	OutState = FARNpcRelationshipState();
 	if (!NpcTag.IsValid())
 	{
-		return false;
+		return nullptr;
 	}
 
 	if (UGameInstance* GI = Subsystem ? Subsystem->GetGameInstance() : nullptr)
 	{
 		if (UARNPCSubsystem* NpcSubsystem = GI->GetSubsystem<UARNPCSubsystem>())
 		{
-			return NpcSubsystem->TryGetNpcRelationshipState(NpcTag, OutState);
+			return NpcSubsystem->FindNpcRelationshipState(NpcTag);
 		}
 	}
 
-	return false;
+	return nullptr;
 }
 
-static bool BuildCandidateRowsForNpc(const UARDialogueSubsystem* Subsystem, const FGameplayTag NpcTag, TArray<FARDialogueNodeRow>& OutRows)
+static void AddDialogueTagDependencies(TMap<FGameplayTag, TArray<FGameplayTag>>& Dependencies, const FGameplayTagContainer& Tags, const FGameplayTag NpcTag)
 {
-	OutRows.Reset();
-	if (!Subsystem || !NpcTag.IsValid())
+	for (const FGameplayTag Tag : Tags)
 	{
-		return false;
+		Dependencies.FindOrAdd(Tag).AddUnique(NpcTag);
 	}
+}
 
-	UContentLookupSubsystem* Lookup = nullptr;
-	if (!GetLookupSubsystem(Subsystem, Lookup))
+// Containers match hierarchically, so a row gated on A.B depends on changes to A.B and to any tag below it.
+static void GatherDialogueTagDependents(const TMap<FGameplayTag, TArray<FGameplayTag>>& Dependencies, const FGameplayTagContainer& ChangedTags, TSet<FGameplayTag>& OutNpcTags)
+{
+	if (Dependencies.IsEmpty())
 	{
-		return false;
+		return;
 	}
 
-	const UARDialogueSettings* DialogueSettings = GetDefault<UARDialogueSettings>();
-	const FGameplayTag RootTag = DialogueSettings ? DialogueSettings->DialogueNodeRootTag : FGameplayTag();
-	if (!RootTag.IsValid())
+	for (const FGameplayTag ChangedTag : ChangedTags)
 	{
-		return false;
+		for (FGameplayTag Tag = ChangedTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+		{
+			if (const TArray<FGameplayTag>* NpcTags = Dependencies.Find(Tag))
+			{
+				OutNpcTags.Append(*NpcTags);
+			}
+		}
 	}
+}
+
+static void BuildDialogueCandidateIndex(UContentLookupSubsystem* Lookup, const FGameplayTag RootTag, FARDialogueCandidateIndex& OutIndex)
+{
+	OutIndex.RowsByNpc.Reset();
+	OutIndex.NpcsByProgressionTag.Reset();
+	OutIndex.NpcsByUnlockTag.Reset();
 
 	TArray<FName> RowNames;
 	FString Error;
 	if (!Lookup->GetAllRowNamesForRootTag(RootTag, RowNames, Error))
 	{
 		UE_LOG(ARLog, Verbose, TEXT("[Dialogue] GetAllRowNamesForRootTag failed: %s"), *Error);
-		return false;
+		return;
 	}
 
 	for (const FName RowName : RowNames)
@@ -464,20 +497,89 @@ static bool BuildCandidateRowsForNpc(const UARDialogueSubsystem* Subsystem, cons
 			continue;
 		}
 
-		FARDialogueNodeRow Row;
-		if (!ResolveDialogueRow(Lookup, CandidateTag, Row))
+		const FARDialogueNodeRow* Row = ResolveDialogueRow(Lookup, CandidateTag);
+		if (!Row || !Row->NpcTag.IsValid())
 		{
 			continue;
 		}
 
-		if (Row.NpcTag.MatchesTagExact(NpcTag))
+		FARDialogueNodeRow& Added = OutIndex.RowsByNpc.FindOrAdd(Row->NpcTag).Add_GetRef(*Row);
+		if (!Added.NodeTag.IsValid())
 		{
-			OutRows.Add(MoveTemp(Row));
+			Added.NodeTag = CandidateTag;
 		}
+
+		AddDialogueTagDependencies(OutIndex.NpcsByProgressionTag, Row->RequiredProgressionTags, Row->NpcTag);
+		AddDialogueTagDependencies(OutIndex.NpcsByProgressionTag, Row->BlockedProgressionTags, Row->NpcTag);
+		AddDialogueTagDependencies(OutIndex.NpcsByUnlockTag, Row->RequiredUnlockTags, Row->NpcTag);
+		AddDialogueTagDependencies(OutIndex.NpcsByUnlockTag, Row->BlockedUnlockTags, Row->NpcTag);
+	}
+
+	for (TPair<FGameplayTag, TArray<FARDialogueNodeRow>>& Pair : OutIndex.RowsByNpc)
+	{
+		Pair.Value.Sort(&SortRowsByPriorityThenTag);
+	}
+
+	UE_LOG(ARLog, Verbose, TEXT("[Dialogue] Candidate index built: %d rows across %d NPCs."), RowNames.Num(), OutIndex.RowsByNpc.Num());
+}
+
+bool UARDialogueSubsystem::EnsureCandidateIndex() const
+{
+	UContentLookupSubsystem* Lookup = nullptr;
+	GetLookupSubsystem(this, Lookup);
+	const UARDialogueSettings* DialogueSettings = GetDefault<UARDialogueSettings>();
+	const FGameplayTag RootTag = DialogueSettings ? DialogueSettings->DialogueNodeRootTag : FGameplayTag();
+	if (!Lookup || !RootTag.IsValid())
+	{
+		return false;
+	}
+
+	if (!RuntimeState)
+	{
+		RuntimeState = new FARDialogueRuntimeState();
 	}
 
-	OutRows.Sort(&SortRowsByPriorityThenTag);
-	return OutRows.Num() > 0;
+	FARDialogueCandidateIndex& Index = RuntimeState->CandidateIndex;
+	const uint32 ContentSerial = Lookup->GetContentSerial();
+	if (!Index.bBuilt || Index.ContentSerial != ContentSerial || Index.RootTag != RootTag)
+	{
+		BuildDialogueCandidateIndex(Lookup, RootTag, Index);
+		Index.RootTag = RootTag;
+		Index.ContentSerial = ContentSerial;
+		Index.bBuilt = true;
+	}
+	return true;
+}
+
+const TArray<FARDialogueNodeRow>* UARDialogueSubsystem::FindCandidateRowsForNpc(const FGameplayTag NpcTag) const
+{
+	if (!NpcTag.IsValid() || !EnsureCandidateIndex())
+	{
+		return nullptr;
+	}
+
+	const TArray<FARDialogueNodeRow>* Rows = RuntimeState->CandidateIndex.RowsByNpc.Find(NpcTag);
+	return Rows && Rows->Num() > 0 ? Rows : nullptr;
+}
+
+void UARDialogueSubsystem::GatherNpcsAffectedByTagChanges(
+	const FGameplayTagContainer& ChangedProgressionTags,
+	const FGameplayTagContainer& ChangedUnlockTags,
+	TSet<FGameplayTag>& OutNpcTags) const
+{
+	if (!EnsureCandidateIndex())
+	{
+		return;
+	}
+
+	const FARDialogueCandidateIndex& Index = RuntimeState->CandidateIndex;
+	GatherDialogueTagDependents(Index.NpcsByProgressionTag, ChangedProgressionTags, OutNpcTags);
+	GatherDialogueTagDependents(Index.NpcsByUnlockTag, ChangedUnlockTags, OutNpcTags);
+}
+
+void UARDialogueSubsystem::HandleContentWarmupCompleted()
+{
+	EnsureCandidateIndex();
 }
 
 static AARPlayerController* FindPlayerControllerBySlot(const UWorld* World, const EARPlayerSlot Slot)
@@ -713,27 +815,20 @@ static void EndSession(UARDialogueSubsystem* Subsystem, FARActiveDialogueSession
 	NotifyNpcSubsystemTalkableRefresh(Subsystem, Session.NpcTag);
 }
 
-static bool TrySelectBestRowForSpeaker(const UARDialogueSubsystem* Subsystem, const FGameplayTag NpcTag, const AARPlayerStateBase* SpeakerState, FARDialogueNodeRow& OutRow)
+static bool TrySelectBestRowForSpeaker(const UARDialogueSubsystem* Subsystem, const FGameplayTag NpcTag, const TArray<FARDialogueNodeRow>* Rows, const AARPlayerStateBase* SpeakerState, FARDialogueNodeRow& OutRow)
 {
 	OutRow = FARDialogueNodeRow();
-	if (!Subsystem || !SpeakerState || !NpcTag.IsValid())
+	if (!Subsystem || !SpeakerState || !NpcTag.IsValid() || !Rows)
 	{
 		return false;
 	}
 
-	TArray<FARDialogueNodeRow> Rows;
-	if (!BuildCandidateRowsForNpc(Subsystem, NpcTag, Rows))
-	{
-		return false;
-	}
-
-	FARNpcRelationshipState NpcState;
-	const bool bHasNpcState = ResolveNpcState(Subsystem, NpcTag, NpcState);
+	const FARNpcRelationshipState* NpcState = ResolveNpcState(Subsystem, NpcTag);
 
 	const UARSaveGame* SaveGame = GetMutableCurrentSave(Subsystem);
-	for (const FARDialogueNodeRow& Row : Rows)
+	for (const FARDialogueNodeRow& Row : *Rows)
 	{
-		if (!EvaluateRowUnlocked(Subsystem, Row, SpeakerState, bHasNpcState ? &NpcState : nullptr))
+		if (!EvaluateRowUnlocked(Subsystem, Row, SpeakerState, NpcState))
 		{
 			continue;
 		}
@@ -741,7 +836,7 @@ static bool TrySelectBestRowForSpeaker(const UARDialogueSubsystem* Subsystem, co
 		// If a canonical choice exists, this row remains valid and will follow the stored branch on advance.
 		if (SaveGame && Row.Choices.Num() > 0)
 		{
-			for (const FARDialogueCanonicalChoiceState& Canonical : SaveGame->DialogueCanonicalChoiceStates)
+			for (const FARDialogueCanonicalChoiceState& Canonical : SaveGame->GetDialogueCanonicalChoiceStates())
 			{
 				if (Canonical.NodeTag.MatchesTagExact(Row.NodeTag))
 				{
@@ -802,7 +897,7 @@ bool UARDialogueSubsystem::TryStartDialogueWithNpc(AARPlayerController* Requesti
 	}
 
 	FARDialogueNodeRow SelectedRow;
-	if (!TrySelectBestRowForSpeaker(this, NpcTag, RequesterPS, SelectedRow))
+	if (!TrySelectBestRowForSpeaker(this, NpcTag, FindCandidateRowsForNpc(NpcTag), RequesterPS, SelectedRow))
 	{
 		return false;
 	}
@@ -941,14 +1036,20 @@ bool UARDialogueSubsystem::AdvanceDialogue(AARPlayerController* RequestingContro
 		return false;
 	}
 
-	FARDialogueNodeRow NextRow;
-	if (!ResolveDialogueRow(Lookup, NextNode, NextRow))
+	const FARDialogueNodeRow* NextRowView = ResolveDialogueRow(Lookup, NextNode);
+	if (!NextRowView)
 	{
 		return false;
 	}
 
+	// The session keeps its own copy of the active row; everything below reads from that copy.
+	Session->ActiveRow = *NextRowView;
+	if (!Session->ActiveRow.NodeTag.IsValid())
+	{
+		Session->ActiveRow.NodeTag = NextNode;
+	}
+	const FARDialogueNodeRow& NextRow = Session->ActiveRow;
 	Session->CurrentNodeTag = NextRow.NodeTag;
-	Session->ActiveRow = NextRow;
 	Session->ChoiceParticipation = NextRow.ChoiceParticipation;
 	Session->bForceEavesdropForImportantDecision = NextRow.bForceEavesdropForImportantDecision;
 	Session->CurrentChoices = NextRow.Choices;
@@ -1158,7 +1259,7 @@ bool UARDialogueSubsystem::HasUnlockedDialogueForNpcForSlot(FGameplayTag NpcTag,
 	}
 
 	FARDialogueNodeRow Row;
-	return TrySelectBestRowForSpeaker(this, NpcTag, PS, Row);
+	return TrySelectBestRowForSpeaker(this, NpcTag, FindCandidateRowsForNpc(NpcTag), PS, Row);
 }
 
 bool UARDialogueSubsystem::HasUnlockedDialogueForNpcForAnyPlayer(FGameplayTag NpcTag) const
@@ -1170,7 +1271,8 @@ bool UARDialogueSubsystem::HasUnlockedDialogueForNpcForAnyPlayer(FGameplayTag Np
 
 	const UWorld* World = GetWorld();
 	const AARGameStateBase* GS = World ? World->GetGameState<AARGameStateBase>() : nullptr;
-	if (!GS)
+	const TArray<FARDialogueNodeRow>* Rows = FindCandidateRowsForNpc(NpcTag);
+	if (!GS || !Rows)
 	{
 		return false;
 	}
@@ -1184,7 +1286,7 @@ bool UARDialogueSubsystem::HasUnlockedDialogueForNpcForAnyPlayer(FGameplayTag Np
 		}
 
 		FARDialogueNodeRow Row;
-		if (TrySelectBestRowForSpeaker(this, NpcTag, ARPS, Row))
+		if (TrySelectBestRowForSpeaker(this, NpcTag, Rows, ARPS, Row))
 		{
 			return true;
 		}
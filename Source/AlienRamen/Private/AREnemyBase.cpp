@@ -4,6 +4,8 @@
 #include "AREnemyBase.h"
 #include "AREnemyAIController.h"
 #include "AREnemyAttributeSet.h"
+#include "AREnemyStateTreeExecutorSubsystem.h"
+#include "ARFormationMovementComponent.h"
 #include "AREnemyIncomingDamageEffect.h"
 #include "ARInvaderAIController.h"
 #include "ARInvaderCollisionChannels.h"
@@ -15,7 +17,9 @@
 #include "ARAbilitySet.h"
 #include "ARAttributeSetCore.h"
 #include "ARInvaderDirectorSettings.h"
+#include "ARInvaderDirectorSubsystem.h"
 #include "ContentLookupSubsystem.h"
+#include "GameplayTagUtilities.h"
 #include "AIController.h"
 #include "BrainComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -29,7 +33,6 @@
 
 namespace
 {
-	const FName DataDamageName(TEXT("Data.Damage"));
 	constexpr float KillCreditInstigatorFallbackWindowSeconds = 3.0f;
 
 	static bool ApplyDamageToActorViaGAS(AActor* Target, float Damage, AActor* Offender)
@@ -91,7 +94,24 @@ namespace AREnemyBaseInternal
 			return EffectClass == Other.EffectClass && FMath::IsNearlyEqual(Level, Other.Level);
 		}
 	};
+}
+
+/**
+ * Common + archetype startup sets merged and de-duplicated once per archetype tag, cached on the director subsystem.
+ * Effects keep their classes; the definition is resolved per apply so a recompiled Blueprint is never read stale.
+ * Specs are still built per enemy: their context and captured source data belong to that enemy's ASC.
+ */
+struct FAREnemyCompiledStartupSet
+{
+	TWeakObjectPtr<const UARAbilitySet> CommonSet;
+	TWeakObjectPtr<const UARAbilitySet> ArchetypeSet;
+	TArray<FARAbilitySet_AbilityEntry> Abilities;
+	TSet<AREnemyBaseInternal::FAbilityEntryKey> AbilityKeys;
+	TArray<TPair<TSubclassOf<UGameplayEffect>, float>> Effects;
+};
 
+namespace AREnemyBaseInternal
+{
 	static void AppendUniqueAbilityEntries(
 		const TArray<FARAbilitySet_AbilityEntry>& SourceEntries,
 		TArray<FARAbilitySet_AbilityEntry>& OutEntries,
@@ -167,9 +187,7 @@ namespace AREnemyBaseInternal
 				continue;
 			}
 
-			TArray<FString> TagSegments;
-			Entry.EnemyArchetypeTag.ToString().ParseIntoArray(TagSegments, TEXT("."), true);
-			const int32 Depth = TagSegments.Num();
+			const int32 Depth = UGameplayTagUtilities::GetTagDepth(Entry.EnemyArchetypeTag);
 			if (!Best || Depth > BestDepth)
 			{
 				Best = &Entry;
@@ -180,14 +198,97 @@ namespace AREnemyBaseInternal
 		return Best;
 	}
 
+	static const UARAbilitySet* ResolveStartupSet(const TSoftObjectPtr<UARAbilitySet>& SetRef, const bool bAllowSyncLoad, bool& bOutPending)
+	{
+		if (SetRef.IsNull())
+		{
+			return nullptr;
+		}
+
+		if (const UARAbilitySet* Loaded = SetRef.Get())
+		{
+			return Loaded;
+		}
+
+		if (!bAllowSyncLoad)
+		{
+			bOutPending = true;
+			return nullptr;
+		}
+
+		UE_LOG(ARLog, Warning, TEXT("[EnemyBase] Startup ability set '%s' was not preloaded; loading synchronously."), *SetRef.ToString());
+		return SetRef.LoadSynchronous();
+	}
+
+	// Returns Director's cached entry, compiling it when missing or when its sets changed. Without a director the
+	// result is compiled uncached. Callers hold the shared pointer, so a cache reset mid-grant cannot free it.
+	static TSharedPtr<const FAREnemyCompiledStartupSet> FindOrCompileStartupSet(
+		UARInvaderDirectorSubsystem* Director,
+		const FGameplayTag& ArchetypeTag,
+		const bool bAllowSyncLoad)
+	{
+		const UARInvaderDirectorSettings* DirectorSettings = GetDefault<UARInvaderDirectorSettings>();
+		if (!DirectorSettings)
+		{
+			return nullptr;
+		}
+
+		bool bPending = false;
+		const UARAbilitySet* CommonSet = ResolveStartupSet(DirectorSettings->EnemyCommonAbilitySet, bAllowSyncLoad, bPending);
+		const FAREnemyArchetypeAbilitySetEntry* ArchetypeEntry = ResolveBestArchetypeEntry(DirectorSettings->EnemyArchetypeAbilitySets, ArchetypeTag);
+		const UARAbilitySet* ArchetypeSet = ArchetypeEntry ? ResolveStartupSet(ArchetypeEntry->AbilitySet, bAllowSyncLoad, bPending) : nullptr;
+		if (bPending)
+		{
+			return nullptr;
+		}
+
+		if (Director)
+		{
+			if (const TSharedPtr<FAREnemyCompiledStartupSet>* Cached = Director->GetCompiledStartupSets().Find(ArchetypeTag))
+			{
+				if ((*Cached)->CommonSet.Get() == CommonSet && (*Cached)->ArchetypeSet.Get() == ArchetypeSet)
+				{
+					return *Cached;
+				}
+			}
+		}
+
+		const TSharedRef<FAREnemyCompiledStartupSet> CompiledRef = MakeShared<FAREnemyCompiledStartupSet>();
+		FAREnemyCompiledStartupSet& Compiled = CompiledRef.Get();
+		Compiled.CommonSet = CommonSet;
+		Compiled.ArchetypeSet = ArchetypeSet;
+
+		TSet<FEffectEntryKey> SeenEffectEntries;
+		TArray<FARAbilitySet_EffectEntry> EffectEntries;
+		for (const UARAbilitySet* Set : { CommonSet, ArchetypeSet })
+		{
+			if (Set)
+			{
+				AppendUniqueAbilityEntries(Set->Abilities, Compiled.Abilities, Compiled.AbilityKeys);
+				AppendUniqueEffectEntries(Set->StartupEffects, EffectEntries, SeenEffectEntries);
+			}
+		}
+
+		for (const FARAbilitySet_EffectEntry& Entry : EffectEntries)
+		{
+			Compiled.Effects.Emplace(Entry.Effect, Entry.Level);
+		}
+
+		if (Director)
+		{
+			Director->GetCompiledStartupSets().Add(ArchetypeTag, CompiledRef);
+		}
+
+		UE_LOG(ARLog, Verbose, TEXT("[EnemyBase] Compiled startup ability set for archetype '%s' (Abilities=%d Effects=%d)."),
+			*ArchetypeTag.ToString(), Compiled.Abilities.Num(), Compiled.Effects.Num());
+		return CompiledRef;
+	}
+
 	static void GrantAbilityEntries(
 		UAbilitySystemComponent* ASC,
 		const TArray<FARAbilitySet_AbilityEntry>& Entries,
-		TArray<FGameplayAbilitySpecHandle>& OutGranted,
-		TArray<FActiveGameplayEffectHandle>& OutApplied
-	)
+		TArray<FGameplayAbilitySpecHandle>& OutGranted)
 	{
-		(void)OutApplied;
 		if (!ASC)
 		{
 			return;
@@ -210,29 +311,27 @@ namespace AREnemyBaseInternal
 		}
 	}
 
-	static void ApplyEffectEntries(
+	static void ApplyCompiledEffects(
 		UAbilitySystemComponent* ASC,
-		const TArray<FARAbilitySet_EffectEntry>& Entries,
+		const TArray<TPair<TSubclassOf<UGameplayEffect>, float>>& Effects,
 		TArray<FActiveGameplayEffectHandle>& OutApplied)
 	{
-		if (!ASC)
+		if (!ASC || Effects.IsEmpty())
 		{
 			return;
 		}
 
-		for (const FARAbilitySet_EffectEntry& Entry : Entries)
+		const FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
+		for (const TPair<TSubclassOf<UGameplayEffect>, float>& Effect : Effects)
 		{
-			if (!Entry.Effect)
+			const UGameplayEffect* Definition = Effect.Key ? Effect.Key->GetDefaultObject<UGameplayEffect>() : nullptr;
+			if (!Definition)
 			{
 				continue;
 			}
 
-			const FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
-			const FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(Entry.Effect, Entry.Level, Ctx);
-			if (Spec.IsValid())
-			{
-				OutApplied.Add(ASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get()));
-			}
+			const FGameplayEffectSpec Spec(Definition, Ctx, Effect.Value);
+			OutApplied.Add(ASC->ApplyGameplayEffectSpecToSelf(Spec));
 		}
 	}
 }
@@ -264,6 +363,8 @@ AAREnemyBase::AAREnemyBase()
 
 	AttributeSetCore = CreateDefaultSubobject<UARAttributeSetCore>(TEXT("AttributeSetCore"));
 	EnemyAttributeSet = CreateDefaultSubobject<UAREnemyAttributeSet>(TEXT("EnemyAttributeSet"));
+
+	FormationMovement = CreateDefaultSubobject<UARFormationMovementComponent>(TEXT("FormationMovement"));
 }
 
 UAbilitySystemComponent* AAREnemyBase::GetAbilitySystemComponent() const
@@ -282,6 +383,12 @@ void AAREnemyBase::BeginPlay()
 
 void AAREnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		Executor->UnregisterEnemy(*this, TEXT("EndPlay"));
+	}
+	bUsesSharedStateTreeExecutor = false;
+
 	UnbindHealthChangeDelegate();
 	UnbindMoveSpeedChangeDelegate();
 	UnbindEnemyColorTagDelegates();
@@ -296,6 +403,43 @@ void AAREnemyBase::Tick(float DeltaTime)
 void AAREnemyBase::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
+	InitializeEnemyRuntime();
+	UE_LOG(ARLog, Log, TEXT("[EnemyBase] Possessed '%s' by '%s'."),
+		*GetNameSafe(this), *GetNameSafe(NewController));
+}
+
+void AAREnemyBase::SpawnDefaultController()
+{
+	const UARInvaderDirectorSettings* Settings = GetDefault<UARInvaderDirectorSettings>();
+	if (!HasAuthority() || Controller || !Settings || !Settings->bUseSharedEnemyStateTreeExecutor || !SharedExecutorStateTree)
+	{
+		Super::SpawnDefaultController();
+		return;
+	}
+
+	UAREnemyStateTreeExecutorSubsystem* Executor = GetWorld() ? GetWorld()->GetSubsystem<UAREnemyStateTreeExecutorSubsystem>() : nullptr;
+	if (!Executor || !Executor->RegisterEnemy(*this, *SharedExecutorStateTree))
+	{
+		UE_LOG(ARLog, Warning, TEXT("[EnemyBase] '%s' could not join the shared StateTree executor; spawning AI controller instead."),
+			*GetNameSafe(this));
+		Super::SpawnDefaultController();
+		return;
+	}
+
+	// No controller will possess this pawn, so run the possession-time setup here. Character movement skips
+	// controller-less pawns by default; let it step so AddMovementInput and falling still work.
+	bUsesSharedStateTreeExecutor = true;
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->bRunPhysicsWithNoController = true;
+	}
+	InitializeEnemyRuntime();
+	UE_LOG(ARLog, Log, TEXT("[EnemyBase] '%s' initialized without controller (shared StateTree executor, StateTree='%s')."),
+		*GetNameSafe(this), *GetNameSafe(SharedExecutorStateTree));
+}
+
+void AAREnemyBase::InitializeEnemyRuntime()
+{
 	InitAbilityActorInfo();
 
 	if (HasAuthority())
@@ -308,8 +452,6 @@ void AAREnemyBase::PossessedBy(AController* NewController)
 	TryDispatchEnteredScreenEvent();
 	TryDispatchInFormationEvent();
 	BP_OnEnemyInitialized();
-	UE_LOG(ARLog, Log, TEXT("[EnemyBase] Possessed '%s' by '%s'."),
-		*GetNameSafe(this), *GetNameSafe(NewController));
 }
 
 void AAREnemyBase::OnRep_Controller()
@@ -359,47 +501,62 @@ void AAREnemyBase::ApplyStartupAbilitySet()
 		return;
 	}
 
-	TArray<FARAbilitySet_AbilityEntry> AggregatedAbilities;
-	TArray<FARAbilitySet_EffectEntry> AggregatedEffects;
-	TSet<AREnemyBaseInternal::FAbilityEntryKey> SeenAbilityEntries;
-	TSet<AREnemyBaseInternal::FEffectEntryKey> SeenEffectEntries;
-
-	auto AppendAbilitySetData = [&AggregatedAbilities, &AggregatedEffects, &SeenAbilityEntries, &SeenEffectEntries](const UARAbilitySet* Set)
+	// Sets are normally streamed in ahead of the wave by the director; a miss falls back to a synchronous load.
+	UARInvaderDirectorSubsystem* Director = GetWorld() ? GetWorld()->GetSubsystem<UARInvaderDirectorSubsystem>() : nullptr;
+	const TSharedPtr<const FAREnemyCompiledStartupSet> Compiled =
+		AREnemyBaseInternal::FindOrCompileStartupSet(Director, EnemyArchetypeTag, /*bAllowSyncLoad*/ true);
+	const bool bHasCompiledData = Compiled.IsValid() && (!Compiled->Abilities.IsEmpty() || !Compiled->Effects.IsEmpty());
+	if (!bHasCompiledData && RuntimeSpecificAbilities.IsEmpty())
 	{
-		if (!Set)
-		{
-			return;
-		}
+		return;
+	}
 
-		AREnemyBaseInternal::AppendUniqueAbilityEntries(Set->Abilities, AggregatedAbilities, SeenAbilityEntries);
-		AREnemyBaseInternal::AppendUniqueEffectEntries(Set->StartupEffects, AggregatedEffects, SeenEffectEntries);
-	};
+	if (Compiled)
+	{
+		AREnemyBaseInternal::GrantAbilityEntries(AbilitySystemComponent, Compiled->Abilities, StartupGrantedAbilityHandles);
+	}
 
-	const UARInvaderDirectorSettings* DirectorSettings = GetDefault<UARInvaderDirectorSettings>();
-	if (DirectorSettings)
+	if (!RuntimeSpecificAbilities.IsEmpty())
 	{
-		AppendAbilitySetData(DirectorSettings->EnemyCommonAbilitySet.LoadSynchronous());
+		TSet<AREnemyBaseInternal::FAbilityEntryKey> SeenAbilityEntries = Compiled ? Compiled->AbilityKeys : TSet<AREnemyBaseInternal::FAbilityEntryKey>();
+		TArray<FARAbilitySet_AbilityEntry> SpecificAbilities;
+		AREnemyBaseInternal::AppendUniqueAbilityEntries(RuntimeSpecificAbilities, SpecificAbilities, SeenAbilityEntries);
+		AREnemyBaseInternal::GrantAbilityEntries(AbilitySystemComponent, SpecificAbilities, StartupGrantedAbilityHandles);
+	}
 
-		if (const FAREnemyArchetypeAbilitySetEntry* ArchetypeEntry =
-			AREnemyBaseInternal::ResolveBestArchetypeEntry(DirectorSettings->EnemyArchetypeAbilitySets, EnemyArchetypeTag))
-		{
-			AppendAbilitySetData(ArchetypeEntry->AbilitySet.LoadSynchronous());
-		}
+	if (Compiled)
+	{
+		AREnemyBaseInternal::ApplyCompiledEffects(AbilitySystemComponent, Compiled->Effects, StartupAppliedEffectHandles);
 	}
+	bStartupSetApplied = true;
 
-	AREnemyBaseInternal::AppendUniqueAbilityEntries(RuntimeSpecificAbilities, AggregatedAbilities, SeenAbilityEntries);
+	UE_LOG(ARLog, Log, TEXT("[EnemyBase] Applied startup enemy abilities to '%s' (Abilities=%d Effects=%d)."),
+		*GetNameSafe(this), StartupGrantedAbilityHandles.Num(), StartupAppliedEffectHandles.Num());
+}
 
-	if (AggregatedAbilities.IsEmpty() && AggregatedEffects.IsEmpty())
+void AAREnemyBase::GetStartupAbilitySetPaths(const FGameplayTag& ArchetypeTag, TArray<FSoftObjectPath>& OutPaths)
+{
+	const UARInvaderDirectorSettings* DirectorSettings = GetDefault<UARInvaderDirectorSettings>();
+	if (!DirectorSettings)
 	{
 		return;
 	}
 
-	AREnemyBaseInternal::GrantAbilityEntries(AbilitySystemComponent, AggregatedAbilities, StartupGrantedAbilityHandles, StartupAppliedEffectHandles);
-	AREnemyBaseInternal::ApplyEffectEntries(AbilitySystemComponent, AggregatedEffects, StartupAppliedEffectHandles);
-	bStartupSetApplied = true;
+	if (!DirectorSettings->EnemyCommonAbilitySet.IsNull())
+	{
+		OutPaths.AddUnique(DirectorSettings->EnemyCommonAbilitySet.ToSoftObjectPath());
+	}
 
-	UE_LOG(ARLog, Log, TEXT("[EnemyBase] Applied startup enemy abilities to '%s' (Abilities=%d Effects=%d)."),
-		*GetNameSafe(this), StartupGrantedAbilityHandles.Num(), StartupAppliedEffectHandles.Num());
+	if (const FAREnemyArchetypeAbilitySetEntry* ArchetypeEntry =
+		AREnemyBaseInternal::ResolveBestArchetypeEntry(DirectorSettings->EnemyArchetypeAbilitySets, ArchetypeTag))
+	{
+		OutPaths.AddUnique(ArchetypeEntry->AbilitySet.ToSoftObjectPath());
+	}
+}
+
+void AAREnemyBase::PrewarmStartupAbilitySet(UARInvaderDirectorSubsystem& Director, const FGameplayTag& ArchetypeTag)
+{
+	AREnemyBaseInternal::FindOrCompileStartupSet(&Director, ArchetypeTag, /*bAllowSyncLoad*/ false);
 }
 
 void AAREnemyBase::ApplyRuntimeEnemyEffects(const TArray<TSubclassOf<UGameplayEffect>>& Effects)
@@ -497,23 +654,16 @@ bool AAREnemyBase::ResolveEnemyDefinition(FARInvaderEnemyDefRow& OutRow, FString
 		return false;
 	}
 
-	FInstancedStruct ResolvedRow;
-	if (!Lookup->LookupWithGameplayTag(EnemyIdentifierTag, ResolvedRow, OutError))
-	{
-		return false;
-	}
-
-	if (!ResolvedRow.IsValid())
-	{
-		OutError = TEXT("Resolved row struct is invalid.");
-		return false;
-	}
-
-	const UScriptStruct* RowType = ResolvedRow.GetScriptStruct();
-	const void* RowData = ResolvedRow.GetMemory();
+	// Read the resident row in place; only the fields we keep are copied.
+	const UScriptStruct* RowType = nullptr;
+	const UObject* RowOwner = nullptr;
+	const uint8* RowData = Lookup->FindRowDataByTag(EnemyIdentifierTag, RowType, RowOwner, OutError);
 	if (!RowType || !RowData)
 	{
-		OutError = TEXT("Resolved row has no struct data.");
+		if (OutError.IsEmpty())
+		{
+			OutError = TEXT("Resolved row has no struct data.");
+		}
 		return false;
 	}
 
@@ -625,6 +775,11 @@ void AAREnemyBase::ApplyInvaderCollisionResponses(const FARInvaderEnemyRuntimeIn
 	Capsule->SetCollisionResponseToChannel(
 		ARInvaderCollisionChannels::Drop,
 		RuntimeInit.bCollideWithDrops ? ECR_Block : ECR_Ignore);
+
+	if (FormationMovement)
+	{
+		FormationMovement->RefreshSweepRequirement();
+	}
 }
 
 bool AAREnemyBase::InitializeFromEnemyDefinitionTag()
@@ -999,6 +1154,11 @@ void AAREnemyBase::HandleDeath_Implementation(AActor* InstigatorActor)
 	bIsDead = true;
 	ForceNetUpdate();
 
+	if (FormationMovement)
+	{
+		FormationMovement->StopFormationMovement();
+	}
+
 	if (AbilitySystemComponent)
 	{
 		AbilitySystemComponent->CancelAllAbilities();
@@ -1015,6 +1175,10 @@ void AAREnemyBase::HandleDeath_Implementation(AActor* InstigatorActor)
 			}
 		}
 	}
+	else if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		Executor->UnregisterEnemy(*this, TEXT("Enemy died"));
+	}
 
 	if (InstigatorActor)
 	{
@@ -1116,20 +1280,13 @@ bool AAREnemyBase::ApplyDamageViaGAS(float Damage, AActor* Offender, float& OutC
 
 	RememberDamageInstigatorForKillCredit(Offender);
 
-	FGameplayEffectContextHandle Context = AbilitySystemComponent->MakeEffectContext();
-	if (Offender)
-	{
-		Context.AddInstigator(Offender, Offender);
-	}
-
-	const FGameplayEffectSpecHandle Spec = AbilitySystemComponent->MakeOutgoingSpec(UAREnemyIncomingDamageEffect::StaticClass(), 1.f, Context);
-	if (!Spec.IsValid())
+	const FGameplayEffectSpec* Spec = IncomingDamageSpecs.Prepare(*AbilitySystemComponent, Offender, Damage);
+	if (!Spec)
 	{
 		return false;
 	}
 
-	Spec.Data->SetSetByCallerMagnitude(DataDamageName, Damage);
-	AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+	AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*Spec);
 
 	OutCurrentHealth = AbilitySystemComponent->GetNumericAttribute(UARAttributeSetCore::GetHealthAttribute());
 	if (!bIsDead && OutCurrentHealth <= 0.f)
@@ -1310,6 +1467,10 @@ void AAREnemyBase::SetWaveRuntimeContext(
 	{
 		EnemyAI->TryStartStateTreeForCurrentPawn(TEXT("WaveRuntimeContextAssigned"));
 	}
+	else if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		Executor->RequestStart(*this);
+	}
 	else
 	{
 		UE_LOG(ARLog, Warning, TEXT("[EnemyBase|WaveCtx] Enemy='%s' has no AAREnemyAIController at context assignment; StateTree start deferred."),
@@ -1414,6 +1575,16 @@ UARStateTreeAIComponent* AAREnemyBase::GetEnemyStateTreeComponent() const
 	return nullptr;
 }
 
+UAREnemyStateTreeExecutorSubsystem* AAREnemyBase::GetSharedStateTreeExecutor() const
+{
+	if (!bUsesSharedStateTreeExecutor)
+	{
+		return nullptr;
+	}
+
+	return GetWorld() ? GetWorld()->GetSubsystem<UAREnemyStateTreeExecutorSubsystem>() : nullptr;
+}
+
 bool AAREnemyBase::SendEnemyStateTreeEvent(const FStateTreeEvent& Event)
 {
 	if (!HasAuthority())
@@ -1428,6 +1599,11 @@ bool AAREnemyBase::SendEnemyStateTreeEvent(const FStateTreeEvent& Event)
 		return EnemyAI->SendStateTreeEvent(Event);
 	}
 
+	if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		return Executor->SendStateTreeEvent(*this, Event);
+	}
+
 	UE_LOG(ARLog, Warning, TEXT("[EnemyBase] SendEnemyStateTreeEvent failed for '%s': no enemy AI controller (Event=%s)."),
 		*GetNameSafe(this), *Event.Tag.ToString());
 	return false;
@@ -1447,6 +1623,14 @@ bool AAREnemyBase::SendEnemyStateTreeEventByTag(FGameplayTag EventTag, FName Ori
 		return EnemyAI->SendStateTreeEventByTag(EventTag, Origin);
 	}
 
+	if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		FStateTreeEvent Event;
+		Event.Tag = EventTag;
+		Event.Origin = Origin;
+		return Executor->SendStateTreeEvent(*this, Event);
+	}
+
 	UE_LOG(ARLog, Warning, TEXT("[EnemyBase] SendEnemyStateTreeEventByTag failed for '%s': no enemy AI controller (Event=%s)."),
 		*GetNameSafe(this), *EventTag.ToString());
 	return false;
@@ -1483,6 +1667,20 @@ bool AAREnemyBase::SendEnemySignalToController(
 			bForwardToStateTree);
 	}
 
+	// No controller to route the signal; the executor-run tree receives it as a plain event.
+	if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		if (!bForwardToStateTree)
+		{
+			return true;
+		}
+
+		FStateTreeEvent Event;
+		Event.Tag = SignalTag;
+		Event.Origin = RelatedActor ? FName(*GetNameSafe(RelatedActor)) : NAME_None;
+		return Executor->SendStateTreeEvent(*this, Event);
+	}
+
 	UE_LOG(ARLog, Warning, TEXT("[EnemyBase] SendEnemySignalToController failed for '%s': no enemy AI controller (Signal=%s)."),
 		*GetNameSafe(this), *SignalTag.ToString());
 	return false;
@@ -1507,6 +1705,10 @@ void AAREnemyBase::TryDispatchWavePhaseEvent()
 	{
 		EnemyAI->NotifyWavePhaseChanged(WaveInstanceId, WavePhase);
 	}
+	else if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		Executor->NotifyWavePhaseChanged(*this, WaveInstanceId, WavePhase);
+	}
 }
 
 void AAREnemyBase::TryDispatchEnteredScreenEvent()
@@ -1526,6 +1728,10 @@ void AAREnemyBase::TryDispatchEnteredScreenEvent()
 	{
 		EnemyAI->NotifyEnemyEnteredScreen(WaveInstanceId);
 	}
+	else if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		Executor->NotifyEnemyEnteredScreen(*this, WaveInstanceId);
+	}
 }
 
 void AAREnemyBase::TryDispatchInFormationEvent()
@@ -1546,6 +1752,10 @@ void AAREnemyBase::TryDispatchInFormationEvent()
 	{
 		EnemyAI->NotifyEnemyInFormation(WaveInstanceId);
 	}
+	else if (UAREnemyStateTreeExecutorSubsystem* Executor = GetSharedStateTreeExecutor())
+	{
+		Executor->NotifyEnemyInFormation(*this, WaveInstanceId);
+	}
 }
 
 bool AAREnemyBase::CanFireByWaveRules() const
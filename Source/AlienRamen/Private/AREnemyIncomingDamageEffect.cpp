@@ -1,6 +1,7 @@
 #include "AREnemyIncomingDamageEffect.h"
 
 #include "ARAttributeSetCore.h"
+#include "AbilitySystemComponent.h"
 #include "GameplayTagsManager.h"
 
 UAREnemyIncomingDamageEffect::UAREnemyIncomingDamageEffect()
@@ -12,6 +13,64 @@ UAREnemyIncomingDamageEffect::UAREnemyIncomingDamageEffect()
 	DamageMod.ModifierOp = EGameplayModOp::Additive;
 
 	FSetByCallerFloat SetByCaller;
-	SetByCaller.DataName = FName(TEXT("Data.Damage"));
+	SetByCaller.DataName = GetDamageDataName();
 	DamageMod.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
 }
+
+FName UAREnemyIncomingDamageEffect::GetDamageDataName()
+{
+	static const FName DamageDataName(TEXT("Data.Damage"));
+	return DamageDataName;
+}
+
+const FGameplayEffectSpec* FARIncomingDamageSpecCache::Prepare(UAbilitySystemComponent& ASC, AActor* Offender, const float Damage)
+{
+	if (OwnerASC.Get() != &ASC)
+	{
+		Reset();
+		OwnerASC = &ASC;
+	}
+
+	const TObjectKey<AActor> SourceKey(Offender);
+	FGameplayEffectSpecHandle* Cached = SpecsBySource.Find(SourceKey);
+	if (!Cached)
+	{
+		// Offenders come and go (enemies die, BP damage causers); drop dead sources before growing.
+		if (SpecsBySource.Num() >= MaxCachedSources)
+		{
+			for (auto It = SpecsBySource.CreateIterator(); It; ++It)
+			{
+				if (!It.Key().ResolveObjectPtr())
+				{
+					It.RemoveCurrent();
+				}
+			}
+			if (SpecsBySource.Num() >= MaxCachedSources)
+			{
+				SpecsBySource.Reset();
+			}
+		}
+
+		FGameplayEffectContextHandle Context = ASC.MakeEffectContext();
+		if (Offender)
+		{
+			Context.AddInstigator(Offender, Offender);
+		}
+
+		const FGameplayEffectSpecHandle Spec = ASC.MakeOutgoingSpec(UAREnemyIncomingDamageEffect::StaticClass(), 1.f, Context);
+		if (!Spec.IsValid())
+		{
+			return nullptr;
+		}
+		Cached = &SpecsBySource.Add(SourceKey, Spec);
+	}
+
+	Cached->Data->SetSetByCallerMagnitude(UAREnemyIncomingDamageEffect::GetDamageDataName(), Damage);
+	return Cached->Data.Get();
+}
+
+void FARIncomingDamageSpecCache::Reset()
+{
+	OwnerASC.Reset();
+	SpecsBySource.Reset();
+}
@@ -0,0 +1,520 @@
+#include "AREnemyStateTreeExecutorSubsystem.h"
+
+#include "ARLog.h"
+#include "AREnemyBase.h"
+#include "ARStateTreeEnemySchema.h"
+
+#include "StateTree.h"
+#include "StateTreeExecutionContext.h"
+#include "StateTreeExecutionTypes.h"
+#include "Components/StateTreeComponentSchema.h"
+#include "Engine/World.h"
+
+namespace AREnemyStateTreeExecutorInternal
+{
+	static const FGameplayTag& ActivePhaseEventTag()
+	{
+		static const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(TEXT("Event.Wave.Phase.Active")), false);
+		return Tag;
+	}
+
+	static const FGameplayTag& BerserkPhaseEventTag()
+	{
+		static const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(TEXT("Event.Wave.Phase.Berserk")), false);
+		return Tag;
+	}
+
+	static const FGameplayTag& EnteredScreenEventTag()
+	{
+		static const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(TEXT("Event.Enemy.EnteredScreen")), false);
+		return Tag;
+	}
+
+	static const FGameplayTag& InFormationEventTag()
+	{
+		static const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(TEXT("Event.Enemy.InFormation")), false);
+		return Tag;
+	}
+
+	static FOnCollectStateTreeExternalData MakeExternalDataCollector()
+	{
+		// Same resolution as StateTree components: world subsystems, owner components and the owner actor.
+		return FOnCollectStateTreeExternalData::CreateStatic(&UStateTreeComponentSchema::CollectExternalData);
+	}
+}
+
+void UAREnemyStateTreeExecutorSubsystem::Deinitialize()
+{
+	for (FAREnemyStateTreeInstance& Instance : Instances)
+	{
+		StopInstance(Instance, TEXT("Executor deinitialized"));
+	}
+	Instances.Reset();
+	PendingInstances.Reset();
+	InstanceIndexByEnemy.Reset();
+	StateTagReader.Reset();
+	Super::Deinitialize();
+}
+
+bool UAREnemyStateTreeExecutorSubsystem::IsTickable() const
+{
+	return GetWorld() != nullptr && (!Instances.IsEmpty() || !PendingInstances.IsEmpty());
+}
+
+TStatId UAREnemyStateTreeExecutorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAREnemyStateTreeExecutorSubsystem, STATGROUP_Tickables);
+}
+
+void UAREnemyStateTreeExecutorSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld() || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	FlushStructuralChanges();
+
+	bTickingInstances = true;
+	for (FAREnemyStateTreeInstance& Instance : Instances)
+	{
+		if (Instance.bPendingRemoval)
+		{
+			continue;
+		}
+
+		AAREnemyBase* Enemy = Instance.Enemy.Get();
+		if (!Enemy || !Instance.StateTree)
+		{
+			Instance.bPendingRemoval = true;
+			continue;
+		}
+
+		if (!Instance.bRunning)
+		{
+			if (Instance.bStartRequested)
+			{
+				TryStartInstance(Instance, *Enemy);
+			}
+			continue;
+		}
+
+		TickInstance(Instance, *Enemy, DeltaTime);
+	}
+	bTickingInstances = false;
+
+	FlushStructuralChanges();
+}
+
+bool UAREnemyStateTreeExecutorSubsystem::RegisterEnemy(AAREnemyBase& Enemy, UStateTree& StateTree)
+{
+	if (!Enemy.HasAuthority())
+	{
+		return false;
+	}
+
+	if (!StateTree.GetSchema() || !StateTree.GetSchema()->IsA<UARStateTreeEnemySchema>())
+	{
+		UE_LOG(ARLog, Error, TEXT("[EnemyAI|Executor] '%s' cannot run StateTree '%s' without a controller: schema '%s' is not UARStateTreeEnemySchema."),
+			*GetNameSafe(&Enemy), *GetNameSafe(&StateTree), *GetNameSafe(StateTree.GetSchema() ? StateTree.GetSchema()->GetClass() : nullptr));
+		return false;
+	}
+
+	if (!StateTree.IsReadyToRun())
+	{
+		UE_LOG(ARLog, Error, TEXT("[EnemyAI|Executor] '%s' cannot run StateTree '%s': asset is not compiled/ready."),
+			*GetNameSafe(&Enemy), *GetNameSafe(&StateTree));
+		return false;
+	}
+
+	if (IsEnemyRegistered(Enemy))
+	{
+		return true;
+	}
+
+	FAREnemyStateTreeInstance& Instance = PendingInstances.AddDefaulted_GetRef();
+	Instance.Enemy = &Enemy;
+	Instance.StateTree = &StateTree;
+	UE_LOG(ARLog, Verbose, TEXT("[EnemyAI|Executor] Registered '%s' (StateTree='%s')."), *GetNameSafe(&Enemy), *GetNameSafe(&StateTree));
+	return true;
+}
+
+void UAREnemyStateTreeExecutorSubsystem::UnregisterEnemy(AAREnemyBase& Enemy, const FString& Reason)
+{
+	for (int32 Index = PendingInstances.Num() - 1; Index >= 0; --Index)
+	{
+		if (PendingInstances[Index].Enemy.Get() == &Enemy)
+		{
+			PendingInstances.RemoveAtSwap(Index);
+		}
+	}
+
+	const int32* IndexPtr = InstanceIndexByEnemy.Find(&Enemy);
+	if (!IndexPtr || !Instances.IsValidIndex(*IndexPtr))
+	{
+		return;
+	}
+
+	FAREnemyStateTreeInstance& Instance = Instances[*IndexPtr];
+	if (Instance.bPendingRemoval)
+	{
+		return;
+	}
+
+	// The batch may be inside this enemy's own tree tick (e.g. death from a task); stop after the batch instead.
+	Instance.bPendingRemoval = true;
+	Instance.bStartRequested = false;
+	if (!bTickingInstances)
+	{
+		StopInstance(Instance, Reason);
+		FlushStructuralChanges();
+	}
+	else
+	{
+		UE_LOG(ARLog, Verbose, TEXT("[EnemyAI|Executor] Unregister deferred to end of batch for '%s'. Reason: %s"), *GetNameSafe(&Enemy), *Reason);
+	}
+}
+
+bool UAREnemyStateTreeExecutorSubsystem::IsEnemyRegistered(const AAREnemyBase& Enemy) const
+{
+	const FAREnemyStateTreeInstance* Instance = FindInstance(Enemy);
+	return Instance && !Instance->bPendingRemoval;
+}
+
+void UAREnemyStateTreeExecutorSubsystem::RequestStart(AAREnemyBase& Enemy)
+{
+	FAREnemyStateTreeInstance* Instance = FindInstance(Enemy);
+	if (!Instance || Instance->bPendingRemoval || Instance->bRunning)
+	{
+		return;
+	}
+
+	Instance->bStartRequested = true;
+}
+
+bool UAREnemyStateTreeExecutorSubsystem::IsEnemyStateTreeRunning(const AAREnemyBase* Enemy) const
+{
+	const FAREnemyStateTreeInstance* Instance = Enemy ? FindInstance(*Enemy) : nullptr;
+	return Instance && Instance->bRunning && !Instance->bPendingRemoval;
+}
+
+FGameplayTagContainer UAREnemyStateTreeExecutorSubsystem::GetEnemyActiveStateTags(const AAREnemyBase* Enemy) const
+{
+	const FAREnemyStateTreeInstance* Instance = Enemy ? FindInstance(*Enemy) : nullptr;
+	return Instance ? Instance->AppliedStateTags : FGameplayTagContainer();
+}
+
+bool UAREnemyStateTreeExecutorSubsystem::SendStateTreeEvent(AAREnemyBase& Enemy, const FStateTreeEvent& Event)
+{
+	if (!Event.Tag.IsValid())
+	{
+		UE_LOG(ARLog, Warning, TEXT("[EnemyAI|Executor] Dropped StateTree event on '%s': invalid event tag."), *GetNameSafe(&Enemy));
+		return false;
+	}
+
+	FAREnemyStateTreeInstance* Instance = FindInstance(Enemy);
+	if (!Instance || !Instance->bRunning || Instance->bPendingRemoval)
+	{
+		UE_LOG(ARLog, Warning, TEXT("[EnemyAI|Executor] Dropped StateTree event on '%s': StateTree not running (Event=%s)."),
+			*GetNameSafe(&Enemy), *Event.Tag.ToString());
+		return false;
+	}
+
+	Instance->InstanceData.GetMutableEventQueue().SendEvent(&Enemy, Event.Tag, Event.Payload, Event.Origin);
+	return true;
+}
+
+void UAREnemyStateTreeExecutorSubsystem::NotifyWavePhaseChanged(AAREnemyBase& Enemy, int32 WaveInstanceId, EARWavePhase NewPhase)
+{
+	using namespace AREnemyStateTreeExecutorInternal;
+
+	FAREnemyStateTreeInstance* Instance = FindInstance(Enemy);
+	if (!Instance || !Instance->bRunning)
+	{
+		return;
+	}
+
+	if (Instance->LastSentWavePhaseWaveId == WaveInstanceId && Instance->LastSentWavePhase == NewPhase)
+	{
+		return;
+	}
+
+	const FGameplayTag& EventTag = NewPhase == EARWavePhase::Berserk ? BerserkPhaseEventTag() : ActivePhaseEventTag();
+	if (SendWaveEvent(*Instance, Enemy, EventTag, WaveInstanceId))
+	{
+		Instance->LastSentWavePhaseWaveId = WaveInstanceId;
+		Instance->LastSentWavePhase = NewPhase;
+	}
+}
+
+void UAREnemyStateTreeExecutorSubsystem::NotifyEnemyEnteredScreen(AAREnemyBase& Enemy, int32 WaveInstanceId)
+{
+	FAREnemyStateTreeInstance* Instance = FindInstance(Enemy);
+	if (!Instance || !Instance->bRunning || Instance->LastSentEnteredScreenWaveId == WaveInstanceId)
+	{
+		return;
+	}
+
+	if (SendWaveEvent(*Instance, Enemy, AREnemyStateTreeExecutorInternal::EnteredScreenEventTag(), WaveInstanceId))
+	{
+		Instance->LastSentEnteredScreenWaveId = WaveInstanceId;
+	}
+}
+
+void UAREnemyStateTreeExecutorSubsystem::NotifyEnemyInFormation(AAREnemyBase& Enemy, int32 WaveInstanceId)
+{
+	FAREnemyStateTreeInstance* Instance = FindInstance(Enemy);
+	if (!Instance || !Instance->bRunning || Instance->LastSentInFormationWaveId == WaveInstanceId)
+	{
+		return;
+	}
+
+	if (SendWaveEvent(*Instance, Enemy, AREnemyStateTreeExecutorInternal::InFormationEventTag(), WaveInstanceId))
+	{
+		Instance->LastSentInFormationWaveId = WaveInstanceId;
+	}
+}
+
+FAREnemyStateTreeInstance* UAREnemyStateTreeExecutorSubsystem::FindInstance(const AAREnemyBase& Enemy)
+{
+	return const_cast<FAREnemyStateTreeInstance*>(static_cast<const UAREnemyStateTreeExecutorSubsystem*>(this)->FindInstance(Enemy));
+}
+
+const FAREnemyStateTreeInstance* UAREnemyStateTreeExecutorSubsystem::FindInstance(const AAREnemyBase& Enemy) const
+{
+	if (const int32* IndexPtr = InstanceIndexByEnemy.Find(&Enemy))
+	{
+		if (Instances.IsValidIndex(*IndexPtr))
+		{
+			return &Instances[*IndexPtr];
+		}
+	}
+
+	// Registered this frame and not yet merged into the batch.
+	return PendingInstances.FindByPredicate([&Enemy](const FAREnemyStateTreeInstance& Instance)
+	{
+		return Instance.Enemy.Get() == &Enemy;
+	});
+}
+
+bool UAREnemyStateTreeExecutorSubsystem::MakeExecutionContextReady(FStateTreeExecutionContext& Context, AAREnemyBase& Enemy, const UStateTree& StateTree) const
+{
+	if (!Context.IsValid())
+	{
+		return false;
+	}
+
+	if (const UStateTreeSchema* Schema = StateTree.GetSchema())
+	{
+		for (const FStateTreeExternalDataDesc& Desc : Schema->GetContextDataDescs())
+		{
+			const UClass* DescClass = Cast<UClass>(Desc.Struct);
+			if (DescClass && Enemy.IsA(DescClass))
+			{
+				Context.SetContextDataByName(Desc.Name, FStateTreeDataView(&Enemy));
+			}
+		}
+	}
+
+	return Context.AreContextDataViewsValid();
+}
+
+void UAREnemyStateTreeExecutorSubsystem::TryStartInstance(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy)
+{
+	// Don't start until the director has applied wave runtime context.
+	if (Enemy.GetWaveInstanceId() == INDEX_NONE)
+	{
+		if ((Instance.StartAttemptCounter++ % 30) == 0)
+		{
+			UE_LOG(ARLog, Warning, TEXT("[EnemyAI|Executor] Start deferred for '%s': WaveInstanceId not set yet (attempt=%d)."),
+				*GetNameSafe(&Enemy), Instance.StartAttemptCounter);
+		}
+		return;
+	}
+
+	Instance.bStartRequested = false;
+
+	FStateTreeExecutionContext Context(Enemy, *Instance.StateTree, Instance.InstanceData, AREnemyStateTreeExecutorInternal::MakeExternalDataCollector());
+	if (!MakeExecutionContextReady(Context, Enemy, *Instance.StateTree))
+	{
+		UE_LOG(ARLog, Error, TEXT("[EnemyAI|Executor] Start failed for '%s': context data for StateTree '%s' is not satisfied."),
+			*GetNameSafe(&Enemy), *GetNameSafe(Instance.StateTree));
+		return;
+	}
+
+	Context.Start();
+	if (Context.GetStateTreeRunStatus() != EStateTreeRunStatus::Running)
+	{
+		UE_LOG(ARLog, Error, TEXT("[EnemyAI|Executor] Start failed for '%s': StateTree '%s' did not enter running state."),
+			*GetNameSafe(&Enemy), *GetNameSafe(Instance.StateTree));
+		return;
+	}
+
+	Instance.bRunning = true;
+	Instance.StartAttemptCounter = 0;
+	UE_LOG(ARLog, Log, TEXT("[EnemyAI|Executor] Started StateTree '%s' for '%s' (WaveId=%d)."),
+		*GetNameSafe(Instance.StateTree), *GetNameSafe(&Enemy), Enemy.GetWaveInstanceId());
+
+	RefreshStateTags(Instance, Enemy, Context);
+	ReplayWaveFacts(Instance, Enemy);
+}
+
+void UAREnemyStateTreeExecutorSubsystem::TickInstance(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, const float DeltaTime)
+{
+	FStateTreeExecutionContext Context(Enemy, *Instance.StateTree, Instance.InstanceData, AREnemyStateTreeExecutorInternal::MakeExternalDataCollector());
+	if (!MakeExecutionContextReady(Context, Enemy, *Instance.StateTree))
+	{
+		return;
+	}
+
+	const EStateTreeRunStatus RunStatus = Context.Tick(DeltaTime);
+	if (RunStatus != EStateTreeRunStatus::Running)
+	{
+		Instance.bRunning = false;
+		RefreshStateTags(Instance, Enemy, Context);
+		return;
+	}
+
+	// Active states are only re-read when the tree reports a state change, as in UARStateTreeAIComponent.
+	const FStateTreeExecutionState* ExecState = Instance.InstanceData.GetExecutionState();
+	if (ExecState && ExecState->StateChangeCount != Instance.ObservedStateChangeCount)
+	{
+		RefreshStateTags(Instance, Enemy, Context);
+	}
+}
+
+void UAREnemyStateTreeExecutorSubsystem::StopInstance(FAREnemyStateTreeInstance& Instance, const FString& Reason)
+{
+	AAREnemyBase* Enemy = Instance.Enemy.Get();
+	if (Instance.bRunning && Enemy && Instance.StateTree)
+	{
+		FStateTreeExecutionContext Context(*Enemy, *Instance.StateTree, Instance.InstanceData, AREnemyStateTreeExecutorInternal::MakeExternalDataCollector());
+		if (MakeExecutionContextReady(Context, *Enemy, *Instance.StateTree))
+		{
+			Context.Stop();
+		}
+		UE_LOG(ARLog, Verbose, TEXT("[EnemyAI|Executor] Stopped StateTree for '%s'. Reason: %s"), *GetNameSafe(Enemy), *Reason);
+	}
+
+	Instance.bRunning = false;
+	Instance.bStartRequested = false;
+	if (Enemy)
+	{
+		ApplyStateTags(Instance, *Enemy, FGameplayTagContainer());
+	}
+	Instance.AppliedStateTags.Reset();
+}
+
+void UAREnemyStateTreeExecutorSubsystem::RefreshStateTags(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, const FStateTreeExecutionContext& Context)
+{
+	FGameplayTagContainer NewTags;
+	if (Instance.bRunning && !StateTagReader.CollectActiveStateTags(Context, *Instance.StateTree, NewTags))
+	{
+		// Transiently unreadable: keep the previous tags and retry on the next state change.
+		return;
+	}
+
+	if (const FStateTreeExecutionState* ExecState = Instance.InstanceData.GetExecutionState())
+	{
+		Instance.ObservedStateChangeCount = ExecState->StateChangeCount;
+	}
+	ApplyStateTags(Instance, Enemy, NewTags);
+}
+
+void UAREnemyStateTreeExecutorSubsystem::ApplyStateTags(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, const FGameplayTagContainer& NewTags)
+{
+	FGameplayTagContainer AddedTags;
+	FGameplayTagContainer RemovedTags;
+	FARStateTreeStateTagReader::ComputeTagDelta(Instance.AppliedStateTags, NewTags, AddedTags, RemovedTags);
+	if (AddedTags.IsEmpty() && RemovedTags.IsEmpty())
+	{
+		return;
+	}
+
+	UE_LOG(ARLog, Verbose, TEXT("[EnemyAI|Executor|StateTags] '%s' Added={%s} Removed={%s}"),
+		*GetNameSafe(&Enemy), *AddedTags.ToStringSimple(), *RemovedTags.ToStringSimple());
+
+	if (!RemovedTags.IsEmpty())
+	{
+		Enemy.PopASCStateTags(RemovedTags);
+	}
+	if (!AddedTags.IsEmpty())
+	{
+		Enemy.PushASCStateTags(AddedTags);
+	}
+	Instance.AppliedStateTags = NewTags;
+}
+
+bool UAREnemyStateTreeExecutorSubsystem::SendWaveEvent(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, const FGameplayTag& EventTag, const int32 WaveInstanceId)
+{
+	if (!EventTag.IsValid())
+	{
+		return false;
+	}
+
+	Instance.InstanceData.GetMutableEventQueue().SendEvent(&Enemy, EventTag, FConstStructView(), FName(*FString::Printf(TEXT("Wave%d"), WaveInstanceId)));
+	UE_LOG(ARLog, Verbose, TEXT("[EnemyAI|Executor] Sent '%s' for WaveId=%d on '%s'."), *EventTag.ToString(), WaveInstanceId, *GetNameSafe(&Enemy));
+	return true;
+}
+
+void UAREnemyStateTreeExecutorSubsystem::ReplayWaveFacts(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy)
+{
+	// Facts dispatched before the tree was running were dropped; resend the current ones, as the controller does.
+	(void)Instance;
+	NotifyWavePhaseChanged(Enemy, Enemy.GetWaveInstanceId(), Enemy.GetWavePhase());
+	if (Enemy.HasEnteredGameplayScreen())
+	{
+		NotifyEnemyEnteredScreen(Enemy, Enemy.GetWaveInstanceId());
+	}
+	if (Enemy.HasReachedFormationSlot())
+	{
+		NotifyEnemyInFormation(Enemy, Enemy.GetWaveInstanceId());
+	}
+}
+
+void UAREnemyStateTreeExecutorSubsystem::FlushStructuralChanges()
+{
+	if (bTickingInstances)
+	{
+		return;
+	}
+
+	bool bChanged = false;
+	for (int32 Index = Instances.Num() - 1; Index >= 0; --Index)
+	{
+		FAREnemyStateTreeInstance& Instance = Instances[Index];
+		if (!Instance.bPendingRemoval && Instance.Enemy.IsValid())
+		{
+			continue;
+		}
+
+		StopInstance(Instance, TEXT("Unregistered"));
+		Instances.RemoveAtSwap(Index);
+		bChanged = true;
+	}
+
+	if (!PendingInstances.IsEmpty())
+	{
+		Instances.Append(MoveTemp(PendingInstances));
+		PendingInstances.Reset();
+		bChanged = true;
+	}
+
+	if (bChanged)
+	{
+		RebuildInstanceIndex();
+	}
+}
+
+void UAREnemyStateTreeExecutorSubsystem::RebuildInstanceIndex()
+{
+	InstanceIndexByEnemy.Reset();
+	for (int32 Index = 0; Index < Instances.Num(); ++Index)
+	{
+		if (AAREnemyBase* Enemy = Instances[Index].Enemy.Get())
+		{
+			InstanceIndexByEnemy.Add(Enemy, Index);
+		}
+	}
+}
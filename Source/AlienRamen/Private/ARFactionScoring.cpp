@@ -0,0 +1,152 @@
+#include "ARFactionScoring.h"
+
+namespace ARFactionScoringInternal
+{
+	static void AppendChangedTags(const FGameplayTagContainer& From, const FGameplayTagContainer& Against, TSet<FGameplayTag>& OutChanged)
+	{
+		for (const FGameplayTag Tag : From)
+		{
+			if (!Against.HasTagExact(Tag))
+			{
+				OutChanged.Add(Tag);
+			}
+		}
+	}
+}
+
+void FARFactionScoringIndex::Reset()
+{
+	Entries.Reset();
+	EntryIndexByTag.Reset();
+	EntriesByConditionTag.Reset();
+	ScoredProgressionTags.Reset();
+	bBuilt = false;
+	bScored = false;
+}
+
+void FARFactionScoringIndex::Build(TArray<FEntry>&& InEntries)
+{
+	Reset();
+	Entries = MoveTemp(InEntries);
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		FEntry& Entry = Entries[EntryIndex];
+		Entry.ModifierDelta = 0.0f;
+		EntryIndexByTag.Add(Entry.FactionTag, EntryIndex);
+
+		for (const FARFactionPopularityModifierRule& Rule : Entry.Definition.PopularityModifierRules)
+		{
+			if (Rule.ConditionTag.IsValid())
+			{
+				EntriesByConditionTag.FindOrAdd(Rule.ConditionTag).AddUnique(EntryIndex);
+			}
+		}
+	}
+
+	bBuilt = true;
+}
+
+const FARFactionScoringIndex::FEntry* FARFactionScoringIndex::FindEntry(const FGameplayTag& FactionTag) const
+{
+	const int32* EntryIndex = EntryIndexByTag.Find(FactionTag);
+	return EntryIndex ? &Entries[*EntryIndex] : nullptr;
+}
+
+int32 FARFactionScoringIndex::UpdateModifierDeltas(const FGameplayTagContainer& ProgressionTags)
+{
+	if (!bScored)
+	{
+		for (FEntry& Entry : Entries)
+		{
+			Entry.ModifierDelta = ComputeModifierDelta(Entry.Definition, ProgressionTags);
+		}
+		ScoredProgressionTags = ProgressionTags;
+		bScored = true;
+		return Entries.Num();
+	}
+
+	TSet<FGameplayTag> ChangedTags;
+	ARFactionScoringInternal::AppendChangedTags(ProgressionTags, ScoredProgressionTags, ChangedTags);
+	ARFactionScoringInternal::AppendChangedTags(ScoredProgressionTags, ProgressionTags, ChangedTags);
+	if (ChangedTags.IsEmpty())
+	{
+		return 0;
+	}
+
+	// HasTag(Condition) is true when the container holds Condition or a child of it, so a changed tag can flip
+	// rules keyed on itself or any of its parents.
+	TSet<int32> AffectedEntries;
+	for (const FGameplayTag& ChangedTag : ChangedTags)
+	{
+		for (FGameplayTag Tag = ChangedTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+		{
+			if (const TArray<int32>* EntryIndices = EntriesByConditionTag.Find(Tag))
+			{
+				AffectedEntries.Append(*EntryIndices);
+			}
+		}
+	}
+
+	for (const int32 EntryIndex : AffectedEntries)
+	{
+		Entries[EntryIndex].ModifierDelta = ComputeModifierDelta(Entries[EntryIndex].Definition, ProgressionTags);
+	}
+
+	ScoredProgressionTags = ProgressionTags;
+	return AffectedEntries.Num();
+}
+
+void FARFactionScoringIndex::RankWithDrift(const TMap<FGameplayTag, float>& PersistedPopularity, TArray<FRankedFaction>& OutRanked) const
+{
+	OutRanked.Reset(Entries.Num());
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		const FARFactionDefinitionRow& Row = Entry.Definition;
+		const float* Persisted = PersistedPopularity.Find(Entry.FactionTag);
+		const float PriorPopularity = Persisted ? *Persisted : Row.BasePopularity;
+		const float DriftMin = FMath::Min(Row.DriftPerCycleMin, Row.DriftPerCycleMax);
+		const float DriftMax = FMath::Max(Row.DriftPerCycleMin, Row.DriftPerCycleMax);
+
+		FRankedFaction& Ranked = OutRanked.AddDefaulted_GetRef();
+		Ranked.EntryIndex = EntryIndex;
+		Ranked.DriftedPopularity = ClampPopularity(Row, PriorPopularity + FMath::FRandRange(DriftMin, DriftMax));
+		Ranked.EffectiveScore = Ranked.DriftedPopularity + Entry.ModifierDelta;
+	}
+
+	OutRanked.Sort([this](const FRankedFaction& A, const FRankedFaction& B)
+	{
+		if (!FMath::IsNearlyEqual(A.EffectiveScore, B.EffectiveScore))
+		{
+			return A.EffectiveScore > B.EffectiveScore;
+		}
+		return Entries[A.EntryIndex].FactionTag.ToString() < Entries[B.EntryIndex].FactionTag.ToString();
+	});
+}
+
+float FARFactionScoringIndex::ComputeModifierDelta(const FARFactionDefinitionRow& Row, const FGameplayTagContainer& ProgressionTags)
+{
+	float Delta = 0.0f;
+	for (const FARFactionPopularityModifierRule& Rule : Row.PopularityModifierRules)
+	{
+		if (!Rule.ConditionTag.IsValid())
+		{
+			continue;
+		}
+
+		if (ProgressionTags.HasTag(Rule.ConditionTag))
+		{
+			Delta += Rule.Delta;
+		}
+	}
+
+	return Delta;
+}
+
+float FARFactionScoringIndex::ClampPopularity(const FARFactionDefinitionRow& Row, const float Value)
+{
+	const float MinValue = FMath::Min(Row.MinPopularity, Row.MaxPopularity);
+	const float MaxValue = FMath::Max(Row.MinPopularity, Row.MaxPopularity);
+	return FMath::Clamp(Value, MinValue, MaxValue);
+}
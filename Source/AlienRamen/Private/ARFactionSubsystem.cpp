@@ -50,6 +50,7 @@ void UARFactionSubsystem::Deinitialize()
 	SnapshotPopularityStates.Reset();
 	SnapshotRankedFactions.Reset();
 	bSnapshotValid = false;
+	ScoringIndex.Reset();
 	Super::Deinitialize();
 }
 
@@ -229,24 +230,20 @@ bool UARFactionSubsystem::EnsureElectionSnapshot()
 	return true;
 }
 
-bool UARFactionSubsystem::BuildResolvedDefinitions(TArray<FFactionResolvedDef>& OutDefs, FString& OutError) const
+bool UARFactionSubsystem::EnsureDefinitionCache(FString& OutError)
 {
-	OutDefs.Reset();
-	OutError.Reset();
-
 	UGameInstance* GI = GetGameInstance();
-	if (!GI)
+	UContentLookupSubsystem* Lookup = GI ? GI->GetSubsystem<UContentLookupSubsystem>() : nullptr;
+	if (!Lookup)
 	{
-		OutError = TEXT("GameInstance is null.");
+		OutError = TEXT("ContentLookupSubsystem missing.");
 		return false;
 	}
 
-	UContentLookupSubsystem* Lookup = GI->GetSubsystem<UContentLookupSubsystem>();
-	UARSaveSubsystem* SaveSubsystem = GI->GetSubsystem<UARSaveSubsystem>();
-	if (!Lookup || !SaveSubsystem)
+	const uint32 ContentSerial = Lookup->GetContentSerial();
+	if (ScoringIndex.IsBuilt() && ScoringContentSerial == ContentSerial)
 	{
-		OutError = TEXT("Required subsystems are missing.");
-		return false;
+		return true;
 	}
 
 	const UARFactionSettings* FactionSettings = GetDefault<UARFactionSettings>();
@@ -263,6 +260,59 @@ bool UARFactionSubsystem::BuildResolvedDefinitions(TArray<FFactionResolvedDef>&
 		return false;
 	}
 
+	ScoringIndex.Reset();
+	TArray<FARFactionScoringIndex::FEntry> Entries;
+	Entries.Reserve(RowNames.Num());
+	for (const FName RowName : RowNames)
+	{
+		const FGameplayTag CandidateTag = BuildFactionTagFromRootAndLeaf(RootTag, RowName);
+		if (!CandidateTag.IsValid())
+		{
+			continue;
+		}
+
+		FARFactionScoringIndex::FEntry& Entry = Entries.AddDefaulted_GetRef();
+		FString ResolveError;
+		if (!ResolveFactionDefinition(CandidateTag, Entry.Definition, ResolveError))
+		{
+			UE_LOG(ARLog, Warning, TEXT("[Faction] Failed to resolve '%s': %s"), *CandidateTag.ToString(), *ResolveError);
+			Entries.Pop();
+			continue;
+		}
+
+		Entry.FactionTag = Entry.Definition.FactionTag.IsValid() ? Entry.Definition.FactionTag : CandidateTag;
+	}
+
+	ScoringIndex.Build(MoveTemp(Entries));
+	ScoringContentSerial = ContentSerial;
+	UE_LOG(ARLog, Verbose, TEXT("[Faction] Cached %d faction definition(s)."), ScoringIndex.GetEntries().Num());
+	return true;
+}
+
+bool UARFactionSubsystem::BuildResolvedDefinitions(TArray<FFactionResolvedDef>& OutDefs, FString& OutError)
+{
+	OutDefs.Reset();
+	OutError.Reset();
+
+	UGameInstance* GI = GetGameInstance();
+	if (!GI)
+	{
+		OutError = TEXT("GameInstance is null.");
+		return false;
+	}
+
+	UARSaveSubsystem* SaveSubsystem = GI->GetSubsystem<UARSaveSubsystem>();
+	if (!SaveSubsystem)
+	{
+		OutError = TEXT("Required subsystems are missing.");
+		return false;
+	}
+
+	if (!EnsureDefinitionCache(OutError))
+	{
+		return false;
+	}
+
 	const UARSaveGame* SaveGame = SaveSubsystem->GetCurrentSaveGame();
 	FGameplayTagContainer ProgressionTags;
 	int32 IgnoredClout = 0;
@@ -271,7 +321,7 @@ bool UARFactionSubsystem::BuildResolvedDefinitions(TArray<FFactionResolvedDef>&
 	TMap<FGameplayTag, float> PersistedPopularity;
 	if (SaveGame)
 	{
-		for (const FARFactionRuntimeState& RuntimeState : SaveGame->FactionPopularityStates)
+		for (const FARFactionRuntimeState& RuntimeState : SaveGame->GetFactionPopularityStates())
 		{
 			if (RuntimeState.FactionTag.IsValid())
 			{
@@ -280,38 +330,20 @@ bool UARFactionSubsystem::BuildResolvedDefinitions(TArray<FFactionResolvedDef>&
 		}
 	}
 
-	for (const FName RowName : RowNames)
-	{
-		const FGameplayTag CandidateTag = BuildFactionTagFromRootAndLeaf(RootTag, RowName);
-		if (!CandidateTag.IsValid())
-		{
-			continue;
-		}
-
-		FARFactionDefinitionRow Row;
-		FString ResolveError;
-		if (!ResolveFactionDefinition(CandidateTag, Row, ResolveError))
-		{
-			UE_LOG(ARLog, Warning, TEXT("[Faction] Failed to resolve '%s': %s"), *CandidateTag.ToString(), *ResolveError);
-			continue;
-		}
+	ScoringIndex.UpdateModifierDeltas(ProgressionTags);
 
-		const FGameplayTag EffectiveFactionTag = Row.FactionTag.IsValid() ? Row.FactionTag : CandidateTag;
-		const float PriorPopularity = PersistedPopularity.Contains(EffectiveFactionTag) ? PersistedPopularity[EffectiveFactionTag] : Row.BasePopularity;
-		const float DriftMin = FMath::Min(Row.DriftPerCycleMin, Row.DriftPerCycleMax);
-		const float DriftMax = FMath::Max(Row.DriftPerCycleMin, Row.DriftPerCycleMax);
-		const float DriftedPopularity = ClampPopularity(Row, PriorPopularity + FMath::FRandRange(DriftMin, DriftMax));
-		const float ModifierDelta = ComputeModifierDelta(Row, ProgressionTags);
+	TArray<FARFactionScoringIndex::FRankedFaction> Ranked;
+	ScoringIndex.RankWithDrift(PersistedPopularity, Ranked);
 
-		FFactionResolvedDef Resolved;
-		Resolved.FactionTag = EffectiveFactionTag;
-		Resolved.Definition = Row;
-		Resolved.EffectiveScore = DriftedPopularity + ModifierDelta;
-		Resolved.DriftedPopularity = DriftedPopularity;
-		OutDefs.Add(MoveTemp(Resolved));
+	const TArray<FARFactionScoringIndex::FEntry>& Entries = ScoringIndex.GetEntries();
+	OutDefs.Reserve(Ranked.Num());
+	for (const FARFactionScoringIndex::FRankedFaction& Faction : Ranked)
+	{
+		FFactionResolvedDef& Resolved = OutDefs.AddDefaulted_GetRef();
+		Resolved.FactionTag = Entries[Faction.EntryIndex].FactionTag;
+		Resolved.EffectiveScore = Faction.EffectiveScore;
+		Resolved.DriftedPopularity = Faction.DriftedPopularity;
 	}
-
-	OutDefs.Sort(&UARFactionSubsystem::SortByScoreThenTag);
 	return true;
 }
 
@@ -333,6 +365,15 @@ bool UARFactionSubsystem::ResolveFactionDefinition(const FGameplayTag& FactionTa
 		return false;
 	}
 
+	if (ScoringIndex.IsBuilt() && ScoringContentSerial == Lookup->GetContentSerial())
+	{
+		if (const FARFactionScoringIndex::FEntry* Cached = ScoringIndex.FindEntry(FactionTag))
+		{
+			OutRow = Cached->Definition;
+			return true;
+		}
+	}
+
 	FInstancedStruct RowData;
 	if (!Lookup->LookupWithGameplayTag(FactionTag, RowData, OutError))
 	{
@@ -349,25 +390,6 @@ bool UARFactionSubsystem::ResolveFactionDefinition(const FGameplayTag& FactionTa
 	return false;
 }
 
-float UARFactionSubsystem::ComputeModifierDelta(const FARFactionDefinitionRow& Row, const FGameplayTagContainer& ProgressionTags) const
-{
-	float Delta = 0.0f;
-	for (const FARFactionPopularityModifierRule& Rule : Row.PopularityModifierRules)
-	{
-		if (!Rule.ConditionTag.IsValid())
-		{
-			continue;
-		}
-
-		if (ProgressionTags.HasTag(Rule.ConditionTag))
-		{
-			Delta += Rule.Delta;
-		}
-	}
-
-	return Delta;
-}
-
 void UARFactionSubsystem::CommitPopularitySnapshotToSave(UARSaveSubsystem* SaveSubsystem) const
 {
 	if (!SaveSubsystem)
@@ -381,8 +403,8 @@ void UARFactionSubsystem::CommitPopularitySnapshotToSave(UARSaveSubsystem* SaveS
 		return;
 	}
 
-	SaveGame->FactionPopularityStates = SnapshotPopularityStates;
-	for (FARFactionRuntimeState& RuntimeState : SaveGame->FactionPopularityStates)
+	SaveGame->SetFactionPopularityStates(SnapshotPopularityStates);
+	for (FARFactionRuntimeState& RuntimeState : SaveGame->GetMutableFactionPopularityStates())
 	{
 		if (!RuntimeState.FactionTag.IsValid())
 		{
@@ -517,22 +539,6 @@ bool UARFactionSubsystem::IsFactionInCandidates(const TArray<FGameplayTag>& Cand
 	return false;
 }
 
-bool UARFactionSubsystem::SortByScoreThenTag(const FFactionResolvedDef& A, const FFactionResolvedDef& B)
-{
-	if (!FMath::IsNearlyEqual(A.EffectiveScore, B.EffectiveScore))
-	{
-		return A.EffectiveScore > B.EffectiveScore;
-	}
-	return A.FactionTag.ToString() < B.FactionTag.ToString();
-}
-
-float UARFactionSubsystem::ClampPopularity(const FARFactionDefinitionRow& Row, float Value)
-{
-	const float MinValue = FMath::Min(Row.MinPopularity, Row.MaxPopularity);
-	const float MaxValue = FMath::Max(Row.MinPopularity, Row.MaxPopularity);
-	return FMath::Clamp(Value, MinValue, MaxValue);
-}
-
 FGameplayTag UARFactionSubsystem::BuildFactionTagFromRootAndLeaf(const FGameplayTag& RootTag, FName LeafRowName)
 {
 	if (!RootTag.IsValid() || LeafRowName.IsNone())
@@ -0,0 +1,367 @@
+#include "ARFormationMovementComponent.h"
+
+#include "ARAttributeSetCore.h"
+#include "AREnemyBase.h"
+#include "ARLog.h"
+
+#include "AbilitySystemComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+
+namespace ARFormationMovementInternal
+{
+	static FVector EvaluateHold(const FARFormationMotionState& State, const FARFormationPathShape& Shape, const float HoldElapsed)
+	{
+		FVector Location = State.SlotLocation;
+		if (Shape.HoldSwayAmplitude > 0.f && Shape.HoldSwayPeriod > KINDA_SMALL_NUMBER)
+		{
+			const float Sign = State.bFlipY ? -1.f : 1.f;
+			Location.Y += Sign * Shape.HoldSwayAmplitude * FMath::Sin(UE_TWO_PI * HoldElapsed / Shape.HoldSwayPeriod);
+		}
+		return Location;
+	}
+}
+
+UARFormationMovementComponent::UARFormationMovementComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	bAutoActivate = false;
+	bUpdateOnlyIfRendered = false;
+	SetIsReplicatedByDefault(true);
+}
+
+void UARFormationMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(UARFormationMovementComponent, MotionState);
+	DOREPLIFETIME(UARFormationMovementComponent, bSweepRequired);
+}
+
+void UARFormationMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	if (IsActive())
+	{
+		RefreshSweepRequirement();
+		ApplyMovementMode();
+	}
+}
+
+void UARFormationMovementComponent::Activate(bool bReset)
+{
+	Super::Activate(bReset);
+	if (HasBegunPlay())
+	{
+		RefreshSweepRequirement();
+		ApplyMovementMode();
+	}
+}
+
+void UARFormationMovementComponent::Deactivate()
+{
+	Super::Deactivate();
+	SetComponentTickEnabled(false);
+	SuspendCharacterMovement(false);
+	if (AActor* Owner = GetOwner(); Owner && Owner->HasAuthority())
+	{
+		Owner->SetReplicateMovement(true);
+	}
+}
+
+AAREnemyBase* UARFormationMovementComponent::GetOwnerEnemy() const
+{
+	return Cast<AAREnemyBase>(GetOwner());
+}
+
+float UARFormationMovementComponent::GetServerTimeSeconds() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? static_cast<float>(GameState->GetServerWorldTimeSeconds()) : World->GetTimeSeconds();
+}
+
+float UARFormationMovementComponent::ResolveOwnerMoveSpeed() const
+{
+	const AAREnemyBase* Enemy = GetOwnerEnemy();
+	const UAbilitySystemComponent* ASC = Enemy ? Enemy->GetAbilitySystemComponent() : nullptr;
+	return ASC ? FMath::Max(0.f, ASC->GetNumericAttribute(UARAttributeSetCore::GetMoveSpeedAttribute())) : 0.f;
+}
+
+bool UARFormationMovementComponent::StartFormationEntry(bool bInFlipX, bool bInFlipY)
+{
+	AAREnemyBase* Enemy = GetOwnerEnemy();
+	if (!Enemy || !Enemy->HasAuthority() || !UpdatedComponent)
+	{
+		return false;
+	}
+
+	if (!Enemy->HasFormationTargetWorldLocation())
+	{
+		UE_LOG(ARLog, Warning, TEXT("[FormationMove] StartFormationEntry ignored for '%s': no formation target."), *GetNameSafe(Enemy));
+		return false;
+	}
+
+	FARFormationMotionState NewState;
+	NewState.StartLocation = UpdatedComponent->GetComponentLocation();
+	NewState.SlotLocation = Enemy->GetFormationTargetWorldLocation();
+	NewState.StartServerTime = GetServerTimeSeconds();
+	NewState.bFlipX = bInFlipX;
+	NewState.bFlipY = bInFlipY;
+
+	const float Distance = FVector::Dist(NewState.StartLocation, NewState.SlotLocation);
+	const float MoveSpeed = ResolveOwnerMoveSpeed();
+	const float RawDuration = MoveSpeed > KINDA_SMALL_NUMBER ? Distance / MoveSpeed : PathShape.MaxEntryDuration;
+	NewState.EntryDuration = FMath::Clamp(RawDuration, PathShape.MinEntryDuration, FMath::Max(PathShape.MinEntryDuration, PathShape.MaxEntryDuration));
+	NewState.Phase = EARFormationMotionPhase::Entering;
+
+	Enemy->SetReachedFormationSlot(false);
+	SetMotionState(NewState);
+	UE_LOG(ARLog, Verbose, TEXT("[FormationMove] '%s' entering slot (%.1f,%.1f,%.1f) over %.2fs Flip=(%d,%d) Sweep=%d."),
+		*GetNameSafe(Enemy), NewState.SlotLocation.X, NewState.SlotLocation.Y, NewState.SlotLocation.Z,
+		NewState.EntryDuration, bInFlipX ? 1 : 0, bInFlipY ? 1 : 0, bSweepRequired ? 1 : 0);
+	return true;
+}
+
+bool UARFormationMovementComponent::StartDive(FVector WorldDirection, float Speed)
+{
+	AAREnemyBase* Enemy = GetOwnerEnemy();
+	if (!Enemy || !Enemy->HasAuthority() || !UpdatedComponent)
+	{
+		return false;
+	}
+
+	const FVector Direction = WorldDirection.GetSafeNormal();
+	if (Direction.IsNearlyZero())
+	{
+		UE_LOG(ARLog, Warning, TEXT("[FormationMove] StartDive ignored for '%s': zero direction."), *GetNameSafe(Enemy));
+		return false;
+	}
+
+	FARFormationMotionState NewState = MotionState;
+	NewState.Phase = EARFormationMotionPhase::Diving;
+	NewState.StartLocation = UpdatedComponent->GetComponentLocation();
+	NewState.StartServerTime = GetServerTimeSeconds();
+	NewState.DiveDirection = Direction;
+	NewState.DiveSpeed = Speed > 0.f ? Speed : ResolveOwnerMoveSpeed();
+
+	Enemy->SetReachedFormationSlot(false);
+	SetMotionState(NewState);
+	return true;
+}
+
+void UARFormationMovementComponent::StopFormationMovement()
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || MotionState.Phase == EARFormationMotionPhase::None)
+	{
+		return;
+	}
+
+	FARFormationMotionState NewState = MotionState;
+	NewState.Phase = EARFormationMotionPhase::None;
+	NewState.StartLocation = UpdatedComponent ? UpdatedComponent->GetComponentLocation() : FVector(MotionState.StartLocation);
+	SetMotionState(NewState);
+	Velocity = FVector::ZeroVector;
+	UpdateComponentVelocity();
+}
+
+void UARFormationMovementComponent::RefreshSweepRequirement()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority())
+	{
+		return;
+	}
+
+	bool bNewSweepRequired = false;
+	if (UpdatedPrimitive && UpdatedPrimitive->IsQueryCollisionEnabled())
+	{
+		for (const TEnumAsByte<ECollisionChannel> Channel : SweepTriggerChannels)
+		{
+			if (UpdatedPrimitive->GetCollisionResponseToChannel(Channel) == ECR_Block)
+			{
+				bNewSweepRequired = true;
+				break;
+			}
+		}
+	}
+
+	if (bNewSweepRequired != bSweepRequired)
+	{
+		bSweepRequired = bNewSweepRequired;
+		ApplyMovementMode();
+		Owner->ForceNetUpdate();
+	}
+}
+
+void UARFormationMovementComponent::SetMotionState(const FARFormationMotionState& NewState)
+{
+	MotionState = NewState;
+	ApplyMovementMode();
+	if (AActor* Owner = GetOwner())
+	{
+		Owner->ForceNetUpdate();
+	}
+}
+
+void UARFormationMovementComponent::OnRep_MotionState()
+{
+	ApplyMovementMode();
+}
+
+void UARFormationMovementComponent::ApplyMovementMode()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !IsActive())
+	{
+		return;
+	}
+
+	const bool bAuthority = Owner->HasAuthority();
+	if (bAuthority)
+	{
+		// Swept moves can be stopped short of the analytic path, so clients need the real location.
+		Owner->SetReplicateMovement(bSweepRequired);
+	}
+
+	// Clients keep character movement (and its smoothing) only while the server replicates swept positions.
+	const bool bSimulateHere = bAuthority || !bSweepRequired;
+	SuspendCharacterMovement(bSimulateHere);
+	SetComponentTickEnabled(bSimulateHere && MotionState.Phase != EARFormationMotionPhase::None);
+}
+
+void UARFormationMovementComponent::SuspendCharacterMovement(bool bSuspend)
+{
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+	UCharacterMovementComponent* CharacterMovement = Character ? Character->GetCharacterMovement() : nullptr;
+	if (!CharacterMovement || CharacterMovement->IsComponentTickEnabled() == !bSuspend)
+	{
+		return;
+	}
+
+	if (bSuspend)
+	{
+		CharacterMovement->StopMovementImmediately();
+		CharacterMovement->DisableMovement();
+		CharacterMovement->SetComponentTickEnabled(false);
+	}
+	else
+	{
+		CharacterMovement->SetComponentTickEnabled(true);
+		CharacterMovement->SetDefaultMovementMode();
+	}
+}
+
+void UARFormationMovementComponent::AdvanceServerPhase(const float ServerTime)
+{
+	if (MotionState.Phase != EARFormationMotionPhase::Entering)
+	{
+		return;
+	}
+
+	const float EntryEndTime = MotionState.StartServerTime + MotionState.EntryDuration;
+	if (ServerTime < EntryEndTime)
+	{
+		return;
+	}
+
+	// The hold segment starts exactly where the entry ended, so clients evaluating the old segment stay continuous.
+	FARFormationMotionState NewState = MotionState;
+	NewState.Phase = EARFormationMotionPhase::Holding;
+	NewState.StartLocation = MotionState.SlotLocation;
+	NewState.StartServerTime = EntryEndTime;
+	SetMotionState(NewState);
+
+	if (AAREnemyBase* Enemy = GetOwnerEnemy())
+	{
+		Enemy->SetReachedFormationSlot(true);
+	}
+}
+
+FVector UARFormationMovementComponent::EvaluateLocation(const FARFormationMotionState& State, const FARFormationPathShape& Shape, const float ServerTime)
+{
+	const float Elapsed = FMath::Max(0.f, ServerTime - State.StartServerTime);
+	switch (State.Phase)
+	{
+	case EARFormationMotionPhase::Entering:
+	{
+		if (State.EntryDuration <= KINDA_SMALL_NUMBER || Elapsed >= State.EntryDuration)
+		{
+			return ARFormationMovementInternal::EvaluateHold(State, Shape, Elapsed - State.EntryDuration);
+		}
+
+		const float Alpha = Elapsed / State.EntryDuration;
+		const float Progress = Shape.EntryProgressCurve ? Shape.EntryProgressCurve->GetFloatValue(Alpha) : Alpha;
+		FVector Location = FMath::Lerp(FVector(State.StartLocation), FVector(State.SlotLocation), Progress);
+		if (Shape.EntryLateralCurve)
+		{
+			// A single mirror flips handedness, so the side vector of the mirrored path points the other way.
+			const float MirrorSign = State.bFlipX != State.bFlipY ? -1.f : 1.f;
+			const FVector Side = FVector::UpVector ^ (State.SlotLocation - State.StartLocation).GetSafeNormal2D();
+			Location += Side * (Shape.EntryLateralCurve->GetFloatValue(Alpha) * Shape.EntryLateralScale * MirrorSign);
+		}
+		return Location;
+	}
+	case EARFormationMotionPhase::Holding:
+		return ARFormationMovementInternal::EvaluateHold(State, Shape, Elapsed);
+	case EARFormationMotionPhase::Diving:
+		return State.StartLocation + State.DiveDirection * (State.DiveSpeed * Elapsed);
+	default:
+		return State.StartLocation;
+	}
+}
+
+void UARFormationMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!UpdatedComponent || ShouldSkipUpdate(DeltaTime) || MotionState.Phase == EARFormationMotionPhase::None)
+	{
+		return;
+	}
+
+	const float ServerTime = GetServerTimeSeconds();
+	const bool bAuthority = GetOwner()->HasAuthority();
+	if (bAuthority)
+	{
+		AdvanceServerPhase(ServerTime);
+	}
+
+	const FVector Delta = EvaluateLocation(MotionState, PathShape, ServerTime) - UpdatedComponent->GetComponentLocation();
+	if (Delta.IsNearlyZero())
+	{
+		if (!Velocity.IsZero())
+		{
+			Velocity = FVector::ZeroVector;
+			UpdateComponentVelocity();
+		}
+		return;
+	}
+
+	const bool bSweep = bAuthority && bSweepRequired;
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+	FHitResult Hit;
+	MoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), bSweep, bSweep ? &Hit : nullptr);
+
+	// Velocity is kept for animation and facing only; position always comes from the segment. It follows the distance
+	// actually moved (zero while blocked), capped at the segment's own speed so the catch-up after a block stays sane.
+	if (DeltaTime > KINDA_SMALL_NUMBER)
+	{
+		const float PathSpeed = (EvaluateLocation(MotionState, PathShape, ServerTime)
+			- EvaluateLocation(MotionState, PathShape, ServerTime - DeltaTime)).Size() / DeltaTime;
+		Velocity = ((UpdatedComponent->GetComponentLocation() - OldLocation) / DeltaTime).GetClampedToMaxSize(PathSpeed);
+	}
+	else
+	{
+		Velocity = FVector::ZeroVector;
+	}
+	UpdateComponentVelocity();
+}
@@ -1,6 +1,8 @@
 #include "ARGameStateBase.h"
 
+#include "ARGameStateModeStructs.h"
 #include "ARLog.h"
+#include "ARNPCSubsystem.h"
 #include "ARPlayerStateBase.h"
 #include "ARSaveSubsystem.h"
 #include "Engine/GameInstance.h"
@@ -40,6 +42,35 @@ namespace
 		}
 	}
 
+	// Forwards the tags that differ between two unlock sets so only NPCs gated on them re-evaluate dialogue.
+	static void NotifyNpcTalkableUnlocksChanged(const AARGameStateBase* GameState, const FGameplayTagContainer& OldUnlocks, const FGameplayTagContainer& NewUnlocks)
+	{
+		UGameInstance* GI = GameState ? GameState->GetGameInstance() : nullptr;
+		UARNPCSubsystem* NpcSubsystem = GI ? GI->GetSubsystem<UARNPCSubsystem>() : nullptr;
+		if (!NpcSubsystem)
+		{
+			return;
+		}
+
+		FGameplayTagContainer ChangedTags;
+		for (const FGameplayTag Tag : NewUnlocks)
+		{
+			if (!OldUnlocks.HasTagExact(Tag))
+			{
+				ChangedTags.AddTag(Tag);
+			}
+		}
+		for (const FGameplayTag Tag : OldUnlocks)
+		{
+			if (!NewUnlocks.HasTagExact(Tag))
+			{
+				ChangedTags.AddTag(Tag);
+			}
+		}
+
+		NpcSubsystem->RefreshNpcTalkableStatesForChangedTags(FGameplayTagContainer(), ChangedTags);
+	}
+
 	static FARMeatState SanitizeMeatState(const FARMeatState& InMeat)
 	{
 		FARMeatState OutMeat = InMeat;
@@ -88,6 +119,15 @@ namespace
 AARGameStateBase::AARGameStateBase()
 {
 	bReplicates = true;
+
+	// Mode GameStates hand off across travel with mismatched structs, so the base registers all of them.
+	if (HasAnyFlags(RF_ClassDefaultObject) && GetClass() == AARGameStateBase::StaticClass())
+	{
+		FARStructStateAccessorRegistry::Register<AARGameStateBase, FARInvaderGameStateData>();
+		FARStructStateAccessorRegistry::Register<AARGameStateBase, FARScrapyardGameStateData>();
+		FARStructStateAccessorRegistry::Register<AARGameStateBase, FARShopGameStateData>();
+		FARStructStateAccessorRegistry::Register<AARGameStateBase, FARLobbyGameStateData>();
+	}
 }
 
 void AARGameStateBase::BeginPlay()
@@ -346,6 +386,7 @@ void AARGameStateBase::SetUnlocksFromSave(const FGameplayTagContainer& NewUnlock
 	Unlocks = NewUnlocks;
 	OnRep_Unlocks(OldUnlocks);
 	ForceNetUpdate();
+	NotifyNpcTalkableUnlocksChanged(this, OldUnlocks, Unlocks);
 }
 
 bool AARGameStateBase::AddUnlockTag(const FGameplayTag& UnlockTag)
@@ -364,6 +405,7 @@ bool AARGameStateBase::AddUnlockTag(const FGameplayTag& UnlockTag)
 	Unlocks.AddTag(UnlockTag);
 	OnRep_Unlocks(OldUnlocks);
 	ForceNetUpdate();
+	NotifyNpcTalkableUnlocksChanged(this, OldUnlocks, Unlocks);
 	return true;
 }
 
@@ -383,6 +425,7 @@ bool AARGameStateBase::RemoveUnlockTag(const FGameplayTag& UnlockTag)
 	Unlocks.RemoveTag(UnlockTag);
 	OnRep_Unlocks(OldUnlocks);
 	ForceNetUpdate();
+	NotifyNpcTalkableUnlocksChanged(this, OldUnlocks, Unlocks);
 	return true;
 }
 
@@ -795,6 +838,15 @@ void AARGameStateBase::RefreshPauseResolution()
 		bEffectivePauseStateActive = bNewEffectivePauseStateActive;
 		OnRep_EffectivePauseStateActive(bOldEffectivePauseStateActive);
 		bShouldForceNetUpdate = true;
+
+		// Entering pause is a safe point to land any queued autosave.
+		if (bEffectivePauseStateActive)
+		{
+			if (UARSaveSubsystem* SaveSubsystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<UARSaveSubsystem>() : nullptr)
+			{
+				SaveSubsystem->NotifyAutosaveBoundary(EARAutosaveBoundary::Pause);
+			}
+		}
 	}
 
 	if (UWorld* World = GetWorld())
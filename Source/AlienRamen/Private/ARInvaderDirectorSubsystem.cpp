@@ -1,7 +1,9 @@
 #include "ARInvaderDirectorSubsystem.h"
 
 #include "AREnemyBase.h"
+#include "ARAbilitySet.h"
 #include "AREnemyAIController.h"
+#include "ARFormationMovementComponent.h"
 #include "ARAttributeSetCore.h"
 #include "ContentLookupSubsystem.h"
 #include "ARInvaderDirectorSettings.h"
@@ -9,9 +11,11 @@
 #include "ARGameStateBase.h"
 #include "ARLog.h"
 #include "ARPlayerStateBase.h"
+#include "ARSaveSubsystem.h"
 #include "ContentLookupSubsystem.h"
 
 #include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
 #include "Algo/StableSort.h"
 #include "Engine/AssetManager.h"
 #include "Engine/DataTable.h"
@@ -19,15 +23,88 @@
 #include "EngineUtils.h"
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerController.h"
+#include "GameplayEffectComponents/AdditionalEffectsGameplayEffectComponent.h"
 #include "HAL/IConsoleManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "StructUtils/InstancedStruct.h"
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
 
 namespace ARInvaderInternal
 {
 	static constexpr float WaveColorSwapChance = 0.30f;
+
+	// True when the effect reads its source (tags, attributes, cue instigator) while being applied, so one spec
+	// cannot stand in for every enemy of a wave. Effects that touch health/shield/incoming damage also count: the
+	// enemy's damage handling attributes hits to the context instigator, and the shared spec has none.
+	static bool DoesEnemyEffectRequireSourceContext(const UGameplayEffect& Def)
+	{
+		if (Def.Executions.Num() > 0 || Def.GameplayCues.Num() > 0 || Def.FindComponent<UAdditionalEffectsGameplayEffectComponent>())
+		{
+			return true;
+		}
+
+		TArray<FGameplayEffectAttributeCaptureDefinition> Captures;
+		for (const FGameplayModifierInfo& Modifier : Def.Modifiers)
+		{
+			if (Modifier.Attribute == UARAttributeSetCore::GetIncomingDamageAttribute()
+				|| Modifier.Attribute == UARAttributeSetCore::GetHealthAttribute()
+				|| Modifier.Attribute == UARAttributeSetCore::GetShieldAttribute())
+			{
+				return true;
+			}
+
+			if (!Modifier.SourceTags.IsEmpty()
+				|| Modifier.ModifierMagnitude.GetMagnitudeCalculationType() == EGameplayEffectMagnitudeCalculation::CustomCalculationClass)
+			{
+				return true;
+			}
+			Modifier.ModifierMagnitude.GetAttributeCaptureDefinitions(Captures);
+		}
+
+		return Captures.ContainsByPredicate([](const FGameplayEffectAttributeCaptureDefinition& Capture)
+		{
+			return Capture.AttributeSource == EGameplayEffectAttributeCaptureSource::Source;
+		});
+	}
+
+	template <typename TCachedSpec>
+	static const TCachedSpec* FindOrBuildEnemyEffectSpec(TMap<TObjectKey<UClass>, TCachedSpec>& Cache, const TSubclassOf<UGameplayEffect>& EffectClass)
+	{
+		if (!EffectClass)
+		{
+			return nullptr;
+		}
+
+		if (const TCachedSpec* Existing = Cache.Find(EffectClass.Get()))
+		{
+			return Existing->Spec.IsValid() ? Existing : nullptr;
+		}
+
+		TCachedSpec& Entry = Cache.Add(EffectClass.Get());
+		const UGameplayEffect* Def = EffectClass->GetDefaultObject<UGameplayEffect>();
+		if (!Def)
+		{
+			return nullptr;
+		}
+
+		// Level 1 and no instigator, as wave effects are authored; source-dependent specs get the enemy's context on apply.
+		const FGameplayEffectContextHandle Context(UAbilitySystemGlobals::Get().AllocGameplayEffectContext());
+		Entry.Spec = MakeShared<FGameplayEffectSpec>(Def, Context, 1.f);
+		Entry.bRequiresSourceContext = DoesEnemyEffectRequireSourceContext(*Def);
+		return &Entry;
+	}
+
+	// Flow boundaries outside Combat are the director's low-load moments; let queued autosaves land there.
+	static void NotifyAutosaveBoundary(const UWorld* World, EARAutosaveBoundary Boundary)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		if (UARSaveSubsystem* SaveSubsystem = GameInstance ? GameInstance->GetSubsystem<UARSaveSubsystem>() : nullptr)
+		{
+			SaveSubsystem->NotifyAutosaveBoundary(Boundary);
+		}
+	}
 	static FGameplayTag GetStateDownedTag()
 	{
 		return FGameplayTag::RequestGameplayTag(TEXT("State.Downed"), false);
@@ -83,15 +160,52 @@ void UARInvaderDirectorSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 	RegisterConsoleCommands();
 	RebuildPlayerStatusBindings();
 	RefreshPlayerStatusSignals();
+
+	// Compiled startup sets list ability and effect classes; drop them whenever those classes may be replaced.
+	CompiledStartupSets.Reset();
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddUObject(this, &UARInvaderDirectorSubsystem::HandleObjectsReinstanced);
+#if WITH_EDITOR
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UARInvaderDirectorSubsystem::HandleObjectPropertyChanged);
+#endif
 }
 
 void UARInvaderDirectorSubsystem::Deinitialize()
 {
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	ObjectsReinstancedHandle.Reset();
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	ObjectPropertyChangedHandle.Reset();
+#endif
+	CompiledStartupSets.Reset();
+
 	ClearPlayerStatusBindings();
 	UnregisterConsoleCommands();
 	Super::Deinitialize();
 }
 
+void UARInvaderDirectorSubsystem::HandleObjectsReinstanced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	if (!CompiledStartupSets.IsEmpty() && !ReplacementMap.IsEmpty())
+	{
+		UE_LOG(ARLog, Verbose, TEXT("[InvaderDirector] Objects reinstanced; dropping %d compiled enemy startup sets."), CompiledStartupSets.Num());
+		CompiledStartupSets.Reset();
+	}
+}
+
+#if WITH_EDITOR
+void UARInvaderDirectorSubsystem::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	(void)PropertyChangedEvent;
+
+	// In-place edits keep the same set object, which the cache's identity check cannot see.
+	if (Object && (Object->IsA<UARAbilitySet>() || Object->IsA<UARInvaderDirectorSettings>()))
+	{
+		CompiledStartupSets.Reset();
+	}
+}
+#endif
+
 bool UARInvaderDirectorSubsystem::IsTickable() const
 {
 	return GetWorld() != nullptr;
@@ -170,6 +284,7 @@ void UARInvaderDirectorSubsystem::StartInvaderRun(int32 Seed)
 	PlayerDeadCache.Reset();
 	EnemyDefinitionCache.Reset();
 	EnemyClassPreloadHandles.Reset();
+	EnemyAbilitySetPreloadHandles.Reset();
 	OffscreenDurationByEnemy.Reset();
 	PendingStageRow = NAME_None;
 	ChoiceLeftStageRow = NAME_None;
@@ -256,6 +371,7 @@ void UARInvaderDirectorSubsystem::StopInvaderRunWithReason(EARInvaderRunEndReaso
 	PlayerDeadCache.Reset();
 	EnemyDefinitionCache.Reset();
 	EnemyClassPreloadHandles.Reset();
+	EnemyAbilitySetPreloadHandles.Reset();
 	OffscreenDurationByEnemy.Reset();
 	CurrentStageRow = NAME_None;
 	CurrentStageDef = FARStageDefRow();
@@ -278,6 +394,7 @@ void UARInvaderDirectorSubsystem::StopInvaderRunWithReason(EARInvaderRunEndReaso
 		OnAllPlayersDeadChanged.Broadcast(false);
 	}
 	UE_LOG(ARLog, Log, TEXT("[InvaderDirector] Stopped run. Reason=%d"), static_cast<int32>(EndReason));
+	ARInvaderInternal::NotifyAutosaveBoundary(GetWorld(), EARAutosaveBoundary::InvaderFlowTransition);
 }
 
 bool UARInvaderDirectorSubsystem::IsPlayerDowned(const AARPlayerStateBase* PlayerState) const
@@ -480,6 +597,7 @@ bool UARInvaderDirectorSubsystem::SubmitStageChoice(bool bChooseLeft)
 
 	EnterTransition(ChosenRow, ChosenDef);
 	UE_LOG(ARLog, Log, TEXT("[InvaderDirector] Stage choice submitted: %s"), *ChosenRow.ToString());
+	ARInvaderInternal::NotifyAutosaveBoundary(GetWorld(), EARAutosaveBoundary::StageSelected);
 	return true;
 }
 
@@ -613,16 +731,16 @@ void UARInvaderDirectorSubsystem::UpdateWaves(float DeltaTime)
 				break;
 			}
 
-			FARInvaderEnemyDefRow EnemyDef;
 			FString EnemyResolveError;
-			if (!ResolveEnemyDefinitionByTag(SpawnDef.EnemyIdentifierTag, EnemyDef, EnemyResolveError))
+			const FARInvaderEnemyDefRow* EnemyDef = ResolveEnemyDefinitionByTag(SpawnDef.EnemyIdentifierTag, EnemyResolveError);
+			if (!EnemyDef)
 			{
 				UE_LOG(ARLog, Warning, TEXT("[InvaderDirector|Validation] Wave '%s' has invalid enemy tag at spawn index %d: %s"),
 					*Wave.RowName.ToString(), Wave.NextSpawnIndex, *EnemyResolveError);
 				Wave.NextSpawnIndex++;
 				continue;
 			}
-			if (!EnemyDef.bEnabled)
+			if (!EnemyDef->bEnabled)
 			{
 				UE_LOG(ARLog, Warning, TEXT("[InvaderDirector|Validation] Enemy tag '%s' is disabled; skipping spawn in wave '%s'."),
 					*SpawnDef.EnemyIdentifierTag.ToString(), *Wave.RowName.ToString());
@@ -630,7 +748,7 @@ void UARInvaderDirectorSubsystem::UpdateWaves(float DeltaTime)
 				continue;
 			}
 
-			UClass* EnemyClass = EnemyDef.EnemyClass.LoadSynchronous();
+			UClass* EnemyClass = EnemyDef->EnemyClass.LoadSynchronous();
 			if (!EnemyClass)
 			{
 				UE_LOG(ARLog, Warning, TEXT("[InvaderDirector|Validation] Enemy tag '%s' resolved with no enemy class for wave '%s'."),
@@ -678,6 +796,10 @@ void UARInvaderDirectorSubsystem::UpdateWaves(float DeltaTime)
 				GetWorld()->GetTimeSeconds(),
 				Wave.Def.bFormationLockEnter,
 				Wave.Def.bFormationLockActive);
+			if (UARFormationMovementComponent* FormationMovement = Enemy->GetFormationMovement(); FormationMovement && FormationMovement->IsActive())
+			{
+				FormationMovement->StartFormationEntry(Wave.bFlipX, Wave.bFlipY);
+			}
 			UE_LOG(
 				ARLog,
 				Log,
@@ -689,7 +811,7 @@ void UARInvaderDirectorSubsystem::UpdateWaves(float DeltaTime)
 				Enemy->GetFormationTargetWorldLocation().X,
 				Enemy->GetFormationTargetWorldLocation().Y,
 				Enemy->GetFormationTargetWorldLocation().Z);
-			ApplyEnemyGameplayEffects(Enemy, Wave.Def, SpawnDef);
+			ApplyEnemyGameplayEffects(Enemy, Wave, SpawnDef);
 
 			Wave.SpawnedEnemies.Add(Enemy);
 			Wave.SpawnedCount++;
@@ -1389,7 +1511,7 @@ FVector UARInvaderDirectorSubsystem::ComputeSpawnLocation(const FARWaveEnemySpaw
 	return Loc;
 }
 
-void UARInvaderDirectorSubsystem::ApplyEnemyGameplayEffects(AAREnemyBase* Enemy, const FARWaveDefRow& WaveDef, const FARWaveEnemySpawnDef& SpawnDef)
+void UARInvaderDirectorSubsystem::ApplyEnemyGameplayEffects(AAREnemyBase* Enemy, FWaveRuntimeInternal& Wave, const FARWaveEnemySpawnDef& SpawnDef)
 {
 	if (!Enemy || !Enemy->HasAuthority())
 	{
@@ -1405,27 +1527,39 @@ void UARInvaderDirectorSubsystem::ApplyEnemyGameplayEffects(AAREnemyBase* Enemy,
 	}
 
 	int32 AppliedCount = 0;
-	auto ApplyEffects = [ASC, &AppliedCount](const TArray<TSubclassOf<UGameplayEffect>>& Effects)
+	FGameplayEffectContextHandle EnemyContext;
+	auto ApplyEffects = [ASC, &Wave, &AppliedCount, &EnemyContext](const TArray<TSubclassOf<UGameplayEffect>>& Effects)
 	{
 		for (const TSubclassOf<UGameplayEffect>& EffectClass : Effects)
 		{
-			if (!EffectClass)
+			const FCachedEnemyEffectSpec* Cached = ARInvaderInternal::FindOrBuildEnemyEffectSpec(Wave.EnemyEffectSpecs, EffectClass);
+			if (!Cached)
 			{
 				continue;
 			}
 
-			const FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-			const FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(EffectClass, 1.f, Context);
-			if (Spec.IsValid())
+			if (!Cached->bRequiresSourceContext)
 			{
-				ASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+				ASC->ApplyGameplayEffectSpecToSelf(*Cached->Spec);
 				AppliedCount++;
+				continue;
 			}
+
+			// Source-dependent (and damaging) effects keep the old behavior: the enemy is its own source and instigator.
+			if (!EnemyContext.IsValid())
+			{
+				EnemyContext = ASC->MakeEffectContext();
+			}
+			FGameplayEffectSpec TargetSpec(*Cached->Spec);
+			TargetSpec.SetContext(EnemyContext);
+			TargetSpec.CapturedRelevantAttributes.CaptureAttributes(ASC, EGameplayEffectAttributeCaptureSource::Source);
+			ASC->ApplyGameplayEffectSpecToSelf(TargetSpec);
+			AppliedCount++;
 		}
 	};
 
 	ApplyEffects(CurrentStageDef.EnemyGameplayEffects);
-	ApplyEffects(WaveDef.EnemyGameplayEffects);
+	ApplyEffects(Wave.Def.EnemyGameplayEffects);
 	ApplyEffects(SpawnDef.EnemyGameplayEffects);
 
 	if (AppliedCount > 0)
@@ -1434,61 +1568,69 @@ void UARInvaderDirectorSubsystem::ApplyEnemyGameplayEffects(AAREnemyBase* Enemy,
 	}
 }
 
-bool UARInvaderDirectorSubsystem::ResolveEnemyDefinitionByTag(FGameplayTag EnemyIdentifierTag, FARInvaderEnemyDefRow& OutDef, FString& OutError)
+const FARInvaderEnemyDefRow* UARInvaderDirectorSubsystem::ResolveEnemyDefinitionByTag(FGameplayTag EnemyIdentifierTag, FString& OutError)
 {
-	OutDef = FARInvaderEnemyDefRow();
 	OutError.Reset();
 
 	if (!EnemyIdentifierTag.IsValid())
 	{
 		OutError = TEXT("EnemyIdentifierTag is invalid.");
-		return false;
+		return nullptr;
 	}
 
-	if (const FARInvaderEnemyDefRow* Cached = EnemyDefinitionCache.Find(EnemyIdentifierTag))
+	if (const TSharedRef<FARInvaderEnemyDefRow>* Cached = EnemyDefinitionCache.Find(EnemyIdentifierTag))
 	{
-		OutDef = *Cached;
-		return true;
+		return &Cached->Get();
 	}
 
 	UWorld* World = GetWorld();
 	if (!World)
 	{
 		OutError = TEXT("No world.");
-		return false;
+		return nullptr;
 	}
 
 	UGameInstance* GI = World->GetGameInstance();
 	if (!GI)
 	{
 		OutError = TEXT("No game instance.");
-		return false;
+		return nullptr;
 	}
 
 	UContentLookupSubsystem* Lookup = GI->GetSubsystem<UContentLookupSubsystem>();
 	if (!Lookup)
 	{
 		OutError = TEXT("No ContentLookupSubsystem.");
-		return false;
+		return nullptr;
 	}
 
-	FInstancedStruct ResolvedRow;
-	if (!Lookup->LookupWithGameplayTag(EnemyIdentifierTag, ResolvedRow, OutError))
+	const UScriptStruct* RowType = nullptr;
+	const UObject* RowOwner = nullptr;
+	const uint8* RowData = Lookup->FindRowDataByTag(EnemyIdentifierTag, RowType, RowOwner, OutError);
+	if (!RowType || !RowData)
 	{
-		return false;
+		if (OutError.IsEmpty())
+		{
+			OutError = TEXT("Resolved enemy row has no data.");
+		}
+		return nullptr;
 	}
 
-	const UScriptStruct* RowType = ResolvedRow.GetScriptStruct();
-	const void* RowData = ResolvedRow.GetMemory();
-	if (!RowType || !RowData)
+	if (RowType == FARInvaderEnemyDefRow::StaticStruct())
 	{
-		OutError = TEXT("Resolved enemy row has no data.");
-		return false;
+		// Complete native rows are served in place from the resident table.
+		const FARInvaderEnemyDefRow* NativeRow = reinterpret_cast<const FARInvaderEnemyDefRow*>(RowData);
+		if (NativeRow->EnemyIdentifierTag.IsValid() && NativeRow->RuntimeInit.MaxHealth > 0.f)
+		{
+			return NativeRow;
+		}
 	}
 
+	// Heap-allocated so pointers handed out stay valid when later misses grow the map.
+	FARInvaderEnemyDefRow& OutDef = EnemyDefinitionCache.Add(EnemyIdentifierTag, MakeShared<FARInvaderEnemyDefRow>()).Get();
 	if (RowType == FARInvaderEnemyDefRow::StaticStruct())
 	{
-		OutDef = *static_cast<const FARInvaderEnemyDefRow*>(RowData);
+		OutDef = *reinterpret_cast<const FARInvaderEnemyDefRow*>(RowData);
 	}
 	else
 	{
@@ -1584,8 +1726,7 @@ bool UARInvaderDirectorSubsystem::ResolveEnemyDefinitionByTag(FGameplayTag Enemy
 		OutDef.RuntimeInit.MaxHealth = 100.f;
 	}
 
-	EnemyDefinitionCache.Add(EnemyIdentifierTag, OutDef);
-	return true;
+	return &OutDef;
 }
 
 void UARInvaderDirectorSubsystem::PreloadEnemyClass(const TSoftClassPtr<AAREnemyBase>& EnemyClassRef)
@@ -1608,6 +1749,29 @@ void UARInvaderDirectorSubsystem::PreloadEnemyClass(const TSoftClassPtr<AAREnemy
 	}
 }
 
+void UARInvaderDirectorSubsystem::PreloadEnemyAbilitySets(const FGameplayTag& ArchetypeTag)
+{
+	if (EnemyAbilitySetPreloadHandles.Contains(ArchetypeTag))
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	AAREnemyBase::GetStartupAbilitySetPaths(ArchetypeTag, Paths);
+	if (Paths.IsEmpty())
+	{
+		return;
+	}
+
+	// Compile the archetype's grant list as soon as its sets arrive, so the first spawn only grants.
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(Paths, FStreamableDelegate::CreateWeakLambda(this, [this, ArchetypeTag]()
+	{
+		AAREnemyBase::PrewarmStartupAbilitySet(*this, ArchetypeTag);
+	}));
+	EnemyAbilitySetPreloadHandles.Add(ArchetypeTag, Handle);
+}
+
 void UARInvaderDirectorSubsystem::PreloadEnemyClassesForWaveCandidates()
 {
 	if (!WaveTable || !StageTable)
@@ -1693,11 +1857,11 @@ void UARInvaderDirectorSubsystem::PreloadEnemyClassesForWaveCandidates()
 
 		for (const FARWaveEnemySpawnDef& SpawnDef : Row->EnemySpawns)
 		{
-			FARInvaderEnemyDefRow EnemyDef;
 			FString Error;
-			if (ResolveEnemyDefinitionByTag(SpawnDef.EnemyIdentifierTag, EnemyDef, Error))
+			if (const FARInvaderEnemyDefRow* EnemyDef = ResolveEnemyDefinitionByTag(SpawnDef.EnemyIdentifierTag, Error))
 			{
-				PreloadEnemyClass(EnemyDef.EnemyClass);
+				PreloadEnemyClass(EnemyDef->EnemyClass);
+				PreloadEnemyAbilitySets(EnemyDef->RuntimeInit.EnemyArchetypeTag);
 			}
 		}
 	}
@@ -2050,6 +2214,7 @@ void UARInvaderDirectorSubsystem::EnterStageChoice()
 
 	UE_LOG(ARLog, Log, TEXT("[InvaderDirector] Stage choice started. Left='%s' Right='%s'."),
 		*ChoiceLeftStageRow.ToString(), *ChoiceRightStageRow.ToString());
+	ARInvaderInternal::NotifyAutosaveBoundary(GetWorld(), EARAutosaveBoundary::InvaderFlowTransition);
 }
 
 void UARInvaderDirectorSubsystem::EnterTransition(FName ChosenStageRow, const FARStageDefRow& ChosenStageDef)
@@ -64,9 +64,22 @@ namespace
 	}
 }
 
+void UARNPCSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UARSaveSubsystem* SaveSubsystem = Collection.InitializeDependency<UARSaveSubsystem>())
+	{
+		SaveSubsystem->OnProgressionTagChanged.AddDynamic(this, &UARNPCSubsystem::HandleProgressionTagChanged);
+		// A load replaces every input at once; only a full sweep is correct there.
+		SaveSubsystem->OnGameLoaded.AddDynamic(this, &UARNPCSubsystem::RefreshAllNpcTalkableStates);
+	}
+}
+
 void UARNPCSubsystem::Deinitialize()
 {
 	NpcTalkableCache.Reset();
+	NpcStates.Reset();
 	Super::Deinitialize();
 }
 
@@ -97,39 +110,144 @@ static UARDialogueSubsystem* GetDialogueSubsystem(const UARNPCSubsystem* Subsyst
 	return nullptr;
 }
 
-static FARNpcRelationshipState* FindNpcState(UARSaveGame* SaveGame, const FGameplayTag NpcTag)
+void FARNpcStateRegistry::Reset()
 {
-	if (!SaveGame || !NpcTag.IsValid())
+	BoundSaveGame.Reset();
+	IndexByTag.Reset();
+	IndexedStateCount = 0;
+	IndexedStatesSerial = 0;
+	++Generation;
+}
+
+void FARNpcStateRegistry::SyncWith(UARSaveGame* SaveGame)
+{
+	const int32 StateCount = SaveGame->GetNpcRelationshipStates().Num();
+	if (BoundSaveGame.Get() != SaveGame || IndexedStatesSerial != SaveGame->GetNpcRelationshipStatesSerial()
+		|| IndexedStateCount != StateCount)
 	{
-		return nullptr;
+		Rebuild(SaveGame);
 	}
+}
 
-	for (FARNpcRelationshipState& State : SaveGame->NpcRelationshipStates)
+void FARNpcStateRegistry::Rebuild(UARSaveGame* SaveGame)
+{
+	IndexByTag.Reset();
+	const TArray<FARNpcRelationshipState>& States = SaveGame->GetNpcRelationshipStates();
+	for (int32 Index = 0; Index < States.Num(); ++Index)
 	{
-		if (State.NpcTag.MatchesTagExact(NpcTag))
+		// First entry wins on duplicates, matching the linear scan this replaces.
+		const FGameplayTag NpcTag = States[Index].NpcTag;
+		if (NpcTag.IsValid() && !IndexByTag.Contains(NpcTag))
 		{
-			return &State;
+			IndexByTag.Add(NpcTag, Index);
 		}
 	}
-	return nullptr;
+
+	BoundSaveGame = SaveGame;
+	IndexedStateCount = States.Num();
+	IndexedStatesSerial = SaveGame->GetNpcRelationshipStatesSerial();
+	++Generation;
+}
+
+FARNpcStateHandle FARNpcStateRegistry::FindHandle(UARSaveGame* SaveGame, const FGameplayTag NpcTag)
+{
+	FARNpcStateHandle Handle;
+	if (!SaveGame || !NpcTag.IsValid())
+	{
+		return Handle;
+	}
+
+	SyncWith(SaveGame);
+	const int32* Index = IndexByTag.Find(NpcTag);
+	if (Index && !SaveGame->GetNpcRelationshipStates()[*Index].NpcTag.MatchesTagExact(NpcTag))
+	{
+		// Rows swapped through GetMutableNpcRelationshipStates without a serial change; re-index once.
+		Rebuild(SaveGame);
+		Index = IndexByTag.Find(NpcTag);
+	}
+
+	if (Index)
+	{
+		Handle.NpcTag = NpcTag;
+		Handle.Index = *Index;
+		Handle.Generation = Generation;
+	}
+	return Handle;
+}
+
+FARNpcStateHandle FARNpcStateRegistry::AddState(UARSaveGame* SaveGame, const FARNpcRelationshipState& State)
+{
+	FARNpcStateHandle Handle;
+	if (!SaveGame || !State.NpcTag.IsValid())
+	{
+		return Handle;
+	}
+
+	SyncWith(SaveGame);
+	const int32* Existing = IndexByTag.Find(State.NpcTag);
+	if (Existing && !SaveGame->GetNpcRelationshipStates()[*Existing].NpcTag.MatchesTagExact(State.NpcTag))
+	{
+		Rebuild(SaveGame);
+		Existing = IndexByTag.Find(State.NpcTag);
+	}
+
+	if (Existing)
+	{
+		Handle.NpcTag = State.NpcTag;
+		Handle.Index = *Existing;
+		Handle.Generation = Generation;
+		return Handle;
+	}
+
+	TArray<FARNpcRelationshipState>& States = SaveGame->GetMutableNpcRelationshipStates();
+	const int32 NewIndex = States.Add(State);
+	IndexByTag.Add(State.NpcTag, NewIndex);
+	IndexedStateCount = States.Num();
+
+	Handle.NpcTag = State.NpcTag;
+	Handle.Index = NewIndex;
+	Handle.Generation = Generation;
+	return Handle;
+}
+
+FARNpcRelationshipState* FARNpcStateRegistry::Resolve(UARSaveGame* SaveGame, const FARNpcStateHandle& Handle) const
+{
+	if (!SaveGame || !Handle.IsValid() || Handle.Generation != Generation || BoundSaveGame.Get() != SaveGame)
+	{
+		return nullptr;
+	}
+
+	TArray<FARNpcRelationshipState>& States = SaveGame->GetMutableNpcRelationshipStates();
+	if (!States.IsValidIndex(Handle.Index) || !States[Handle.Index].NpcTag.MatchesTagExact(Handle.NpcTag))
+	{
+		return nullptr;
+	}
+	return &States[Handle.Index];
+}
+
+UARSaveGame* UARNPCSubsystem::GetCurrentSaveGame() const
+{
+	UARSaveSubsystem* SaveSubsystem = GetSaveSubsystem(this);
+	return SaveSubsystem ? SaveSubsystem->GetCurrentSaveGame() : nullptr;
 }
 
-static FARNpcRelationshipState* FindOrAddNpcState(UARNPCSubsystem* Subsystem, UARSaveGame* SaveGame, const FGameplayTag NpcTag)
+FARNpcRelationshipState* UARNPCSubsystem::FindOrAddNpcState(UARSaveGame* SaveGame, const FGameplayTag NpcTag)
 {
 	if (!SaveGame || !NpcTag.IsValid())
 	{
 		return nullptr;
 	}
 
-	if (FARNpcRelationshipState* Existing = FindNpcState(SaveGame, NpcTag))
+	const FARNpcStateHandle Existing = NpcStates.FindHandle(SaveGame, NpcTag);
+	if (Existing.IsValid())
 	{
-		return Existing;
+		return NpcStates.Resolve(SaveGame, Existing);
 	}
 
-	FARNpcRelationshipState& Added = SaveGame->NpcRelationshipStates.AddDefaulted_GetRef();
+	FARNpcRelationshipState Added;
 	Added.NpcTag = NpcTag;
 
-	if (UContentLookupSubsystem* Lookup = GetLookupSubsystem(Subsystem))
+	if (UContentLookupSubsystem* Lookup = GetLookupSubsystem(this))
 	{
 		FARNpcDefinitionRow Def;
 		if (ResolveNpcDefinition(Lookup, NpcTag, Def))
@@ -140,7 +258,7 @@ static FARNpcRelationshipState* FindOrAddNpcState(UARNPCSubsystem* Subsystem, UA
 		}
 	}
 
-	return &Added;
+	return NpcStates.Resolve(SaveGame, NpcStates.AddState(SaveGame, Added));
 }
 
 bool UARNPCSubsystem::SubmitNpcRamenDelivery(FGameplayTag NpcTag, FGameplayTag DeliveredRamenTag, bool& bOutAccepted)
@@ -159,7 +277,7 @@ bool UARNPCSubsystem::SubmitNpcRamenDelivery(FGameplayTag NpcTag, FGameplayTag D
 		return false;
 	}
 
-	FARNpcRelationshipState* State = FindOrAddNpcState(this, SaveGame, NpcTag);
+	FARNpcRelationshipState* State = FindOrAddNpcState(SaveGame, NpcTag);
 	if (!State)
 	{
 		return false;
@@ -188,28 +306,27 @@ bool UARNPCSubsystem::SubmitNpcRamenDelivery(FGameplayTag NpcTag, FGameplayTag D
 bool UARNPCSubsystem::TryGetNpcRelationshipState(FGameplayTag NpcTag, FARNpcRelationshipState& OutState) const
 {
 	OutState = FARNpcRelationshipState();
-	if (!NpcTag.IsValid())
+	if (const FARNpcRelationshipState* State = FindNpcRelationshipState(NpcTag))
 	{
-		return false;
+		OutState = *State;
+		return true;
 	}
+	return false;
+}
 
-	UARSaveSubsystem* SaveSubsystem = GetSaveSubsystem(this);
-	const UARSaveGame* SaveGame = SaveSubsystem ? SaveSubsystem->GetCurrentSaveGame() : nullptr;
-	if (!SaveGame)
-	{
-		return false;
-	}
+const FARNpcRelationshipState* UARNPCSubsystem::FindNpcRelationshipState(FGameplayTag NpcTag) const
+{
+	return ResolveNpcStateHandle(FindNpcStateHandle(NpcTag));
+}
 
-	for (const FARNpcRelationshipState& State : SaveGame->NpcRelationshipStates)
-	{
-		if (State.NpcTag.MatchesTagExact(NpcTag))
-		{
-			OutState = State;
-			return true;
-		}
-	}
+FARNpcStateHandle UARNPCSubsystem::FindNpcStateHandle(FGameplayTag NpcTag) const
+{
+	return NpcStates.FindHandle(GetCurrentSaveGame(), NpcTag);
+}
 
-	return false;
+const FARNpcRelationshipState* UARNPCSubsystem::ResolveNpcStateHandle(const FARNpcStateHandle& Handle) const
+{
+	return NpcStates.Resolve(GetCurrentSaveGame(), Handle);
 }
 
 bool UARNPCSubsystem::IsNpcTalkable(FGameplayTag NpcTag) const
@@ -286,3 +403,33 @@ void UARNPCSubsystem::RefreshAllNpcTalkableStates()
 		RefreshNpcTalkableState(NpcTag);
 	}
 }
+
+void UARNPCSubsystem::RefreshNpcTalkableStatesForChangedTags(const FGameplayTagContainer& ChangedProgressionTags, const FGameplayTagContainer& ChangedUnlockTags)
+{
+	if (ChangedProgressionTags.IsEmpty() && ChangedUnlockTags.IsEmpty())
+	{
+		return;
+	}
+
+	UARDialogueSubsystem* DialogueSubsystem = GetDialogueSubsystem(this);
+	if (!DialogueSubsystem)
+	{
+		return;
+	}
+
+	TSet<FGameplayTag> AffectedNpcTags;
+	DialogueSubsystem->GatherNpcsAffectedByTagChanges(ChangedProgressionTags, ChangedUnlockTags, AffectedNpcTags);
+	for (const FGameplayTag& NpcTag : AffectedNpcTags)
+	{
+		RefreshNpcTalkableState(NpcTag);
+	}
+
+	UE_LOG(ARLog, Verbose, TEXT("[NPC] Incremental talkable refresh: %d NPC(s) affected by %d progression / %d unlock tag change(s)."),
+		AffectedNpcTags.Num(), ChangedProgressionTags.Num(), ChangedUnlockTags.Num());
+}
+
+void UARNPCSubsystem::HandleProgressionTagChanged(FGameplayTag ProgressionTag, bool bAdded)
+{
+	(void)bAdded;
+	RefreshNpcTalkableStatesForChangedTags(FGameplayTagContainer(ProgressionTag), FGameplayTagContainer());
+}
@@ -24,12 +24,110 @@
 #include "UObject/UnrealType.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Engine/World.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameplayEffectExtension.h"
 
-static UARWeaponDefinition* ExtractWeaponDef(const UScriptStruct* StructType, const void* StructData, FName PropName);
+// --------------------
+// Loadout row plans
+// --------------------
+
+struct FARLoadoutRowPlan
+{
+	const FProperty* Stats = nullptr;
+	const FProperty* PrimaryWeapon = nullptr;
+	const FArrayProperty* StartupAbilities = nullptr;
+	const FArrayProperty* StartupEffects = nullptr;
+	const FStructProperty* ShipTags = nullptr;
+	const FStructProperty* MovementType = nullptr;
+};
+
+namespace ARLoadoutPlanInternal
+{
+	static const void* FieldValue(const FProperty* Field, const void* StructData)
+	{
+		return (Field && StructData) ? Field->ContainerPtrToValuePtr<void>(StructData) : nullptr;
+	}
+
+	// Object or class value of a hard or soft field. Soft values are normally resident because the loadout streams
+	// them in before applying; anything that is not falls back to a synchronous load.
+	static UObject* ResolveObjectValue(const FProperty* Prop, const void* ValuePtr)
+	{
+		if (!Prop || !ValuePtr)
+		{
+			return nullptr;
+		}
+
+		if (const FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Prop))
+		{
+			FSoftObjectPtr Soft = SoftProp->GetPropertyValue(ValuePtr);
+			if (UObject* Resident = Soft.Get())
+			{
+				return Resident;
+			}
+			if (Soft.IsNull())
+			{
+				return nullptr;
+			}
+
+			UE_LOG(ARLog, Verbose, TEXT("[ShipGAS] Loadout asset '%s' was not preloaded; loading synchronously."), *Soft.ToString());
+			return Soft.LoadSynchronous();
+		}
+
+		if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Prop))
+		{
+			return ObjectProp->GetObjectPropertyValue(ValuePtr);
+		}
+
+		return nullptr;
+	}
+
+	template <typename FuncType>
+	static void ForEachArrayElement(const FArrayProperty* ArrayProp, const void* StructData, FuncType&& Func)
+	{
+		if (!ArrayProp || !ArrayProp->Inner || !StructData)
+		{
+			return;
+		}
+
+		FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(StructData));
+		for (int32 Index = 0; Index < Helper.Num(); ++Index)
+		{
+			Func(ArrayProp->Inner, Helper.GetRawPtr(Index));
+		}
+	}
+
+	static void CollectUnloadedPath(const FProperty* Prop, const void* ValuePtr, TArray<FSoftObjectPath>& OutPaths)
+	{
+		const FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Prop);
+		if (!SoftProp || !ValuePtr)
+		{
+			return;
+		}
+
+		const FSoftObjectPtr Soft = SoftProp->GetPropertyValue(ValuePtr);
+		if (!Soft.IsNull() && !Soft.Get())
+		{
+			OutPaths.AddUnique(Soft.ToSoftObjectPath());
+		}
+	}
+
+	static void CollectUnloadedAssets(const FARLoadoutRowPlan& Plan, const void* StructData, TArray<FSoftObjectPath>& OutPaths)
+	{
+		CollectUnloadedPath(Plan.Stats, FieldValue(Plan.Stats, StructData), OutPaths);
+		CollectUnloadedPath(Plan.PrimaryWeapon, FieldValue(Plan.PrimaryWeapon, StructData), OutPaths);
+
+		auto CollectElement = [&OutPaths](const FProperty* Inner, const void* ElemPtr)
+		{
+			CollectUnloadedPath(Inner, ElemPtr, OutPaths);
+		};
+		ForEachArrayElement(Plan.StartupAbilities, StructData, CollectElement);
+		ForEachArrayElement(Plan.StartupEffects, StructData, CollectElement);
+	}
+}
 
 // --------------------
 // Static names (row struct fields)
@@ -119,7 +217,9 @@ const UARWeaponDefinition* AARPlayerCharacterInvader::GetPrimaryWeaponDefinition
 		return nullptr;
 	}
 
-	if (UARWeaponDefinition* ResolvedWeapon = ExtractWeaponDef(StructType, StructData, NAME_PrimaryWeapon))
+	const TSharedRef<const FARLoadoutRowPlan> Plan = FindOrCompileLoadoutRowPlan(*StructType);
+	if (UARWeaponDefinition* ResolvedWeapon = Cast<UARWeaponDefinition>(
+		ARLoadoutPlanInternal::ResolveObjectValue(Plan->PrimaryWeapon, ARLoadoutPlanInternal::FieldValue(Plan->PrimaryWeapon, StructData))))
 	{
 		// Cache for subsequent calls.
 		const_cast<AARPlayerCharacterInvader*>(this)->CurrentPrimaryWeapon = ResolvedWeapon;
@@ -131,6 +231,10 @@ const UARWeaponDefinition* AARPlayerCharacterInvader::GetPrimaryWeaponDefinition
 
 namespace ARPlayerCharacterInvaderLocal
 {
+	// Fallback loadout retries for failures that no loadout-tag change reports (about five seconds in total).
+	static constexpr int32 MaxServerLoadoutRetries = 10;
+	static constexpr float ServerLoadoutRetrySeconds = 0.5f;
+
 	static void AddRuntimeTags(UAbilitySystemComponent* ASC, const FGameplayTagContainer& Tags, bool bAuthority)
 	{
 		if (!ASC || Tags.IsEmpty())
@@ -246,21 +350,13 @@ bool AARPlayerCharacterInvader::ApplyDamageViaGAS(float Damage, AActor* Offender
 		return false;
 	}
 
-	static const FName ShipDataDamageName(TEXT("Data.Damage"));
-	FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
-	if (Offender)
-	{
-		Context.AddInstigator(Offender, Offender);
-	}
-
-	const FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(UAREnemyIncomingDamageEffect::StaticClass(), 1.f, Context);
-	if (!Spec.IsValid())
+	const FGameplayEffectSpec* Spec = IncomingDamageSpecs.Prepare(*ASC, Offender, Damage);
+	if (!Spec)
 	{
 		return false;
 	}
 
-	Spec.Data->SetSetByCallerMagnitude(ShipDataDamageName, Damage);
-	ASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+	ASC->ApplyGameplayEffectSpecToSelf(*Spec);
 	OutCurrentHealth = ASC->GetNumericAttribute(UARAttributeSetCore::GetHealthAttribute());
 	return true;
 }
@@ -293,6 +389,23 @@ bool AARPlayerCharacterInvader::ApplyDamageToTargetViaGAS(AActor* Target, float
 	return ARPlayerCharacterInvaderLocal::ApplyDamageToActorViaGAS_Local(Target, DamageToApply, this);
 }
 
+void AARPlayerCharacterInvader::MulticastPrimaryShotsFired_Implementation(const uint8 ShotCount, const float NewestShotOffset, const float ShotInterval)
+{
+	// The server and the owning client already ran the ability's BP_OnShotsFired for this step.
+	if (GetLocalRole() != ROLE_SimulatedProxy || ShotCount == 0)
+	{
+		return;
+	}
+
+	TArray<float> ShotTimeOffsets;
+	ShotTimeOffsets.Reserve(ShotCount);
+	for (int32 ShotIndex = 0; ShotIndex < ShotCount; ++ShotIndex)
+	{
+		ShotTimeOffsets.Add(NewestShotOffset + ShotInterval * static_cast<float>(ShotCount - 1 - ShotIndex));
+	}
+	BP_OnRemoteShotsFired(ShotCount, ShotTimeOffsets);
+}
+
 void AARPlayerCharacterInvader::ServerRequestCollectInvaderDrop_Implementation(AARInvaderDropBase* Drop)
 {
 	if (!HasAuthority() || !Drop)
@@ -323,134 +436,63 @@ FProperty* AARPlayerCharacterInvader::FindPropertyByNamePrefix(const UScriptStru
 	return nullptr;
 }
 
-static TSubclassOf<UGameplayEffect> ExtractEffectClass(const UScriptStruct* StructType, const void* StructData, FName PropName)
+TSharedRef<const FARLoadoutRowPlan> AARPlayerCharacterInvader::FindOrCompileLoadoutRowPlan(const UScriptStruct& RowStruct) const
 {
-	if (!StructType || !StructData) return nullptr;
-
-	FProperty* P = AARPlayerCharacterInvader::FindPropertyByNamePrefix(StructType, PropName.ToString());
-	if (!P) return nullptr;
-
-	if (const FClassProperty* ClassProp = CastField<FClassProperty>(P))
+	if (const TSharedRef<const FARLoadoutRowPlan>* Cached = LoadoutRowPlans.Find(&RowStruct))
 	{
-		UClass* C = Cast<UClass>(ClassProp->GetPropertyValue_InContainer(StructData));
-		return C ? TSubclassOf<UGameplayEffect>(C) : nullptr;
+		return *Cached;
 	}
 
-	if (const FSoftClassProperty* SoftClassProp = CastField<FSoftClassProperty>(P))
-	{
-		const FSoftObjectPtr Soft = SoftClassProp->GetPropertyValue_InContainer(StructData);
-		UClass* C = Cast<UClass>(Soft.LoadSynchronous());
-		return C ? TSubclassOf<UGameplayEffect>(C) : nullptr;
-	}
+	const TSharedRef<FARLoadoutRowPlan> PlanRef = MakeShared<FARLoadoutRowPlan>();
+	FARLoadoutRowPlan& Plan = PlanRef.Get();
+	Plan.Stats = FindPropertyByNamePrefix(&RowStruct, NAME_Stats.ToString());
+	Plan.PrimaryWeapon = FindPropertyByNamePrefix(&RowStruct, NAME_PrimaryWeapon.ToString());
+	Plan.StartupAbilities = CastField<FArrayProperty>(FindPropertyByNamePrefix(&RowStruct, NAME_StartupAbilities.ToString()));
+	Plan.StartupEffects = CastField<FArrayProperty>(FindPropertyByNamePrefix(&RowStruct, NAME_StartupEffects.ToString()));
 
-	return nullptr;
-}
-
-static UARWeaponDefinition* ExtractWeaponDef(const UScriptStruct* StructType, const void* StructData, FName PropName)
-{
-	if (!StructType || !StructData) return nullptr;
-
-	FProperty* P = AARPlayerCharacterInvader::FindPropertyByNamePrefix(StructType, PropName.ToString());
-	if (!P) return nullptr;
-
-	if (const FObjectProperty* ObjProp = CastField<FObjectProperty>(P))
-	{
-		UObject* Obj = ObjProp->GetObjectPropertyValue_InContainer(StructData);
-		return Cast<UARWeaponDefinition>(Obj);
-	}
-
-	if (const FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(P))
-	{
-		const FSoftObjectPtr Soft = SoftProp->GetPropertyValue_InContainer(StructData);
-		UObject* Obj = Soft.LoadSynchronous();
-		return Cast<UARWeaponDefinition>(Obj);
-	}
+	// Tag fields only count when they hold the expected tag type.
+	const FStructProperty* ShipTags = CastField<FStructProperty>(FindPropertyByNamePrefix(&RowStruct, NAME_ShipTags.ToString()));
+	Plan.ShipTags = (ShipTags && ShipTags->Struct == FGameplayTagContainer::StaticStruct()) ? ShipTags : nullptr;
+	const FStructProperty* MovementType = CastField<FStructProperty>(FindPropertyByNamePrefix(&RowStruct, NAME_MovementType.ToString()));
+	Plan.MovementType = (MovementType && MovementType->Struct == FGameplayTag::StaticStruct()) ? MovementType : nullptr;
 
-	return nullptr;
+	LoadoutRowPlans.Add(&RowStruct, PlanRef);
+	UE_LOG(ARLog, Verbose, TEXT("[ShipGAS] Compiled loadout row plan for struct '%s'."), *RowStruct.GetName());
+	return PlanRef;
 }
 
-static void GrantAbilityArrayFromStruct(
+static void GrantAbilityArrayFromPlan(
 	UAbilitySystemComponent* ASC,
-	const UScriptStruct* StructType,
+	const FArrayProperty* ArrayProp,
 	const void* StructData,
-	FName ArrayPropName,
 	TArray<FGameplayAbilitySpecHandle>& OutGrantedHandles
 )
 {
-	if (!ASC || !StructType || !StructData) return;
-
-	FProperty* P = AARPlayerCharacterInvader::FindPropertyByNamePrefix(StructType, ArrayPropName.ToString());
-	FArrayProperty* ArrayProp = CastField<FArrayProperty>(P);
-	if (!ArrayProp) return;
-
-	FProperty* Inner = ArrayProp->Inner;
-	if (!Inner) return;
-
-	FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(StructData));
-	const int32 Num = Helper.Num();
+	if (!ASC) return;
 
-	for (int32 i = 0; i < Num; ++i)
+	ARLoadoutPlanInternal::ForEachArrayElement(ArrayProp, StructData, [ASC, &OutGrantedHandles](const FProperty* Inner, const void* ElemPtr)
 	{
-		void* ElemPtr = Helper.GetRawPtr(i);
-
-		UClass* AbilityClass = nullptr;
-
-		if (FClassProperty* ClassProp = CastField<FClassProperty>(Inner))
-		{
-			AbilityClass = Cast<UClass>(ClassProp->GetPropertyValue(ElemPtr));
-		}
-		else if (FSoftClassProperty* SoftClassProp = CastField<FSoftClassProperty>(Inner))
-		{
-			const FSoftObjectPtr Soft = SoftClassProp->GetPropertyValue(ElemPtr);
-			AbilityClass = Cast<UClass>(Soft.LoadSynchronous());
-		}
-
-		TSubclassOf<UGameplayAbility> AbilityGA = AbilityClass;
-		if (!AbilityGA) continue;
+		TSubclassOf<UGameplayAbility> AbilityGA = Cast<UClass>(ARLoadoutPlanInternal::ResolveObjectValue(Inner, ElemPtr));
+		if (!AbilityGA) return;
 
 		FGameplayAbilitySpec Spec(AbilityGA, 1);
 		OutGrantedHandles.Add(ASC->GiveAbility(Spec));
-	}
+	});
 }
 
-static void ApplyEffectArrayFromStruct(
+static void ApplyEffectArrayFromPlan(
 	UAbilitySystemComponent* ASC,
-	const UScriptStruct* StructType,
+	const FArrayProperty* ArrayProp,
 	const void* StructData,
-	FName ArrayPropName,
 	TArray<FActiveGameplayEffectHandle>& OutAppliedHandles
 )
 {
-	if (!ASC || !StructType || !StructData) return;
-
-	FProperty* P = AARPlayerCharacterInvader::FindPropertyByNamePrefix(StructType, ArrayPropName.ToString());
-	FArrayProperty* ArrayProp = CastField<FArrayProperty>(P);
-	if (!ArrayProp) return;
-
-	FProperty* Inner = ArrayProp->Inner;
-	if (!Inner) return;
-
-	FScriptArrayHelper Helper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(StructData));
-	const int32 Num = Helper.Num();
+	if (!ASC) return;
 
-	for (int32 i = 0; i < Num; ++i)
+	ARLoadoutPlanInternal::ForEachArrayElement(ArrayProp, StructData, [ASC, &OutAppliedHandles](const FProperty* Inner, const void* ElemPtr)
 	{
-		void* ElemPtr = Helper.GetRawPtr(i);
-
-		UClass* EffectClass = nullptr;
-
-		if (FClassProperty* ClassProp = CastField<FClassProperty>(Inner))
-		{
-			EffectClass = Cast<UClass>(ClassProp->GetPropertyValue(ElemPtr));
-		}
-		else if (FSoftClassProperty* SoftClassProp = CastField<FSoftClassProperty>(Inner))
-		{
-			const FSoftObjectPtr Soft = SoftClassProp->GetPropertyValue(ElemPtr);
-			EffectClass = Cast<UClass>(Soft.LoadSynchronous());
-		}
-
-		TSubclassOf<UGameplayEffect> EffectGE = EffectClass;
-		if (!EffectGE) continue;
+		TSubclassOf<UGameplayEffect> EffectGE = Cast<UClass>(ARLoadoutPlanInternal::ResolveObjectValue(Inner, ElemPtr));
+		if (!EffectGE) return;
 
 		const FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
 		const FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(EffectGE, 1.0f, Ctx);
@@ -459,54 +501,7 @@ static void ApplyEffectArrayFromStruct(
 		{
 			OutAppliedHandles.Add(ASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get()));
 		}
-	}
-}
-
-static void AppendTagContainerFromStruct(const UScriptStruct* StructType, const void* StructData, FName PropName, FGameplayTagContainer& OutTags)
-{
-	if (!StructType || !StructData) return;
-
-	FProperty* P = AARPlayerCharacterInvader::FindPropertyByNamePrefix(StructType, PropName.ToString());
-	FStructProperty* SP = CastField<FStructProperty>(P);
-	if (!SP) return;
-
-	if (SP->Struct != FGameplayTagContainer::StaticStruct())
-	{
-		return;
-	}
-
-	const void* TagsPtr = SP->ContainerPtrToValuePtr<void>(StructData);
-	const FGameplayTagContainer* TagContainer = reinterpret_cast<const FGameplayTagContainer*>(TagsPtr);
-	if (TagContainer)
-	{
-		OutTags.AppendTags(*TagContainer);
-	}
-}
-
-static bool ExtractGameplayTagFromStruct(const UScriptStruct* StructType, const void* StructData, FName PropName, FGameplayTag& OutTag)
-{
-	OutTag = FGameplayTag();
-
-	if (!StructType || !StructData) return false;
-
-	FProperty* P = AARPlayerCharacterInvader::FindPropertyByNamePrefix(StructType, PropName.ToString());
-	FStructProperty* SP = CastField<FStructProperty>(P);
-	if (!SP) return false;
-
-	if (SP->Struct != FGameplayTag::StaticStruct())
-	{
-		return false;
-	}
-
-	const void* TagPtr = SP->ContainerPtrToValuePtr<void>(StructData);
-	const FGameplayTag* Tag = reinterpret_cast<const FGameplayTag*>(TagPtr);
-	if (Tag && Tag->IsValid())
-	{
-		OutTag = *Tag;
-		return true;
-	}
-
-	return false;
+	});
 }
 
 // --------------------
@@ -565,6 +560,7 @@ void AARPlayerCharacterInvader::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 	ApplyInvaderGravityFrameFromSettings();
+	LoadoutRowPlans.Reset();
 
 	InitAbilityActorInfo();
 
@@ -584,24 +580,24 @@ void AARPlayerCharacterInvader::PossessedBy(AController* NewController)
 	}
 
 	bServerLoadoutApplied = false;
-	LoadoutInitRetryCount = 0;
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(LoadoutInitRetryTimer);
-	}
+	bServerLoadoutRequested = true;
+	CancelPendingServerLoadout();
+	StopServerLoadoutRetries();
+	LoadoutRetryCount = 0;
 
 	ClearAppliedLoadout();
 	GrantCommonAbilitySetFromController(ARPC);
-	if (!TryApplyServerLoadoutFromPlayerState(true))
-	{
-		RetryServerLoadoutInit();
-	}
+
+	// Until the loadout applies, every loadout change on the player state is a new attempt.
+	BindLoadoutReadiness(GetPlayerState<AARPlayerStateBase>());
+	RequestServerLoadoutApply(true);
 }
 
 void AARPlayerCharacterInvader::OnRep_PlayerState()
 {
 	Super::OnRep_PlayerState();
 	ApplyInvaderGravityFrameFromSettings();
+	LoadoutRowPlans.Reset();
 	InitAbilityActorInfo();
 }
 
@@ -640,6 +636,11 @@ void AARPlayerCharacterInvader::InitAbilityActorInfo()
 	ARPlayerCharacterInvaderLocal::SyncLegacyASCProperty(this, ASC);
 	ApplyOrRefreshPrimaryWeaponRuntimeEffects();
 
+	// A PlayerState/ASC that arrives after possession unblocks a deferred loadout.
+	if (HasAuthority() && bServerLoadoutRequested && !bServerLoadoutApplied)
+	{
+		RequestServerLoadoutApply(false);
+	}
 }
 
 void AARPlayerCharacterInvader::EnsureDefaultPickupRadiusOnASC(UAbilitySystemComponent* ASC)
@@ -734,11 +735,11 @@ void AARPlayerCharacterInvader::UnPossessed()
 	CachedASC = nullptr;
 	ARPlayerCharacterInvaderLocal::SyncLegacyASCProperty(this, nullptr);
 	bServerLoadoutApplied = false;
-	LoadoutInitRetryCount = 0;
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(LoadoutInitRetryTimer);
-	}
+	bServerLoadoutRequested = false;
+	CancelPendingServerLoadout();
+	StopServerLoadoutRetries();
+	BindLoadoutReadiness(nullptr);
+	LoadoutRowPlans.Reset();
 
 	if (HasAuthority())
 	{
@@ -811,25 +812,77 @@ void AARPlayerCharacterInvader::ApplyInvaderGravityFrameFromSettings()
 	MoveComp->SetGravityDirection(GravityDir);
 }
 
-bool AARPlayerCharacterInvader::TryApplyServerLoadoutFromPlayerState(bool bLogErrors)
+bool AARPlayerCharacterInvader::RequestServerLoadoutApply(bool bLogErrors)
 {
 	if (!HasAuthority() || bServerLoadoutApplied)
 	{
 		return bServerLoadoutApplied;
 	}
 
+	// No loadout-tag change will fix a missing PlayerState or ASC; retry on ASC init or the fallback timer.
+	const AARPlayerStateBase* PS = GetPlayerState<AARPlayerStateBase>();
+	if (!PS || !PS->GetAbilitySystemComponent())
+	{
+		if (bLogErrors)
+		{
+			UE_LOG(ARLog, Warning, TEXT("[ShipGAS] Deferred init: PlayerState/ASC unavailable; retrying."));
+		}
+		ScheduleServerLoadoutRetry();
+		return false;
+	}
+
 	FGameplayTagContainer LoadoutTags;
 	if (!GetPlayerLoadoutTags(LoadoutTags) || LoadoutTags.IsEmpty())
 	{
 		if (bLogErrors)
 		{
-			UE_LOG(ARLog, Warning, TEXT("[ShipGAS] Deferred init: LoadoutTags unavailable/empty; retrying."));
+			UE_LOG(ARLog, Warning, TEXT("[ShipGAS] Deferred init: LoadoutTags unavailable/empty; waiting for loadout change."));
 		}
 		return false;
 	}
 
-	UE_LOG(ARLog, Verbose, TEXT("[ShipGAS] Possess: applying %d loadout tags."), LoadoutTags.Num());
-	ApplyLoadoutTagsToASC(LoadoutTags);
+	TArray<FInstancedStruct> Rows;
+	if (!ResolveServerLoadoutRows(LoadoutTags, Rows, bLogErrors))
+	{
+		// The ship row may only be missing until content lookup warms up or its routes register.
+		ScheduleServerLoadoutRetry();
+		return false;
+	}
+
+	// Soft references in the rows stream in before anything is granted, so apply never stalls on a sync load.
+	TArray<FSoftObjectPath> PendingAssets;
+	for (const FInstancedStruct& Row : Rows)
+	{
+		ARLoadoutPlanInternal::CollectUnloadedAssets(*FindOrCompileLoadoutRowPlan(*Row.GetScriptStruct()), Row.GetMemory(), PendingAssets);
+	}
+
+	CancelPendingServerLoadout();
+	if (PendingAssets.IsEmpty())
+	{
+		ApplyServerLoadoutRows(LoadoutTags, Rows);
+		return true;
+	}
+
+	UE_LOG(ARLog, Verbose, TEXT("[ShipGAS] Streaming %d loadout assets before apply."), PendingAssets.Num());
+	const uint32 RequestSerial = LoadoutRequestSerial;
+	LoadoutPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		PendingAssets,
+		FStreamableDelegate::CreateWeakLambda(this, [this, RequestSerial, LoadoutTags, Rows = MoveTemp(Rows)]()
+		{
+			// A newer request or an unpossess supersedes this one.
+			if (RequestSerial != LoadoutRequestSerial || bServerLoadoutApplied)
+			{
+				return;
+			}
+			ApplyServerLoadoutRows(LoadoutTags, Rows);
+		}),
+		FStreamableManager::AsyncLoadHighPriority);
+	return true;
+}
+
+bool AARPlayerCharacterInvader::ResolveServerLoadoutRows(const FGameplayTagContainer& LoadoutTags, TArray<FInstancedStruct>& OutRows, bool bLogErrors) const
+{
+	OutRows.Reset();
 
 	// Ship baseline is required.
 	FGameplayTag ShipTag;
@@ -851,17 +904,17 @@ bool AARPlayerCharacterInvader::TryApplyServerLoadoutFromPlayerState(bool bLogEr
 		return false;
 	}
 
-	FInstancedStruct ShipRow;
+	FInstancedStruct& ShipRow = OutRows.AddDefaulted_GetRef();
 	FString Error;
-	if (!ResolveRowFromTag(ShipTag, ShipRow, Error))
+	if (!ResolveRowFromTag(ShipTag, ShipRow, Error) || !ShipRow.IsValid())
 	{
 		if (bLogErrors)
 		{
 			UE_LOG(ARLog, Warning, TEXT("[ShipGAS] Deferred init: could not resolve ship row for '%s'. %s"), *ShipTag.ToString(), *Error);
 		}
+		OutRows.Reset();
 		return false;
 	}
-	ApplyResolvedRowBaseline(ShipRow);
 
 	// Secondary (optional legacy lane; never required for loadout init).
 	FGameplayTag SecondaryTag;
@@ -878,60 +931,163 @@ bool AARPlayerCharacterInvader::TryApplyServerLoadoutFromPlayerState(bool bLogEr
 	{
 		FInstancedStruct SecondaryRow;
 		FString SecondaryError;
-		if (ResolveRowFromTag(SecondaryTag, SecondaryRow, SecondaryError))
+		if (ResolveRowFromTag(SecondaryTag, SecondaryRow, SecondaryError) && SecondaryRow.IsValid())
 		{
-			ApplyResolvedRowBaseline(SecondaryRow);
+			OutRows.Add(MoveTemp(SecondaryRow));
 		}
 	}
 
 	// Hat (optional).
 	FGameplayTag HatTag;
-	const bool bFoundHatTag = FindFirstTagUnderRoot(LoadoutTags, GetTagRootHats(), HatTag);
-	if (bFoundHatTag)
+	if (FindFirstTagUnderRoot(LoadoutTags, GetTagRootHats(), HatTag))
 	{
 		FInstancedStruct HatRow;
 		FString HatError;
-		if (ResolveRowFromTag(HatTag, HatRow, HatError))
+		if (ResolveRowFromTag(HatTag, HatRow, HatError) && HatRow.IsValid())
 		{
-			ApplyResolvedRowBaseline(HatRow);
+			OutRows.Add(MoveTemp(HatRow));
 		}
 	}
 
+	return true;
+}
+
+void AARPlayerCharacterInvader::ApplyServerLoadoutRows(const FGameplayTagContainer& LoadoutTags, const TArray<FInstancedStruct>& Rows)
+{
+	LoadoutPreloadHandle.Reset();
+
+	UE_LOG(ARLog, Verbose, TEXT("[ShipGAS] Possess: applying %d loadout tags."), LoadoutTags.Num());
+	ApplyLoadoutTagsToASC(LoadoutTags);
+	for (const FInstancedStruct& Row : Rows)
+	{
+		ApplyResolvedRowBaseline(Row);
+	}
+
 	ApplyOrRefreshPrimaryWeaponRuntimeEffects();
 	bServerLoadoutApplied = true;
-	if (UWorld* World = GetWorld())
+	BindLoadoutReadiness(nullptr);
+	StopServerLoadoutRetries();
+}
+
+void AARPlayerCharacterInvader::BindLoadoutReadiness(AARPlayerStateBase* PlayerStateToWatch)
+{
+	AARPlayerStateBase* Current = LoadoutReadinessSource.Get();
+	if (Current == PlayerStateToWatch)
 	{
-		World->GetTimerManager().ClearTimer(LoadoutInitRetryTimer);
+		return;
+	}
+
+	if (Current)
+	{
+		Current->OnLoadoutTagsChanged.RemoveDynamic(this, &AARPlayerCharacterInvader::HandleLoadoutTagsChanged);
+	}
+
+	LoadoutReadinessSource = PlayerStateToWatch;
+	if (PlayerStateToWatch)
+	{
+		PlayerStateToWatch->OnLoadoutTagsChanged.AddUniqueDynamic(this, &AARPlayerCharacterInvader::HandleLoadoutTagsChanged);
 	}
-	return true;
 }
 
-void AARPlayerCharacterInvader::RetryServerLoadoutInit()
+void AARPlayerCharacterInvader::CancelPendingServerLoadout()
 {
-	if (!HasAuthority())
+	++LoadoutRequestSerial;
+	if (LoadoutPreloadHandle.IsValid())
+	{
+		LoadoutPreloadHandle->CancelHandle();
+		LoadoutPreloadHandle.Reset();
+	}
+}
+
+void AARPlayerCharacterInvader::ScheduleServerLoadoutRetry()
+{
+	UWorld* World = GetWorld();
+	if (!HasAuthority() || !bServerLoadoutRequested || bServerLoadoutApplied || !World)
+	{
+		return;
+	}
+
+	// Rows still streaming in: warmup completion is the retry.
+	UGameInstance* GI = World->GetGameInstance();
+	UContentLookupSubsystem* Lookup = GI ? GI->GetSubsystem<UContentLookupSubsystem>() : nullptr;
+	if (Lookup && !Lookup->IsWarmupComplete())
+	{
+		if (LoadoutWarmupSource.Get() != Lookup)
+		{
+			StopServerLoadoutRetries();
+			LoadoutWarmupSource = Lookup;
+			Lookup->OnWarmupCompleted.AddUniqueDynamic(this, &AARPlayerCharacterInvader::HandleContentWarmupCompleted);
+		}
+		return;
+	}
+
+	if (World->GetTimerManager().IsTimerActive(LoadoutRetryTimerHandle))
 	{
 		return;
 	}
 
-	++LoadoutInitRetryCount;
-	if (LoadoutInitRetryCount > 120)
+	if (LoadoutRetryCount >= ARPlayerCharacterInvaderLocal::MaxServerLoadoutRetries)
 	{
-		UE_LOG(ARLog, Error, TEXT("[ShipGAS] Deferred init failed after %d retries."), LoadoutInitRetryCount - 1);
+		UE_LOG(ARLog, Error, TEXT("[ShipGAS] Loadout still unresolved after %d retries; waiting for a loadout change or ASC init."),
+			LoadoutRetryCount);
 		return;
 	}
 
+	++LoadoutRetryCount;
+	World->GetTimerManager().SetTimer(
+		LoadoutRetryTimerHandle,
+		this,
+		&AARPlayerCharacterInvader::HandleServerLoadoutRetryTimer,
+		ARPlayerCharacterInvaderLocal::ServerLoadoutRetrySeconds,
+		false);
+}
+
+void AARPlayerCharacterInvader::StopServerLoadoutRetries()
+{
 	if (UWorld* World = GetWorld())
 	{
-		FTimerDelegate RetryDelegate;
-		RetryDelegate.BindWeakLambda(this, [this]()
-		{
-			if (!TryApplyServerLoadoutFromPlayerState(false))
-			{
-				RetryServerLoadoutInit();
-			}
-		});
+		World->GetTimerManager().ClearTimer(LoadoutRetryTimerHandle);
+	}
 
-		World->GetTimerManager().SetTimer(LoadoutInitRetryTimer, RetryDelegate, 0.25f, false);
+	if (UContentLookupSubsystem* Lookup = LoadoutWarmupSource.Get())
+	{
+		Lookup->OnWarmupCompleted.RemoveDynamic(this, &AARPlayerCharacterInvader::HandleContentWarmupCompleted);
+	}
+	LoadoutWarmupSource.Reset();
+}
+
+void AARPlayerCharacterInvader::HandleServerLoadoutRetryTimer()
+{
+	if (!bServerLoadoutApplied)
+	{
+		// Log the reason on the last attempt only.
+		RequestServerLoadoutApply(LoadoutRetryCount >= ARPlayerCharacterInvaderLocal::MaxServerLoadoutRetries);
+	}
+}
+
+void AARPlayerCharacterInvader::HandleContentWarmupCompleted()
+{
+	StopServerLoadoutRetries();
+	if (!bServerLoadoutApplied)
+	{
+		RequestServerLoadoutApply(true);
+	}
+}
+
+void AARPlayerCharacterInvader::HandleLoadoutTagsChanged(
+	AARPlayerStateBase* SourcePlayerState,
+	EARPlayerSlot SourcePlayerSlot,
+	const FGameplayTagContainer& NewLoadoutTags,
+	const FGameplayTagContainer& OldLoadoutTags)
+{
+	(void)SourcePlayerState;
+	(void)SourcePlayerSlot;
+	(void)NewLoadoutTags;
+	(void)OldLoadoutTags;
+
+	if (!bServerLoadoutApplied)
+	{
+		RequestServerLoadoutApply(false);
 	}
 }
 
@@ -947,6 +1103,7 @@ void AARPlayerCharacterInvader::GrantCommonAbilitySetFromController(AController*
 	if (!ASC) return;
 
 	GrantAbilitySet(ASC, Set, GrantedAbilityHandles, AppliedEffectHandles);
+	AbilityTagIndex.MarkDirty();
 }
 
 // --------------------
@@ -967,9 +1124,14 @@ void AARPlayerCharacterInvader::ApplyResolvedRowBaseline(const FInstancedStruct&
 	const void* StructData = RowStruct.GetMemory();
 	if (!StructType || !StructData) return;
 	UE_LOG(ARLog, Verbose, TEXT("[ShipGAS] Applying loadout row baseline from struct '%s'."), *StructType->GetName());
+
+	using namespace ARLoadoutPlanInternal;
+	// Held by value: granting abilities runs Blueprint code that can compile further plans.
+	const TSharedRef<const FARLoadoutRowPlan> Plan = FindOrCompileLoadoutRowPlan(*StructType);
+
 	// Stats effect (optional)
 	{
-		TSubclassOf<UGameplayEffect> StatsGE = ExtractEffectClass(StructType, StructData, NAME_Stats);
+		TSubclassOf<UGameplayEffect> StatsGE = Cast<UClass>(ResolveObjectValue(Plan->Stats, FieldValue(Plan->Stats, StructData)));
 		if (StatsGE)
 		{
 			const FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
@@ -984,7 +1146,7 @@ void AARPlayerCharacterInvader::ApplyResolvedRowBaseline(const FInstancedStruct&
 	// Primary weapon (only expected on Ship rows; safe to attempt)
 	if (!CurrentPrimaryWeapon)
 	{
-		UARWeaponDefinition* WeaponDef = ExtractWeaponDef(StructType, StructData, NAME_PrimaryWeapon);
+		UARWeaponDefinition* WeaponDef = Cast<UARWeaponDefinition>(ResolveObjectValue(Plan->PrimaryWeapon, FieldValue(Plan->PrimaryWeapon, StructData)));
 		if (WeaponDef)
 		{
 			CurrentPrimaryWeapon = WeaponDef;
@@ -992,28 +1154,27 @@ void AARPlayerCharacterInvader::ApplyResolvedRowBaseline(const FInstancedStruct&
 	}
 
 	// Startup abilities/effects
-	GrantAbilityArrayFromStruct(ASC, StructType, StructData, NAME_StartupAbilities, GrantedAbilityHandles);
-	ApplyEffectArrayFromStruct(ASC, StructType, StructData, NAME_StartupEffects, AppliedEffectHandles);
+	GrantAbilityArrayFromPlan(ASC, Plan->StartupAbilities, StructData, GrantedAbilityHandles);
+	AbilityTagIndex.MarkDirty();
+	ApplyEffectArrayFromPlan(ASC, Plan->StartupEffects, StructData, AppliedEffectHandles);
 
 	// Loose tags (ShipTags field)
+	if (const FGameplayTagContainer* LooseTags = static_cast<const FGameplayTagContainer*>(FieldValue(Plan->ShipTags, StructData)))
 	{
-		FGameplayTagContainer LooseTags;
-		AppendTagContainerFromStruct(StructType, StructData, NAME_ShipTags, LooseTags);
-
-		if (!LooseTags.IsEmpty())
+		if (!LooseTags->IsEmpty())
 		{
-			ARPlayerCharacterInvaderLocal::AddRuntimeTags(ASC, LooseTags, HasAuthority());
-			AppliedLooseTags.AppendTags(LooseTags);
+			ARPlayerCharacterInvaderLocal::AddRuntimeTags(ASC, *LooseTags, HasAuthority());
+			AppliedLooseTags.AppendTags(*LooseTags);
 		}
 	}
 
 	// MovementType tag (optional)
+	if (const FGameplayTag* MovementTag = static_cast<const FGameplayTag*>(FieldValue(Plan->MovementType, StructData)))
 	{
-		FGameplayTag MovementTag;
-		if (ExtractGameplayTagFromStruct(StructType, StructData, NAME_MovementType, MovementTag))
+		if (MovementTag->IsValid())
 		{
 			FGameplayTagContainer MoveTags;
-			MoveTags.AddTag(MovementTag);
+			MoveTags.AddTag(*MovementTag);
 			ARPlayerCharacterInvaderLocal::AddRuntimeTags(ASC, MoveTags, HasAuthority());
 			AppliedLooseTags.AppendTags(MoveTags);
 		}
@@ -1039,6 +1200,7 @@ void AARPlayerCharacterInvader::ClearAppliedLoadout()
 		}
 	}
 	GrantedAbilityHandles.Reset();
+	AbilityTagIndex.MarkDirty();
 
 	for (const FActiveGameplayEffectHandle& Handle : AppliedEffectHandles)
 	{
@@ -1136,98 +1298,153 @@ bool AARPlayerCharacterInvader::ResolveRowFromTag(FGameplayTag Tag, FInstancedSt
 // Activation: pick ONE ability deterministically
 // --------------------
 
-bool AARPlayerCharacterInvader::SpecMatchesAnyTag(const FGameplayAbilitySpec& Spec, const FGameplayTagContainer& InTagsToMatch, int32& OutBestScore)
+void FARAbilityTagIndex::Reset()
 {
-	OutBestScore = 0;
+	IndexedASC.Reset();
+	IndexedSpecs.Reset();
+	EntriesByTag.Reset();
+	bDirty = true;
+}
 
-	UGameplayAbility* AbilityCDO = Spec.Ability;
-	if (!AbilityCDO) return false;
+void FARAbilityTagIndex::SyncWith(const UAbilitySystemComponent& ASC)
+{
+	if (bDirty || IndexedASC.Get() != &ASC || IsStale(ASC))
+	{
+		Rebuild(ASC);
+	}
+}
 
-	// Gather tags from:
-	// 1) Ability's declared asset tags
-	// 2) Spec's dynamic source tags (grant-time injected tags)
-	const FGameplayTagContainer& AbilityTags = AbilityCDO->GetAssetTags();
-	const FGameplayTagContainer& SpecTags = Spec.GetDynamicSpecSourceTags();
+bool FARAbilityTagIndex::IsStale(const UAbilitySystemComponent& ASC) const
+{
+	const TArray<FGameplayAbilitySpec>& Specs = ASC.GetActivatableAbilities();
+	if (Specs.Num() != IndexedSpecs.Num())
+	{
+		return true;
+	}
 
-	// Scoring:
-	// - exact match => +100
-	// - parent match => +10
-	// (we take the best score across all provided tags)
-	int32 Best = 0;
-	bool bAny = false;
+	for (int32 SpecIndex = 0; SpecIndex < Specs.Num(); ++SpecIndex)
+	{
+		if (Specs[SpecIndex].Handle != IndexedSpecs[SpecIndex].Key || Specs[SpecIndex].Level != IndexedSpecs[SpecIndex].Value)
+		{
+			return true;
+		}
+	}
+	return false;
+}
 
-	for (const FGameplayTag& Query : InTagsToMatch)
+void FARAbilityTagIndex::Rebuild(const UAbilitySystemComponent& ASC)
+{
+	IndexedASC = &ASC;
+	IndexedSpecs.Reset();
+	EntriesByTag.Reset();
+	bDirty = false;
+
+	const TArray<FGameplayAbilitySpec>& Specs = ASC.GetActivatableAbilities();
+	IndexedSpecs.Reserve(Specs.Num());
+
+	TMap<FGameplayTag, int32> SpecScores;
+	for (int32 SpecIndex = 0; SpecIndex < Specs.Num(); ++SpecIndex)
 	{
-		if (!Query.IsValid()) continue;
+		const FGameplayAbilitySpec& Spec = Specs[SpecIndex];
+		IndexedSpecs.Emplace(Spec.Handle, Spec.Level);
 
-		if (AbilityTags.HasTagExact(Query) || SpecTags.HasTagExact(Query))
+		const UGameplayAbility* AbilityCDO = Spec.Ability;
+		if (!AbilityCDO)
 		{
-			Best = FMath::Max(Best, 100);
-			bAny = true;
 			continue;
 		}
 
-		// Parent match: query is a parent of some ability tag
-		if (AbilityTags.HasTag(Query) || SpecTags.HasTag(Query))
+		// Ability asset tags plus grant-time (dynamic source) tags, matched like FGameplayTagContainer::HasTag:
+		// the tag itself exactly, each of its parents as a parent match.
+		SpecScores.Reset();
+		auto IndexTags = [&SpecScores](const FGameplayTagContainer& Tags)
 		{
-			Best = FMath::Max(Best, 10);
-			bAny = true;
-			continue;
+			for (const FGameplayTag& Tag : Tags)
+			{
+				SpecScores.FindOrAdd(Tag) = ExactMatchScore;
+				for (FGameplayTag Parent = Tag.RequestDirectParent(); Parent.IsValid(); Parent = Parent.RequestDirectParent())
+				{
+					int32& Score = SpecScores.FindOrAdd(Parent);
+					Score = FMath::Max(Score, ParentMatchScore);
+				}
+			}
+		};
+		IndexTags(AbilityCDO->GetAssetTags());
+		IndexTags(Spec.GetDynamicSpecSourceTags());
+
+		for (const TPair<FGameplayTag, int32>& Pair : SpecScores)
+		{
+			FEntry& Entry = EntriesByTag.FindOrAdd(Pair.Key).AddDefaulted_GetRef();
+			Entry.Handle = Spec.Handle;
+			Entry.Score = Pair.Value;
+			Entry.Level = Spec.Level;
+			Entry.SpecIndex = SpecIndex;
 		}
 	}
-
-	OutBestScore = Best;
-	return bAny;
 }
 
-bool AARPlayerCharacterInvader::PickBestMatchingAbilityHandle(
-	UAbilitySystemComponent* ASC,
-	const FGameplayTagContainer& InTagsToMatch,
-	FGameplayAbilitySpecHandle& OutHandle
-)
+bool FARAbilityTagIndex::PickBest(const FGameplayTagContainer& InTagsToMatch, FGameplayAbilitySpecHandle& OutHandle) const
 {
 	OutHandle = FGameplayAbilitySpecHandle();
 
-	if (!ASC || InTagsToMatch.IsEmpty())
-	{
-		return false;
-	}
-
-	int32 BestScore = -1;
-	int32 BestLevel = -1;
-	// Use array index for deterministic tie-breaking instead of private Handle value
-	int32 BestIndex = -1;
-
-	const TArray<FGameplayAbilitySpec>& ActivatableAbilities = ASC->GetActivatableAbilities();
-
-	for (int32 i = 0; i < ActivatableAbilities.Num(); ++i)
+	const FEntry* Best = nullptr;
+	for (const FGameplayTag& Query : InTagsToMatch)
 	{
-		const FGameplayAbilitySpec& Spec = ActivatableAbilities[i];
-
-		int32 Score = 0;
-		if (!SpecMatchesAnyTag(Spec, InTagsToMatch, Score))
+		const TArray<FEntry>* Entries = EntriesByTag.Find(Query);
+		if (!Entries)
 		{
 			continue;
 		}
 
 		// Prefer higher score, then higher level, then lower index for deterministic tie-break.
-		const int32 Level = Spec.Level;
+		for (const FEntry& Entry : *Entries)
+		{
+			const bool bBetter = !Best
+				|| Entry.Score > Best->Score
+				|| (Entry.Score == Best->Score && Entry.Level > Best->Level)
+				|| (Entry.Score == Best->Score && Entry.Level == Best->Level && Entry.SpecIndex < Best->SpecIndex);
+			if (bBetter)
+			{
+				Best = &Entry;
+			}
+		}
+	}
 
-		const bool bBetter =
-			(Score > BestScore) ||
-			(Score == BestScore && Level > BestLevel) ||
-			(Score == BestScore && Level == BestLevel && (BestIndex < 0 || i < BestIndex));
+	if (Best)
+	{
+		OutHandle = Best->Handle;
+	}
+	return OutHandle.IsValid();
+}
 
-		if (bBetter)
+void FARAbilityTagIndex::CollectMatches(const FGameplayTag& Tag, TArray<FGameplayAbilitySpecHandle>& OutHandles) const
+{
+	OutHandles.Reset();
+	if (const TArray<FEntry>* Entries = EntriesByTag.Find(Tag))
+	{
+		OutHandles.Reserve(Entries->Num());
+		for (const FEntry& Entry : *Entries)
 		{
-			BestScore = Score;
-			BestLevel = Level;
-			BestIndex = i;
-			OutHandle = Spec.Handle;
+			OutHandles.Add(Entry.Handle);
 		}
 	}
+}
 
-	return OutHandle.IsValid();
+bool AARPlayerCharacterInvader::PickBestMatchingAbilityHandle(
+	UAbilitySystemComponent* ASC,
+	const FGameplayTagContainer& InTagsToMatch,
+	FGameplayAbilitySpecHandle& OutHandle
+)
+{
+	OutHandle = FGameplayAbilitySpecHandle();
+
+	if (!ASC || InTagsToMatch.IsEmpty())
+	{
+		return false;
+	}
+
+	AbilityTagIndex.SyncWith(*ASC);
+	return AbilityTagIndex.PickBest(InTagsToMatch, OutHandle);
 }
 
 bool AARPlayerCharacterInvader::ActivateAbilityByTag(FGameplayTag Tag, bool bAllowRemoteActivation)
@@ -1270,21 +1487,16 @@ int32 AARPlayerCharacterInvader::ActivateAllAbilitiesByTag(FGameplayTag Tag, boo
 	if (!ASC) return 0;
 	if (!Tag.IsValid()) return 0;
 
-	FGameplayTagContainer TagsToMatch;
-	TagsToMatch.AddTag(Tag);
+	AbilityTagIndex.SyncWith(*ASC);
+	TArray<FGameplayAbilitySpecHandle> Handles;
+	AbilityTagIndex.CollectMatches(Tag, Handles);
 
 	int32 ActivatedCount = 0;
 
 	// Activate every matching ability (explicit opt-in; your default should be ActivateAbilityByTag)
-	for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+	for (const FGameplayAbilitySpecHandle& Handle : Handles)
 	{
-		int32 Score = 0;
-		if (!SpecMatchesAnyTag(Spec, TagsToMatch, Score))
-		{
-			continue;
-		}
-
-		if (ASC->TryActivateAbility(Spec.Handle, bAllowRemoteActivation))
+		if (ASC->TryActivateAbility(Handle, bAllowRemoteActivation))
 		{
 			ActivatedCount++;
 		}
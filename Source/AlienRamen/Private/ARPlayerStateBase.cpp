@@ -8,6 +8,7 @@
 #include "AbilitySystemComponent.h"
 #include "ARSaveSubsystem.h"
 #include "GameplayTagUtilities.h"
+#include "Engine/World.h"
 #include "GameFramework/GameStateBase.h"
 #include "Net/UnrealNetwork.h"
 #include "StructSerializable.h"
@@ -121,7 +122,7 @@ void AARPlayerStateBase::SetPlayerSlot(EARPlayerSlot NewSlot)
 	const EARPlayerSlot OldSlot = PlayerSlot;
 	PlayerSlot = NewSlot;
 	OnRep_PlayerSlot(OldSlot);
-	ForceNetUpdate();
+	RequestNetUpdate();
 	EvaluateTravelReadinessAndBroadcast();
 }
 
@@ -183,7 +184,7 @@ void AARPlayerStateBase::SetIsSetupComplete(bool bNewIsSetup)
 	const bool bOldIsSetup = bIsSetup;
 	bIsSetup = bNewIsSetup;
 	OnRep_IsSetup(bOldIsSetup);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 void AARPlayerStateBase::InitializeForFirstSessionJoin()
@@ -438,7 +439,7 @@ void AARPlayerStateBase::ResetInvaderCombo()
 	InvaderComboCount = 0;
 	LastInvaderKillCreditServerTime = -1.0f;
 	OnRep_InvaderComboCount(OldComboCount);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 void AARPlayerStateBase::ReportInvaderKillCredit(EARAffinityColor EnemyColor, const float ServerTimeSeconds, const float ComboTimeoutSeconds)
@@ -462,7 +463,7 @@ void AARPlayerStateBase::ReportInvaderKillCredit(EARAffinityColor EnemyColor, co
 	if (InvaderComboCount != OldComboCount)
 	{
 		OnRep_InvaderComboCount(OldComboCount);
-		ForceNetUpdate();
+		RequestNetUpdate(/*bHighChurn*/ true);
 	}
 }
 
@@ -481,7 +482,7 @@ void AARPlayerStateBase::MarkInvaderUpgradeActivated(FGameplayTag UpgradeTag)
 	const FGameplayTagContainer OldTags = ActivatedInvaderUpgradeTags;
 	ActivatedInvaderUpgradeTags.AddTag(UpgradeTag);
 	OnRep_ActivatedInvaderUpgrades(OldTags);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 void AARPlayerStateBase::ClearActivatedInvaderUpgrades()
@@ -494,7 +495,7 @@ void AARPlayerStateBase::ClearActivatedInvaderUpgrades()
 	const FGameplayTagContainer OldTags = ActivatedInvaderUpgradeTags;
 	ActivatedInvaderUpgradeTags.Reset();
 	OnRep_ActivatedInvaderUpgrades(OldTags);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 bool AARPlayerStateBase::HasActivatedInvaderUpgrade(FGameplayTag UpgradeTag) const
@@ -629,6 +630,9 @@ void AARPlayerStateBase::BeginPlay()
 void AARPlayerStateBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	UnbindTrackedAttributeDelegates();
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickDelegateHandle);
+	PostActorTickDelegateHandle.Reset();
+	bNetUpdatePending = false;
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -717,7 +721,7 @@ void AARPlayerStateBase::SetCharacterPicked_Internal(EARCharacterChoice NewChara
 	CharacterPicked = NewCharacter;
 	SetInvaderPlayerColor_Internal(ResolveDefaultInvaderPlayerColorFromCharacter(NewCharacter));
 	OnRep_CharacterPicked(OldCharacter);
-	ForceNetUpdate();
+	RequestNetUpdate();
 	EvaluateTravelReadinessAndBroadcast();
 }
 
@@ -746,7 +750,7 @@ void AARPlayerStateBase::SetInvaderPlayerColor_Internal(EARAffinityColor NewColo
 	const EARAffinityColor OldColor = InvaderPlayerColor;
 	InvaderPlayerColor = NewColor;
 	OnRep_InvaderPlayerColor(OldColor);
-	ForceNetUpdate();
+	RequestNetUpdate();
 
 	if (NewColor == EARAffinityColor::None || NewColor == EARAffinityColor::White)
 	{
@@ -777,7 +781,7 @@ void AARPlayerStateBase::SetSpiceSharingActive_Internal(const bool bNewIsSharing
 	const bool bOldIsSharing = bIsSharingSpice;
 	bIsSharingSpice = bNewIsSharing;
 	OnRep_IsSharingSpice(bOldIsSharing);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 void AARPlayerStateBase::SetSpicyTrackCursorTier_Internal(int32 NewCursorTier, const bool bForceBroadcast)
@@ -796,7 +800,7 @@ void AARPlayerStateBase::SetSpicyTrackCursorTier_Internal(int32 NewCursorTier, c
 	const int32 OldCursorTier = SpicyTrackCursorTier;
 	SpicyTrackCursorTier = ClampedCursor;
 	OnRep_SpicyTrackCursorTier(OldCursorTier);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 int32 AARPlayerStateBase::ClampSpicyTrackCursorTier(const int32 RequestedCursorTier) const
@@ -873,7 +877,7 @@ void AARPlayerStateBase::SetDisplayName_Internal(const FString& NewDisplayName)
 	DisplayName = SanitizedName;
 	SetPlayerName(DisplayName);
 	OnRep_DisplayName(OldDisplayName);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 void AARPlayerStateBase::SetReady_Internal(bool bNewReady)
@@ -900,7 +904,7 @@ void AARPlayerStateBase::SetReady_Internal(bool bNewReady)
 	const bool bOldReady = bIsReady;
 	bIsReady = bNewReady;
 	OnRep_IsReady(bOldReady);
-	ForceNetUpdate();
+	RequestNetUpdate();
 	EvaluateTravelReadinessAndBroadcast();
 }
 
@@ -920,7 +924,7 @@ void AARPlayerStateBase::SetDowned_Internal(bool bNewDowned)
 	const bool bOldDowned = bIsDowned;
 	bIsDowned = bResolvedDowned;
 	OnRep_IsDowned(bOldDowned);
-	ForceNetUpdate();
+	RequestNetUpdate();
 }
 
 void AARPlayerStateBase::SetDead_Internal(bool bNewDead)
@@ -938,7 +942,7 @@ void AARPlayerStateBase::SetDead_Internal(bool bNewDead)
 	const bool bOldDead = bIsDeadState;
 	bIsDeadState = bNewDead;
 	OnRep_IsDeadState(bOldDead);
-	ForceNetUpdate();
+	RequestNetUpdate();
 
 	if (bIsDeadState && bIsDowned)
 	{
@@ -1064,7 +1068,7 @@ void AARPlayerStateBase::SetLoadoutTags_Internal(const FGameplayTagContainer& Ne
 	const FGameplayTagContainer OldLoadoutTags = LoadoutTags;
 	LoadoutTags = NormalizedTags;
 	OnRep_Loadout(OldLoadoutTags);
-	ForceNetUpdate();
+	RequestNetUpdate();
 
 	// Mark save dirty so autosave can persist new loadout.
 	if (UGameInstance* GI = GetGameInstance())
@@ -1692,6 +1696,49 @@ void AARPlayerStateBase::SetSpiceMeter_Internal(float NewSpiceValue)
 	const float MaxSpice = AbilitySystemComponent->GetNumericAttribute(UARAttributeSetCore::GetMaxSpiceAttribute());
 	const float ClampedValue = FMath::Clamp(NewSpiceValue, 0.f, FMath::Max(0.f, MaxSpice));
 	AbilitySystemComponent->SetNumericAttributeBase(UARAttributeSetCore::GetSpiceAttribute(), ClampedValue);
+	RequestNetUpdate(/*bHighChurn*/ true);
+}
+
+void AARPlayerStateBase::RequestNetUpdate(const bool bHighChurn)
+{
+	UWorld* World = GetWorld();
+	if (!HasAuthority() || !World)
+	{
+		return;
+	}
+
+	if (!PostActorTickDelegateHandle.IsValid())
+	{
+		PostActorTickDelegateHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &AARPlayerStateBase::FlushPendingNetUpdate);
+	}
+
+	bPendingNetUpdateHighChurnOnly = bNetUpdatePending ? (bPendingNetUpdateHighChurnOnly && bHighChurn) : bHighChurn;
+	bNetUpdatePending = true;
+}
+
+void AARPlayerStateBase::FlushPendingNetUpdate(UWorld* TickedWorld, ELevelTick TickType, const float DeltaSeconds)
+{
+	(void)TickType;
+	(void)DeltaSeconds;
+
+	if (!bNetUpdatePending || TickedWorld != GetWorld())
+	{
+		return;
+	}
+
+	// Real time so throttled updates still go out while the game is paused.
+	const double Now = TickedWorld->GetRealTimeSeconds();
+	if (bPendingNetUpdateHighChurnOnly
+		&& LastForcedNetUpdateRealTime >= 0.0
+		&& (Now - LastForcedNetUpdateRealTime) < HighChurnNetUpdateMinInterval)
+	{
+		return;
+	}
+
+	bNetUpdatePending = false;
+	bPendingNetUpdateHighChurnOnly = false;
+	LastForcedNetUpdateRealTime = Now;
+	ForceNetUpdate();
 }
 
 bool AARPlayerStateBase::IsTravelReady() const
@@ -1,12 +1,482 @@
 #include "ARSaveGame.h"
 
+#include "ARLog.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/StructuredArchiveAdapters.h"
+
+namespace ARSaveGameInternal
+{
+	// Marks the section table that follows the tagged property block ("ARSS").
+	static constexpr uint32 SectionTableMagic = 0x41525353;
+	static constexpr uint8 AllSectionsMask = (1u << static_cast<uint8>(EARSaveSection::Count)) - 1u;
+
+	static constexpr uint8 SectionBit(const EARSaveSection Section)
+	{
+		return static_cast<uint8>(1u << static_cast<uint8>(Section));
+	}
+
+	// Only disk/memory save-game archives use the sectioned layout; GC, duplication and undo see plain properties.
+	static bool UsesSectionedLayout(const FArchive& Ar)
+	{
+		return Ar.IsPersistent()
+			&& !Ar.IsObjectReferenceCollector()
+			&& !Ar.IsTransacting()
+			&& !Ar.IsCountingMemory();
+	}
+}
+
 UARSaveGame::UARSaveGame()
 {
 	SaveGameVersion = CurrentSchemaVersion;
+	HydratedSectionMask = ARSaveGameInternal::AllSectionsMask;
+}
+
+void UARSaveGame::Serialize(FArchive& Ar)
+{
+	if (!ARSaveGameInternal::UsesSectionedLayout(Ar) || HasAnyFlags(RF_ClassDefaultObject))
+	{
+		Super::Serialize(Ar);
+		return;
+	}
+
+	SerializeSectioned(Ar);
+}
+
+void UARSaveGame::SerializeSectioned(FArchive& Ar)
+{
+	constexpr int32 SectionCount = static_cast<int32>(EARSaveSection::Count);
+
+	if (Ar.IsSaving())
+	{
+		TArray<uint8> EncodedSections[SectionCount];
+		for (int32 Index = 0; Index < SectionCount; ++Index)
+		{
+			const EARSaveSection Section = static_cast<EARSaveSection>(Index);
+			if (IsSectionHydrated(Section))
+			{
+				EncodeSection(Section, EncodedSections[Index]);
+			}
+			else
+			{
+				EncodedSections[Index] = PendingSectionBytes[Index];
+			}
+		}
+
+		// Detach section arrays so the tagged block skips them (empty arrays match class defaults).
+		TArray<FARPlayerStateSaveData> DetachedPlayerStates = MoveTemp(PlayerStates);
+		TArray<FARNpcRelationshipState> DetachedNpcStates = MoveTemp(NpcRelationshipStates);
+		TArray<FARDialogueCanonicalChoiceState> DetachedChoiceStates = MoveTemp(DialogueCanonicalChoiceStates);
+		TArray<FARPlayerDialogueHistoryState> DetachedHistoryStates = MoveTemp(PlayerDialogueHistoryStates);
+		TArray<FGameplayTag> DetachedDialogueNodeTags = MoveTemp(DialogueNodeTags);
+		TArray<FARFactionRuntimeState> DetachedFactionStates = MoveTemp(FactionPopularityStates);
+
+		Super::Serialize(Ar);
+
+		PlayerStates = MoveTemp(DetachedPlayerStates);
+		NpcRelationshipStates = MoveTemp(DetachedNpcStates);
+		DialogueCanonicalChoiceStates = MoveTemp(DetachedChoiceStates);
+		PlayerDialogueHistoryStates = MoveTemp(DetachedHistoryStates);
+		DialogueNodeTags = MoveTemp(DetachedDialogueNodeTags);
+		FactionPopularityStates = MoveTemp(DetachedFactionStates);
+
+		uint32 Magic = ARSaveGameInternal::SectionTableMagic;
+		int32 StoredSectionCount = SectionCount;
+		Ar << Magic;
+		Ar << StoredSectionCount;
+		for (int32 Index = 0; Index < SectionCount; ++Index)
+		{
+			uint8 SectionId = static_cast<uint8>(Index);
+			Ar << SectionId;
+			Ar << EncodedSections[Index];
+		}
+		return;
+	}
+
+	Super::Serialize(Ar);
+
+	if (Ar.AtEnd())
+	{
+		// Legacy inline layout: every field was already read from the tagged block. SaveGameVersion may have been
+		// omitted as a default-equal value under the old build, so pin it to the layout we actually read.
+		HydratedSectionMask = ARSaveGameInternal::AllSectionsMask;
+		if (SaveGameVersion > LegacyInlineSchemaVersion)
+		{
+			SaveGameVersion = LegacyInlineSchemaVersion;
+		}
+		CompactDialogueHistory();
+		return;
+	}
+
+	uint32 Magic = 0;
+	Ar << Magic;
+	if (Magic != ARSaveGameInternal::SectionTableMagic)
+	{
+		UE_LOG(ARLog, Warning, TEXT("[SaveGame] '%s' has an unrecognized section table; treating as corrupt."), *GetNameSafe(this));
+		Ar.SetError();
+		return;
+	}
+
+	int32 StoredSectionCount = 0;
+	Ar << StoredSectionCount;
+	for (int32 Stored = 0; Stored < StoredSectionCount && !Ar.IsError(); ++Stored)
+	{
+		uint8 SectionId = 0;
+		TArray<uint8> SectionBytes;
+		Ar << SectionId;
+		Ar << SectionBytes;
+
+		// Sections written by newer builds are skipped rather than failing the load.
+		if (SectionId < SectionCount)
+		{
+			PendingSectionBytes[SectionId] = MoveTemp(SectionBytes);
+			HydratedSectionMask &= ~ARSaveGameInternal::SectionBit(static_cast<EARSaveSection>(SectionId));
+		}
+	}
+}
+
+void UARSaveGame::SerializeSectionProperties(FArchive& Ar, const EARSaveSection Section)
+{
+	FName PropertyNames[3];
+	int32 PropertyCount = 0;
+	switch (Section)
+	{
+	case EARSaveSection::Players:
+		PropertyNames[PropertyCount++] = GET_MEMBER_NAME_CHECKED(UARSaveGame, PlayerStates);
+		break;
+	case EARSaveSection::Dialogue:
+		PropertyNames[PropertyCount++] = GET_MEMBER_NAME_CHECKED(UARSaveGame, NpcRelationshipStates);
+		PropertyNames[PropertyCount++] = GET_MEMBER_NAME_CHECKED(UARSaveGame, DialogueCanonicalChoiceStates);
+		break;
+	case EARSaveSection::DialogueHistory:
+		PropertyNames[PropertyCount++] = GET_MEMBER_NAME_CHECKED(UARSaveGame, DialogueNodeTags);
+		PropertyNames[PropertyCount++] = GET_MEMBER_NAME_CHECKED(UARSaveGame, PlayerDialogueHistoryStates);
+		break;
+	case EARSaveSection::Factions:
+		PropertyNames[PropertyCount++] = GET_MEMBER_NAME_CHECKED(UARSaveGame, FactionPopularityStates);
+		break;
+	default:
+		return;
+	}
+
+	FStructuredArchiveFromArchive Adapter(Ar);
+	FStructuredArchive::FRecord Record = Adapter.GetSlot().EnterRecord();
+	for (int32 Index = 0; Index < PropertyCount; ++Index)
+	{
+		const FProperty* Property = GetClass()->FindPropertyByName(PropertyNames[Index]);
+		if (!ensure(Property))
+		{
+			continue;
+		}
+
+		// Struct elements serialize as tagged properties, so adding fields to row types stays load-compatible.
+		Property->SerializeItem(Record.EnterField(*PropertyNames[Index].ToString()), Property->ContainerPtrToValuePtr<void>(this), nullptr);
+	}
+}
+
+void UARSaveGame::EncodeSection(const EARSaveSection Section, TArray<uint8>& OutBytes) const
+{
+	if (Section == EARSaveSection::DialogueHistory)
+	{
+		// Rows edited through GetMutablePlayerDialogueHistoryStates may still carry legacy tags.
+		const_cast<UARSaveGame*>(this)->CompactDialogueHistory();
+	}
+
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes, true);
+	FObjectAndNameAsStringProxyArchive Proxy(Writer, false);
+	const_cast<UARSaveGame*>(this)->SerializeSectionProperties(Proxy, Section);
+}
+
+void UARSaveGame::HydrateSection(const EARSaveSection Section)
+{
+	if (IsSectionHydrated(Section))
+	{
+		return;
+	}
+
+	TArray<uint8>& Bytes = PendingSectionBytes[static_cast<int32>(Section)];
+	const bool bDecodedFromStorage = Bytes.Num() > 0;
+	if (bDecodedFromStorage)
+	{
+		FMemoryReader Reader(Bytes, true);
+		FObjectAndNameAsStringProxyArchive Proxy(Reader, true);
+		SerializeSectionProperties(Proxy, Section);
+		if (Proxy.IsError())
+		{
+			UE_LOG(ARLog, Warning, TEXT("[SaveGame] Section %d of '%s' failed to deserialize; section reset to empty."),
+				static_cast<int32>(Section), *GetNameSafe(this));
+		}
+	}
+
+	MarkSectionHydrated(Section);
+
+	if (Section == EARSaveSection::Dialogue)
+	{
+		++NpcRelationshipStatesSerial;
+	}
+	else if (Section == EARSaveSection::DialogueHistory)
+	{
+		CompactDialogueHistory();
+	}
+
+	// Stored bytes may come from an older build or a hand-edited file; sanitize them once on the way in.
+	if (bDecodedFromStorage)
+	{
+		int32 ClampedCount = 0;
+		if (Section == EARSaveSection::Players)
+		{
+			ClampedCount = SanitizePlayersSection(nullptr);
+		}
+		else if (Section == EARSaveSection::Dialogue)
+		{
+			ClampedCount = SanitizeDialogueSection(nullptr);
+		}
+
+		if (ClampedCount > 0)
+		{
+			UE_LOG(ARLog, Warning, TEXT("[SaveGame] Section %d of '%s' sanitized on load (%d fields)."),
+				static_cast<int32>(Section), *GetNameSafe(this), ClampedCount);
+		}
+	}
+}
+
+void UARSaveGame::MarkSectionHydrated(const EARSaveSection Section)
+{
+	PendingSectionBytes[static_cast<int32>(Section)].Empty();
+	HydratedSectionMask |= ARSaveGameInternal::SectionBit(Section);
+}
+
+void UARSaveGame::EnsureSectionHydrated(const EARSaveSection Section) const
+{
+	if (!IsSectionHydrated(Section))
+	{
+		// Hydration is logically const: it materializes data the object already owns.
+		const_cast<UARSaveGame*>(this)->HydrateSection(Section);
+	}
+}
+
+bool UARSaveGame::IsSectionHydrated(const EARSaveSection Section) const
+{
+	return (HydratedSectionMask & ARSaveGameInternal::SectionBit(Section)) != 0;
+}
+
+void UARSaveGame::HydrateAllSections()
+{
+	for (int32 Index = 0; Index < static_cast<int32>(EARSaveSection::Count); ++Index)
+	{
+		HydrateSection(static_cast<EARSaveSection>(Index));
+	}
+}
+
+void UARSaveGame::CopySectionsFrom(const UARSaveGame& Source, TConstArrayView<EARSaveSection> Sections)
+{
+	for (const EARSaveSection Section : Sections)
+	{
+		const int32 Index = static_cast<int32>(Section);
+		switch (Section)
+		{
+		case EARSaveSection::Players:
+			PlayerStates = Source.IsSectionHydrated(Section) ? Source.PlayerStates : TArray<FARPlayerStateSaveData>();
+			break;
+		case EARSaveSection::Dialogue:
+			NpcRelationshipStates = Source.IsSectionHydrated(Section) ? Source.NpcRelationshipStates : TArray<FARNpcRelationshipState>();
+			++NpcRelationshipStatesSerial;
+			DialogueCanonicalChoiceStates = Source.IsSectionHydrated(Section) ? Source.DialogueCanonicalChoiceStates : TArray<FARDialogueCanonicalChoiceState>();
+			break;
+		case EARSaveSection::DialogueHistory:
+			PlayerDialogueHistoryStates = Source.IsSectionHydrated(Section) ? Source.PlayerDialogueHistoryStates : TArray<FARPlayerDialogueHistoryState>();
+			DialogueNodeTags = Source.IsSectionHydrated(Section) ? Source.DialogueNodeTags : TArray<FGameplayTag>();
+			DialogueNodeIndexByTag.Reset();
+			IndexedDialogueNodeCount = 0;
+			break;
+		case EARSaveSection::Factions:
+			FactionPopularityStates = Source.IsSectionHydrated(Section) ? Source.FactionPopularityStates : TArray<FARFactionRuntimeState>();
+			break;
+		default:
+			continue;
+		}
+
+		if (Source.IsSectionHydrated(Section))
+		{
+			MarkSectionHydrated(Section);
+		}
+		else
+		{
+			PendingSectionBytes[Index] = Source.PendingSectionBytes[Index];
+			HydratedSectionMask &= ~ARSaveGameInternal::SectionBit(Section);
+		}
+	}
+}
+
+const TArray<FARPlayerStateSaveData>& UARSaveGame::GetPlayerStates() const
+{
+	EnsureSectionHydrated(EARSaveSection::Players);
+	return PlayerStates;
+}
+
+void UARSaveGame::SetPlayerStates(const TArray<FARPlayerStateSaveData>& InPlayerStates)
+{
+	MarkSectionHydrated(EARSaveSection::Players);
+	PlayerStates = InPlayerStates;
+}
+
+TArray<FARPlayerStateSaveData>& UARSaveGame::GetMutablePlayerStates()
+{
+	HydrateSection(EARSaveSection::Players);
+	return PlayerStates;
+}
+
+const TArray<FARNpcRelationshipState>& UARSaveGame::GetNpcRelationshipStates() const
+{
+	EnsureSectionHydrated(EARSaveSection::Dialogue);
+	return NpcRelationshipStates;
+}
+
+void UARSaveGame::SetNpcRelationshipStates(const TArray<FARNpcRelationshipState>& InStates)
+{
+	HydrateSection(EARSaveSection::Dialogue);
+	NpcRelationshipStates = InStates;
+	++NpcRelationshipStatesSerial;
+}
+
+TArray<FARNpcRelationshipState>& UARSaveGame::GetMutableNpcRelationshipStates()
+{
+	HydrateSection(EARSaveSection::Dialogue);
+	return NpcRelationshipStates;
+}
+
+const TArray<FARDialogueCanonicalChoiceState>& UARSaveGame::GetDialogueCanonicalChoiceStates() const
+{
+	EnsureSectionHydrated(EARSaveSection::Dialogue);
+	return DialogueCanonicalChoiceStates;
+}
+
+void UARSaveGame::SetDialogueCanonicalChoiceStates(const TArray<FARDialogueCanonicalChoiceState>& InStates)
+{
+	HydrateSection(EARSaveSection::Dialogue);
+	DialogueCanonicalChoiceStates = InStates;
+}
+
+TArray<FARDialogueCanonicalChoiceState>& UARSaveGame::GetMutableDialogueCanonicalChoiceStates()
+{
+	HydrateSection(EARSaveSection::Dialogue);
+	return DialogueCanonicalChoiceStates;
+}
+
+const TArray<FARPlayerDialogueHistoryState>& UARSaveGame::GetPlayerDialogueHistoryStates() const
+{
+	EnsureSectionHydrated(EARSaveSection::DialogueHistory);
+	return PlayerDialogueHistoryStates;
+}
+
+void UARSaveGame::SetPlayerDialogueHistoryStates(const TArray<FARPlayerDialogueHistoryState>& InStates)
+{
+	// Incoming bitsets index into this save's node table, so keep it (hydrating it if still stored).
+	HydrateSection(EARSaveSection::DialogueHistory);
+	PlayerDialogueHistoryStates = InStates;
+	CompactDialogueHistory();
+}
+
+TArray<FARPlayerDialogueHistoryState>& UARSaveGame::GetMutablePlayerDialogueHistoryStates()
+{
+	HydrateSection(EARSaveSection::DialogueHistory);
+	return PlayerDialogueHistoryStates;
+}
+
+void UARSaveGame::EnsureDialogueNodeLookup() const
+{
+	if (IndexedDialogueNodeCount == DialogueNodeTags.Num())
+	{
+		return;
+	}
+
+	DialogueNodeIndexByTag.Reset();
+	DialogueNodeIndexByTag.Reserve(DialogueNodeTags.Num());
+	for (int32 Index = 0; Index < DialogueNodeTags.Num(); ++Index)
+	{
+		if (DialogueNodeTags[Index].IsValid() && !DialogueNodeIndexByTag.Contains(DialogueNodeTags[Index]))
+		{
+			DialogueNodeIndexByTag.Add(DialogueNodeTags[Index], Index);
+		}
+	}
+	IndexedDialogueNodeCount = DialogueNodeTags.Num();
+}
+
+int32 UARSaveGame::FindDialogueNodeIndex(const FGameplayTag NodeTag) const
+{
+	if (!NodeTag.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	EnsureSectionHydrated(EARSaveSection::DialogueHistory);
+	EnsureDialogueNodeLookup();
+	const int32* Found = DialogueNodeIndexByTag.Find(NodeTag);
+	return Found ? *Found : INDEX_NONE;
+}
+
+int32 UARSaveGame::FindOrAddDialogueNodeIndex(const FGameplayTag NodeTag)
+{
+	const int32 Existing = FindDialogueNodeIndex(NodeTag);
+	if (Existing != INDEX_NONE || !NodeTag.IsValid())
+	{
+		return Existing;
+	}
+
+	const int32 Added = DialogueNodeTags.Add(NodeTag);
+	DialogueNodeIndexByTag.Add(NodeTag, Added);
+	IndexedDialogueNodeCount = DialogueNodeTags.Num();
+	return Added;
+}
+
+int32 UARSaveGame::CompactDialogueHistory()
+{
+	int32 MigratedCount = 0;
+	for (FARPlayerDialogueHistoryState& History : PlayerDialogueHistoryStates)
+	{
+		if (History.SeenNodeTags.IsEmpty())
+		{
+			continue;
+		}
+
+		for (const FGameplayTag NodeTag : History.SeenNodeTags)
+		{
+			History.MarkNodeIndexSeen(FindOrAddDialogueNodeIndex(NodeTag));
+			++MigratedCount;
+		}
+		History.SeenNodeTags.Reset();
+	}
+
+	if (MigratedCount > 0)
+	{
+		UE_LOG(ARLog, Verbose, TEXT("[SaveGame] Compacted %d legacy seen-node tag(s) into history bitsets for '%s'."), MigratedCount, *GetNameSafe(this));
+	}
+	return MigratedCount;
+}
+
+const TArray<FARFactionRuntimeState>& UARSaveGame::GetFactionPopularityStates() const
+{
+	EnsureSectionHydrated(EARSaveSection::Factions);
+	return FactionPopularityStates;
+}
+
+void UARSaveGame::SetFactionPopularityStates(const TArray<FARFactionRuntimeState>& InStates)
+{
+	MarkSectionHydrated(EARSaveSection::Factions);
+	FactionPopularityStates = InStates;
+}
+
+TArray<FARFactionRuntimeState>& UARSaveGame::GetMutableFactionPopularityStates()
+{
+	HydrateSection(EARSaveSection::Factions);
+	return FactionPopularityStates;
 }
 
 bool UARSaveGame::FindPlayerStateDataBySlot(const EARPlayerSlot Slot, FARPlayerStateSaveData& OutData, int32& OutIndex) const
 {
+	EnsureSectionHydrated(EARSaveSection::Players);
 	OutIndex = INDEX_NONE;
 	for (int32 i = 0; i < PlayerStates.Num(); ++i)
 	{
@@ -22,6 +492,7 @@ bool UARSaveGame::FindPlayerStateDataBySlot(const EARPlayerSlot Slot, FARPlayerS
 
 bool UARSaveGame::FindPlayerStateDataByIdentity(const FARPlayerIdentity& Identity, FARPlayerStateSaveData& OutData, int32& OutIndex) const
 {
+	EnsureSectionHydrated(EARSaveSection::Players);
 	OutIndex = INDEX_NONE;
 	int32 FirstIdentityMatchIndex = INDEX_NONE;
 
@@ -56,45 +527,38 @@ bool UARSaveGame::FindPlayerStateDataByIdentity(const FARPlayerIdentity& Identit
 	return false;
 }
 
-int32 UARSaveGame::ValidateAndSanitize(TArray<FString>* OutWarnings)
+int32 UARSaveGame::SanitizePlayersSection(TArray<FString>* OutWarnings)
 {
 	int32 ClampedCount = 0;
-	auto ClampNonNegative = [OutWarnings, &ClampedCount](int32& Value, const TCHAR* FieldName)
+	for (FARPlayerStateSaveData& PlayerData : PlayerStates)
 	{
-		if (Value < 0)
+		if (PlayerData.Identity.LegacyId < 0)
 		{
+			PlayerData.Identity.LegacyId = 0;
+			++ClampedCount;
 			if (OutWarnings)
 			{
-				OutWarnings->Add(FString::Printf(TEXT("%s was negative and clamped to 0."), FieldName));
+				OutWarnings->Add(TEXT("PlayerState.Identity.LegacyId was negative and clamped to 0."));
 			}
-			Value = 0;
-			++ClampedCount;
 		}
-	};
-
-	ClampNonNegative(Money, TEXT("Money"));
-	ClampNonNegative(Scrap, TEXT("Scrap"));
-	ClampNonNegative(Cycles, TEXT("Cycles"));
-	ClampNonNegative(FactionClout, TEXT("FactionClout"));
-	ClampNonNegative(Meat.RedAmount, TEXT("Meat.RedAmount"));
-	ClampNonNegative(Meat.BlueAmount, TEXT("Meat.BlueAmount"));
-	ClampNonNegative(Meat.WhiteAmount, TEXT("Meat.WhiteAmount"));
-	ClampNonNegative(Meat.UnspecifiedAmount, TEXT("Meat.UnspecifiedAmount"));
-
-	for (FARMeatTypeAmount& Entry : Meat.AdditionalAmountsByType)
-	{
-		ClampNonNegative(Entry.Amount, TEXT("Meat.AdditionalAmountsByType.Amount"));
-	}
-	Meat.NormalizeAdditionalAmounts();
-
-	for (FARPlayerStateSaveData& PlayerData : PlayerStates)
-	{
-		ClampNonNegative(PlayerData.Identity.LegacyId, TEXT("PlayerState.Identity.LegacyId"));
 	}
+	return ClampedCount;
+}
 
+int32 UARSaveGame::SanitizeDialogueSection(TArray<FString>* OutWarnings)
+{
+	int32 ClampedCount = 0;
 	for (FARNpcRelationshipState& NpcState : NpcRelationshipStates)
 	{
-		ClampNonNegative(NpcState.LoveRating, TEXT("NpcRelationshipStates.LoveRating"));
+		if (NpcState.LoveRating < 0)
+		{
+			NpcState.LoveRating = 0;
+			++ClampedCount;
+			if (OutWarnings)
+			{
+				OutWarnings->Add(TEXT("NpcRelationshipStates.LoveRating was negative and clamped to 0."));
+			}
+		}
 	}
 
 	for (int32 Index = NpcRelationshipStates.Num() - 1; Index >= 0; --Index)
@@ -102,6 +566,7 @@ int32 UARSaveGame::ValidateAndSanitize(TArray<FString>* OutWarnings)
 		if (!NpcRelationshipStates[Index].NpcTag.IsValid())
 		{
 			NpcRelationshipStates.RemoveAtSwap(Index);
+			++NpcRelationshipStatesSerial;
 			++ClampedCount;
 			if (OutWarnings)
 			{
@@ -141,6 +606,55 @@ int32 UARSaveGame::ValidateAndSanitize(TArray<FString>* OutWarnings)
 		SeenChoiceNodes.Add(NodeTag);
 	}
 
+	return ClampedCount;
+}
+
+int32 UARSaveGame::ValidateAndSanitize(TArray<FString>* OutWarnings)
+{
+	int32 ClampedCount = 0;
+	auto ClampNonNegative = [OutWarnings, &ClampedCount](int32& Value, const TCHAR* FieldName)
+	{
+		if (Value < 0)
+		{
+			if (OutWarnings)
+			{
+				OutWarnings->Add(FString::Printf(TEXT("%s was negative and clamped to 0."), FieldName));
+			}
+			Value = 0;
+			++ClampedCount;
+		}
+	};
+
+	ClampNonNegative(Money, TEXT("Money"));
+	ClampNonNegative(Scrap, TEXT("Scrap"));
+	ClampNonNegative(Cycles, TEXT("Cycles"));
+	ClampNonNegative(FactionClout, TEXT("FactionClout"));
+	ClampNonNegative(Meat.RedAmount, TEXT("Meat.RedAmount"));
+	ClampNonNegative(Meat.BlueAmount, TEXT("Meat.BlueAmount"));
+	ClampNonNegative(Meat.WhiteAmount, TEXT("Meat.WhiteAmount"));
+	ClampNonNegative(Meat.UnspecifiedAmount, TEXT("Meat.UnspecifiedAmount"));
+
+	for (FARMeatTypeAmount& Entry : Meat.AdditionalAmountsByType)
+	{
+		ClampNonNegative(Entry.Amount, TEXT("Meat.AdditionalAmountsByType.Amount"));
+	}
+	Meat.NormalizeAdditionalAmounts();
+
+	// Sections still in stored form are sanitized by HydrateSection when first decoded; only hydrated (possibly
+	// edited since) ones are revisited here.
+	if (IsSectionHydrated(EARSaveSection::Players))
+	{
+		ClampedCount += SanitizePlayersSection(OutWarnings);
+	}
+
+	if (IsSectionHydrated(EARSaveSection::Dialogue))
+	{
+		ClampedCount += SanitizeDialogueSection(OutWarnings);
+	}
+
+	// Factions are always checked: ActiveFactionTag lives in the core block and must stay consistent with them.
+	HydrateSection(EARSaveSection::Factions);
+
 	TSet<FGameplayTag> SeenFactions;
 	for (int32 Index = FactionPopularityStates.Num() - 1; Index >= 0; --Index)
 	{
@@ -9,11 +9,16 @@
 #include "ARSaveIndexGame.h"
 #include "ARSaveUserSettings.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "GameFramework/GameModeBase.h"
 #include "Engine/Engine.h"
 #include "HAL/IConsoleManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/ScopeExit.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "TimerManager.h"
+#include "UObject/UObjectGlobals.h"
 #include "Templates/UnrealTemplate.h"
 #include "StructSerializable.h"
 
@@ -138,10 +143,29 @@ static FARPlayerIdentity BuildPlayerIdentityFromPlayerState(const APlayerState*
 
 void UARSaveSubsystem::Deinitialize()
 {
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle.Reset();
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		GI->GetTimerManager().ClearTimer(DeferredTravelSaveTimerHandle);
+		GI->GetTimerManager().ClearTimer(AutosaveStalenessTimerHandle);
+	}
+	if (ScheduledAutosaveTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ScheduledAutosaveTickerHandle);
+		ScheduledAutosaveTickerHandle.Reset();
+	}
+	if (bDeferredTravelSavePending)
+	{
+		UE_LOG(ARLog, Warning, TEXT("[SaveSubsystem] Deferred travel save dropped on shutdown; state since last write is not persisted."));
+	}
+
 	CurrentSaveGame = nullptr;
 	CurrentSlotBaseName = NAME_None;
 	PendingCanonicalSyncRequests.Reset();
 	PendingTravelGameStateData.Reset();
+	PendingTravelPlayerSnapshots.Reset();
+	bDeferredTravelSavePending = false;
 	Super::Deinitialize();
 }
 
@@ -149,6 +173,7 @@ void UARSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 	ARSaveInternal::EnablePIESeamlessTravelIfNeeded();
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UARSaveSubsystem::HandlePostLoadMapWithWorld);
 }
 
 FName UARSaveSubsystem::NormalizeSlotBaseName(FName SlotBaseName)
@@ -442,13 +467,12 @@ void UARSaveSubsystem::GatherRuntimeData(UARSaveGame* SaveObject)
 		SaveObject->Cycles = CurrentSaveGame->Cycles;
 		SaveObject->ProgressionTags = CurrentSaveGame->ProgressionTags;
 		SaveObject->FactionClout = CurrentSaveGame->FactionClout;
-		SaveObject->FactionPopularityStates = CurrentSaveGame->FactionPopularityStates;
-		SaveObject->NpcRelationshipStates = CurrentSaveGame->NpcRelationshipStates;
-		SaveObject->DialogueCanonicalChoiceStates = CurrentSaveGame->DialogueCanonicalChoiceStates;
-		SaveObject->PlayerDialogueHistoryStates = CurrentSaveGame->PlayerDialogueHistoryStates;
+		// Sections nobody touched this session carry over as stored bytes instead of round-tripping.
+		SaveObject->CopySectionsFrom(*CurrentSaveGame, { EARSaveSection::Dialogue, EARSaveSection::DialogueHistory, EARSaveSection::Factions });
 	}
 
-	SaveObject->PlayerStates.Reset();
+	TArray<FARPlayerStateSaveData>& SavedPlayerStates = SaveObject->GetMutablePlayerStates();
+	SavedPlayerStates.Reset();
 	if (!GS)
 	{
 		UE_LOG(ARLog, Warning, TEXT("[SaveSubsystem] GatherRuntimeData skipped PlayerStates capture: no GameState in world '%s'."), *GetNameSafe(World));
@@ -468,7 +492,26 @@ void UARSaveSubsystem::GatherRuntimeData(UARSaveGame* SaveObject)
 		PlayerData.LoadoutTags = ARPS->LoadoutTags;
 		PlayerData.CharacterPicked = ARPS->GetCharacterPicked();
 
-		SaveObject->PlayerStates.Add(MoveTemp(PlayerData));
+		SavedPlayerStates.Add(MoveTemp(PlayerData));
+	}
+
+	// Players still reconnecting after a non-seamless travel only exist as travel snapshots; keep their rows.
+	for (const FARTravelPlayerSnapshot& Snapshot : PendingTravelPlayerSnapshots)
+	{
+		const bool bAlreadyCaptured = SavedPlayerStates.ContainsByPredicate([&Snapshot](const FARPlayerStateSaveData& Existing)
+		{
+			return Existing.Identity.Matches(Snapshot.Identity);
+		});
+		if (bAlreadyCaptured)
+		{
+			continue;
+		}
+
+		FARPlayerStateSaveData PlayerData;
+		PlayerData.Identity = Snapshot.Identity;
+		PlayerData.LoadoutTags = Snapshot.LoadoutTags;
+		PlayerData.CharacterPicked = Snapshot.CharacterPicked;
+		SavedPlayerStates.Add(MoveTemp(PlayerData));
 	}
 }
 
@@ -596,6 +639,11 @@ bool UARSaveSubsystem::CreateNewSave(FName DesiredSlotBase, FARSaveSlotDescripto
 }
 
 bool UARSaveSubsystem::PersistCanonicalSaveFromBytes(const TArray<uint8>& SaveBytes, FName SlotBaseName, int32 SlotNumber, FARSaveResult& OutResult)
+{
+	return PersistCanonicalSaveToIndex(SaveBytes, SlotBaseName, SlotNumber, ARSaveInternal::SaveIndexSlot, OutResult);
+}
+
+bool UARSaveSubsystem::PersistCanonicalSaveToIndex(const TArray<uint8>& SaveBytes, FName SlotBaseName, int32 SlotNumber, const TCHAR* IndexSlotName, FARSaveResult& OutResult)
 {
 	OutResult = FARSaveResult();
 	if (SaveBytes.Num() == 0)
@@ -628,7 +676,7 @@ bool UARSaveSubsystem::PersistCanonicalSaveFromBytes(const TArray<uint8>& SaveBy
 	}
 
 	UARSaveIndexGame* IndexObj = nullptr;
-	if (!LoadOrCreateIndex(IndexObj, OutResult))
+	if (!LoadOrCreateIndexForSlot(IndexObj, OutResult, IndexSlotName))
 	{
 		return false;
 	}
@@ -641,7 +689,7 @@ bool UARSaveSubsystem::PersistCanonicalSaveFromBytes(const TArray<uint8>& SaveBy
 	Descriptor.LastSavedTime = SaveObject->LastSaved;
 	Descriptor.Money = SaveObject->Money;
 	UpsertIndexEntry(IndexObj, Descriptor);
-	if (!SaveIndex(IndexObj, OutResult))
+	if (!SaveIndexForSlot(IndexObj, OutResult, IndexSlotName))
 	{
 		return false;
 	}
@@ -656,10 +704,15 @@ bool UARSaveSubsystem::PersistCanonicalSaveFromBytes(const TArray<uint8>& SaveBy
 }
 
 bool UARSaveSubsystem::SaveCurrentGame(FName SlotBaseName, bool bCreateNewRevision, FARSaveResult& OutResult, bool bUseDebugSaves)
+{
+	return SaveCurrentGameInternal(SlotBaseName, bCreateNewRevision, OutResult, bUseDebugSaves, /*bBackgroundWrite*/ false);
+}
+
+bool UARSaveSubsystem::SaveCurrentGameInternal(FName SlotBaseName, bool bCreateNewRevision, FARSaveResult& OutResult, bool bUseDebugSaves, bool bBackgroundWrite)
 {
 	OutResult = FARSaveResult();
 
-	if (bSaveInProgress)
+	if (bSaveInProgress || bAsyncWriteInFlight)
 	{
 		OutResult.Error = TEXT("Save already in progress.");
 		OutResult.ResultCode = EARSaveResultCode::InProgress;
@@ -759,16 +812,105 @@ bool UARSaveSubsystem::SaveCurrentGame(FName SlotBaseName, bool bCreateNewRevisi
 		UE_LOG(ARLog, Warning, TEXT("[SaveSubsystem] %s"), *Warning);
 	}
 
-	if (!SaveSaveObject(SaveObject, SlotBase, NewSlotNumber, OutResult))
+	// Serialize once; the same bytes feed the local slot write and client distribution.
+	TArray<uint8> SaveBytes;
+	if (!UGameplayStatics::SaveGameToMemory(SaveObject, SaveBytes))
 	{
+		OutResult.Error = TEXT("Failed to serialize save object.");
 		OutResult.ResultCode = EARSaveResultCode::ValidationFailed;
 		BroadcastSaveFailure(OutResult);
 		return false;
 	}
 
+	const FName RevisionSlot = BuildRevisionSlotName(SlotBase, NewSlotNumber);
+	ISaveGameSystem* SaveSystem = bBackgroundWrite ? IPlatformFeaturesModule::Get().GetSaveGameSystem() : nullptr;
+	if (!SaveSystem)
+	{
+		if (!UGameplayStatics::SaveDataToSlot(SaveBytes, RevisionSlot.ToString(), DefaultUserIndex))
+		{
+			OutResult.Error = FString::Printf(TEXT("Failed to write save slot '%s'."), *RevisionSlot.ToString());
+			OutResult.ResultCode = EARSaveResultCode::ValidationFailed;
+			BroadcastSaveFailure(OutResult);
+			return false;
+		}
+
+		CurrentSaveGame = SaveObject;
+		CurrentSlotBaseName = SlotBase;
+		LastSaveTimestampUtc = SaveObject->LastSaved;
+		bSaveDirty = false;
+		return FinalizeSaveWrite(SaveObject, IndexObj, SlotBase, NewSlotNumber, IndexSlotName, SaveBytes, OutResult);
+	}
+
+	// Background write: the snapshot is already authoritative in memory, so publish it now and let the
+	// platform save system write on a worker. Index/prune/distribution run when the write lands.
+	CurrentSaveGame = SaveObject;
+	CurrentSlotBaseName = SlotBase;
+	LastSaveTimestampUtc = SaveObject->LastSaved;
+	bSaveDirty = false;
+	bAsyncWriteInFlight = true;
+
+	OutResult.bSuccess = true;
+	OutResult.ResultCode = EARSaveResultCode::Success;
+	OutResult.SlotName = SlotBase;
+	OutResult.SlotNumber = NewSlotNumber;
+
+	// Pinned via UPROPERTY until the write lands; the completion callback may be destroyed off the game thread.
+	InFlightSaveGame = SaveObject;
+	InFlightSaveIndex = IndexObj;
+
+	TSharedRef<TArray<uint8>> SharedBytes = MakeShared<TArray<uint8>>(MoveTemp(SaveBytes));
+	TWeakObjectPtr<UARSaveSubsystem> WeakThis(this);
+	const FString IndexSlot(IndexSlotName);
+	const int32 SlotNumber = NewSlotNumber;
+
+	SaveSystem->SaveGameAsync(
+		false,
+		*RevisionSlot.ToString(),
+		FPlatformMisc::GetPlatformUserForUserIndex(DefaultUserIndex),
+		SharedBytes,
+		[WeakThis, SharedBytes, IndexSlot, SlotBase, SlotNumber](const FString& WrittenSlot, FPlatformUserId, bool bWriteSucceeded)
+		{
+			UARSaveSubsystem* StrongThis = WeakThis.Get();
+			if (!StrongThis)
+			{
+				return;
+			}
+
+			UARSaveGame* WrittenSave = StrongThis->InFlightSaveGame;
+			UARSaveIndexGame* WrittenIndex = StrongThis->InFlightSaveIndex;
+			StrongThis->InFlightSaveGame = nullptr;
+			StrongThis->InFlightSaveIndex = nullptr;
+			StrongThis->bAsyncWriteInFlight = false;
+
+			FARSaveResult WriteResult;
+			if (!bWriteSucceeded)
+			{
+				// Memory snapshot stays current; keep it dirty so the next save retries the write.
+				StrongThis->MarkSaveDirty();
+				WriteResult.Error = FString::Printf(TEXT("Failed to write save slot '%s'."), *WrittenSlot);
+				WriteResult.ResultCode = EARSaveResultCode::ValidationFailed;
+				StrongThis->BroadcastSaveFailure(WriteResult);
+				return;
+			}
+
+			if (!WrittenSave || !WrittenIndex)
+			{
+				return;
+			}
+
+			StrongThis->FinalizeSaveWrite(WrittenSave, WrittenIndex, SlotBase, SlotNumber, *IndexSlot, *SharedBytes, WriteResult);
+		});
+
+	return true;
+}
+
+bool UARSaveSubsystem::FinalizeSaveWrite(UARSaveGame* SaveObject, UARSaveIndexGame* IndexObj, FName SlotBase, int32 SlotNumber, const TCHAR* IndexSlotName, const TArray<uint8>& SaveBytes, FARSaveResult& OutResult)
+{
+	UWorld* World = GetWorld();
+
 	FARSaveSlotDescriptor Descriptor;
 	Descriptor.SlotName = SlotBase;
-	Descriptor.SlotNumber = NewSlotNumber;
+	Descriptor.SlotNumber = SlotNumber;
 	Descriptor.SaveVersion = SaveObject->SaveGameVersion;
 	Descriptor.CyclesPlayed = SaveObject->Cycles;
 	Descriptor.LastSavedTime = SaveObject->LastSaved;
@@ -781,11 +923,10 @@ bool UARSaveSubsystem::SaveCurrentGame(FName SlotBaseName, bool bCreateNewRevisi
 		BroadcastSaveFailure(OutResult);
 		return false;
 	}
-	PruneOldRevisions(SlotBase, NewSlotNumber);
+	PruneOldRevisions(SlotBase, SlotNumber);
 
 	// Distribute canonical save to clients so each machine persists equivalent snapshot.
-	TArray<uint8> SaveBytes;
-	if (UGameplayStatics::SaveGameToMemory(SaveObject, SaveBytes))
+	if (World)
 	{
 		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
 		{
@@ -793,27 +934,23 @@ bool UARSaveSubsystem::SaveCurrentGame(FName SlotBaseName, bool bCreateNewRevisi
 			{
 				if (PC->GetNetMode() != NM_Standalone && !PC->IsLocalController())
 				{
-					PC->ClientPersistCanonicalSave(SaveBytes, SlotBase, NewSlotNumber);
+					PC->ClientPersistCanonicalSave(SaveBytes, SlotBase, SlotNumber);
 				}
 			}
 		}
 	}
 
-	CurrentSaveGame = SaveObject;
-	CurrentSlotBaseName = SlotBase;
 	FlushPendingCanonicalSyncRequests();
-	LastSaveTimestampUtc = SaveObject->LastSaved;
-	bSaveDirty = false;
 	OutResult.bSuccess = true;
 	OutResult.ResultCode = EARSaveResultCode::Success;
 	OutResult.SlotName = SlotBase;
-	OutResult.SlotNumber = NewSlotNumber;
+	OutResult.SlotNumber = SlotNumber;
 
 	if (bLogSaveSuccess)
 	{
 		UE_LOG(ARLog, Log, TEXT("[SaveSubsystem] Save succeeded (Slot=%s Rev=%d Time=%s DirtyCleared=%s)"),
 			*SlotBase.ToString(),
-			NewSlotNumber,
+			SlotNumber,
 			*SaveObject->LastSaved.ToString(),
 			bSaveDirty ? TEXT("false") : TEXT("true"));
 	}
@@ -851,8 +988,8 @@ bool UARSaveSubsystem::LoadGame(FName SlotBaseName, int32 RevisionOrLatest, FARS
 	{
 		UE_LOG(
 			ARLog,
-			Warning,
-			TEXT("[SaveSubsystem] Loaded older save schema version %d (current %d). Migration path not implemented yet."),
+			Log,
+			TEXT("[SaveSubsystem] Loaded older save schema version %d (current %d). It will be rewritten in the current layout on next save."),
 			LoadedSave->SaveGameVersion,
 			UARSaveGame::GetCurrentSchemaVersion());
 	}
@@ -867,12 +1004,17 @@ bool UARSaveSubsystem::LoadGame(FName SlotBaseName, int32 RevisionOrLatest, FARS
 }
 
 bool UARSaveSubsystem::ListSaves(TArray<FARSaveSlotDescriptor>& OutSlots, FARSaveResult& OutResult, bool bUseDebugSaves) const
+{
+	return ListSavesInIndex(ARSaveInternal::GetIndexSlotNameForNamespace(bUseDebugSaves), OutSlots, OutResult);
+}
+
+bool UARSaveSubsystem::ListSavesInIndex(const TCHAR* IndexSlotName, TArray<FARSaveSlotDescriptor>& OutSlots, FARSaveResult& OutResult) const
 {
 	OutSlots.Reset();
 	OutResult = FARSaveResult();
 
 	UARSaveIndexGame* IndexObj = nullptr;
-	if (!LoadOrCreateIndexForSlot(IndexObj, OutResult, ARSaveInternal::GetIndexSlotNameForNamespace(bUseDebugSaves)))
+	if (!LoadOrCreateIndexForSlot(IndexObj, OutResult, IndexSlotName))
 	{
 		return false;
 	}
@@ -1017,6 +1159,15 @@ void UARSaveSubsystem::RequestGameStateHydration(AARGameStateBase* Requester)
 		return;
 	}
 
+	// Destination map is hydrated once this returns; a queued travel save can now be written off the transition.
+	ON_SCOPE_EXIT
+	{
+		if (bDeferredTravelSavePending)
+		{
+			ScheduleDeferredTravelSaveFlush(0.f);
+		}
+	};
+
 	// Travel-transient GameState data overlays persisted/default fields on first hydration pass after travel.
 	if (PendingTravelGameStateData.IsValid())
 	{
@@ -1065,7 +1216,7 @@ void UARSaveSubsystem::ClearPendingTravelGameStateData()
 
 bool UARSaveSubsystem::TryHydratePlayerStateFromCurrentSave(AARPlayerStateBase* Requester, const bool bAllowSlotFallback)
 {
-	if (!Requester || !CurrentSaveGame)
+	if (!Requester)
 	{
 		return false;
 	}
@@ -1076,6 +1227,16 @@ bool UARSaveSubsystem::TryHydratePlayerStateFromCurrentSave(AARPlayerStateBase*
 		return false;
 	}
 
+	if (TryApplyTravelPlayerSnapshot(Requester, bAllowSlotFallback))
+	{
+		return true;
+	}
+
+	if (!CurrentSaveGame)
+	{
+		return false;
+	}
+
 	const FARPlayerIdentity QueryIdentity = ARSaveInternal::BuildPlayerIdentityFromPlayerState(Requester);
 	const bool bRequireIdentityMatch = QueryIdentity.HasStrictOnlineIdentity();
 
@@ -1180,6 +1341,179 @@ bool UARSaveSubsystem::CaptureGameStateForTravel(UWorld* World)
 	return false;
 }
 
+int32 UARSaveSubsystem::CapturePlayerStatesForTravel(UWorld* World)
+{
+	PendingTravelPlayerSnapshots.Reset();
+
+	const AARGameStateBase* GS = World ? World->GetGameState<AARGameStateBase>() : nullptr;
+	if (!GS)
+	{
+		return 0;
+	}
+
+	for (APlayerState* PS : GS->PlayerArray)
+	{
+		AARPlayerStateBase* ARPS = Cast<AARPlayerStateBase>(PS);
+		if (!ARPS)
+		{
+			continue;
+		}
+
+		FARTravelPlayerSnapshot& Snapshot = PendingTravelPlayerSnapshots.AddDefaulted_GetRef();
+		Snapshot.Identity = ARSaveInternal::BuildPlayerIdentityFromPlayerState(ARPS);
+		Snapshot.CharacterPicked = ARPS->GetCharacterPicked();
+		Snapshot.LoadoutTags = ARPS->LoadoutTags;
+		if (ARPS->GetClass()->ImplementsInterface(UStructSerializable::StaticClass()))
+		{
+			IStructSerializable::Execute_ExtractStateToStruct(ARPS, Snapshot.State);
+		}
+	}
+
+	return PendingTravelPlayerSnapshots.Num();
+}
+
+bool UARSaveSubsystem::TryApplyTravelPlayerSnapshot(AARPlayerStateBase* Requester, const bool bAllowSlotFallback)
+{
+	if (!Requester || PendingTravelPlayerSnapshots.Num() == 0)
+	{
+		return false;
+	}
+
+	const FARPlayerIdentity QueryIdentity = ARSaveInternal::BuildPlayerIdentityFromPlayerState(Requester);
+
+	// Same preference order as UARSaveGame::FindPlayerStateDataByIdentity: slot-consistent identity, any identity, then slot.
+	int32 MatchIndex = INDEX_NONE;
+	for (int32 i = 0; i < PendingTravelPlayerSnapshots.Num(); ++i)
+	{
+		const FARPlayerIdentity& SnapshotIdentity = PendingTravelPlayerSnapshots[i].Identity;
+		if (!SnapshotIdentity.Matches(QueryIdentity))
+		{
+			continue;
+		}
+
+		if (MatchIndex == INDEX_NONE)
+		{
+			MatchIndex = i;
+		}
+		if (QueryIdentity.PlayerSlot != EARPlayerSlot::Unknown && SnapshotIdentity.PlayerSlot == QueryIdentity.PlayerSlot)
+		{
+			MatchIndex = i;
+			break;
+		}
+	}
+
+	if (MatchIndex == INDEX_NONE && bAllowSlotFallback && !QueryIdentity.HasStrictOnlineIdentity())
+	{
+		MatchIndex = PendingTravelPlayerSnapshots.IndexOfByPredicate([&QueryIdentity](const FARTravelPlayerSnapshot& Snapshot)
+		{
+			return QueryIdentity.PlayerSlot != EARPlayerSlot::Unknown && Snapshot.Identity.PlayerSlot == QueryIdentity.PlayerSlot;
+		});
+	}
+
+	if (MatchIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FARTravelPlayerSnapshot Snapshot = MoveTemp(PendingTravelPlayerSnapshots[MatchIndex]);
+	PendingTravelPlayerSnapshots.RemoveAtSwap(MatchIndex);
+
+	if (Snapshot.State.IsValid() && Requester->GetClass()->ImplementsInterface(UStructSerializable::StaticClass()))
+	{
+		IStructSerializable::Execute_ApplyStateFromStruct(Requester, Snapshot.State);
+	}
+
+	Requester->SetCharacterPicked(Snapshot.CharacterPicked);
+	Requester->SetDisplayNameValue(Snapshot.Identity.DisplayName.ToString());
+	Requester->SetLoadoutTags(Snapshot.LoadoutTags);
+	return true;
+}
+
+void UARSaveSubsystem::QueueDeferredTravelSave()
+{
+	bDeferredTravelSavePending = true;
+	// Keeps quit/leave autosave paths honest if the process exits before the deferred write runs.
+	bSaveDirty = true;
+}
+
+void UARSaveSubsystem::ScheduleDeferredTravelSaveFlush(const float DelaySeconds)
+{
+	UGameInstance* GI = GetGameInstance();
+	if (!GI)
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = GI->GetTimerManager();
+	TimerManager.ClearTimer(DeferredTravelSaveTimerHandle);
+	if (DelaySeconds <= 0.f)
+	{
+		DeferredTravelSaveTimerHandle = TimerManager.SetTimerForNextTick(this, &UARSaveSubsystem::FlushDeferredTravelSave);
+		return;
+	}
+
+	TimerManager.SetTimer(DeferredTravelSaveTimerHandle, this, &UARSaveSubsystem::FlushDeferredTravelSave, DelaySeconds, false);
+}
+
+void UARSaveSubsystem::HandlePostLoadMapWithWorld(UWorld* LoadedWorld)
+{
+	if (!bDeferredTravelSavePending || !LoadedWorld || LoadedWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	// Fallback for maps whose GameState never requests hydration; the hydration path normally flushes sooner.
+	// When hydration already armed a flush (PostLoadMap can fire after it), leave that sooner timer alone.
+	UGameInstance* GI = GetGameInstance();
+	if (GI && GI->GetTimerManager().TimerExists(DeferredTravelSaveTimerHandle))
+	{
+		return;
+	}
+
+	ScheduleDeferredTravelSaveFlush(DeferredTravelSaveFallbackSeconds);
+}
+
+void UARSaveSubsystem::FlushDeferredTravelSave()
+{
+	if (!bDeferredTravelSavePending)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		bDeferredTravelSavePending = false;
+		return;
+	}
+
+	if (IsSaveInProgress())
+	{
+		ScheduleDeferredTravelSaveFlush(FMath::Max(MinSaveIntervalSeconds, 0.25f));
+		return;
+	}
+
+	const float ThrottleRemaining = GetSaveThrottleRemainingSeconds();
+	if (ThrottleRemaining > 0.f)
+	{
+		ScheduleDeferredTravelSaveFlush(ThrottleRemaining);
+		return;
+	}
+
+	bDeferredTravelSavePending = false;
+
+	FARSaveResult SaveResult;
+	if (!SaveCurrentGameInternal(NAME_None, true, SaveResult, false, /*bBackgroundWrite*/ true))
+	{
+		UE_LOG(ARLog, Warning, TEXT("[SaveSubsystem] Deferred travel save failed: %s"), *SaveResult.Error);
+		MarkSaveDirty();
+		return;
+	}
+
+	// Unclaimed player snapshots were folded into the new save's player rows; late joiners hydrate from there.
+	PendingTravelPlayerSnapshots.Reset();
+}
+
 FString UARSaveSubsystem::EnsureListenOption(const FString& InURLOrOptions)
 {
 	if (InURLOrOptions.Contains(TEXT("listen"), ESearchCase::IgnoreCase))
@@ -1215,23 +1549,26 @@ bool UARSaveSubsystem::RequestServerTravel(
 		return false;
 	}
 
+	// State crosses the transition in memory; disk persistence happens once the destination map is hydrated.
 	CaptureGameStateForTravel(World);
+	CapturePlayerStatesForTravel(World);
 
 	if (bPersistSaveBeforeTravel)
 	{
-		FARSaveResult SaveResult;
-		if (!SaveCurrentGame(NAME_None, true, SaveResult))
-		{
-			UE_LOG(ARLog, Warning, TEXT("[SaveSubsystem] ServerTravel blocked: save failed: %s"), *SaveResult.Error);
-			return false;
-		}
+		QueueDeferredTravelSave();
+	}
 
-		// Persisted save supersedes travel-transient overlay.
+	const FString TravelURL = EnsureListenOption(URL);
+	if (!World->ServerTravel(TravelURL, bAbsolute, bSkipGameNotify))
+	{
+		// Nothing left the current map; drop the handoff so it cannot leak into a later hydration.
 		ClearPendingTravelGameStateData();
+		PendingTravelPlayerSnapshots.Reset();
+		bDeferredTravelSavePending = false;
+		return false;
 	}
 
-	const FString TravelURL = EnsureListenOption(URL);
-	return World->ServerTravel(TravelURL, bAbsolute, bSkipGameNotify);
+	return true;
 }
 
 bool UARSaveSubsystem::RequestOpenLevel(
@@ -1254,19 +1591,13 @@ bool UARSaveSubsystem::RequestOpenLevel(
 		return false;
 	}
 
+	// State crosses the transition in memory; disk persistence happens once the destination map is hydrated.
 	CaptureGameStateForTravel(World);
+	CapturePlayerStatesForTravel(World);
 
 	if (bPersistSaveBeforeTravel)
 	{
-		FARSaveResult SaveResult;
-		if (!SaveCurrentGame(NAME_None, true, SaveResult))
-		{
-			UE_LOG(ARLog, Warning, TEXT("[SaveSubsystem] OpenLevel blocked: save failed: %s"), *SaveResult.Error);
-			return false;
-		}
-
-		// Persisted save supersedes travel-transient overlay.
-		ClearPendingTravelGameStateData();
+		QueueDeferredTravelSave();
 	}
 
 	const FString ListenOptions = EnsureListenOption(Options);
@@ -1358,7 +1689,134 @@ bool UARSaveSubsystem::FormatTimeSinceLastSave(FText& OutText) const
 
 void UARSaveSubsystem::MarkSaveDirty()
 {
+	const bool bWasDirty = bSaveDirty;
 	bSaveDirty = true;
+	if (!bWasDirty)
+	{
+		ArmAutosaveStalenessTimer(MaxAutosaveStalenessSeconds);
+	}
+}
+
+bool UARSaveSubsystem::NotifyAutosaveBoundary(const EARAutosaveBoundary Boundary)
+{
+	if (!bAutosaveAtSafeBoundaries || !bSaveDirty || Boundary == EARAutosaveBoundary::None)
+	{
+		return false;
+	}
+
+	// Defer to the next engine tick: boundaries are often reported mid-frame (BeginPlay, flow callbacks), and the
+	// core ticker still runs while the world is paused.
+	PendingAutosaveBoundary = Boundary;
+	if (!ScheduledAutosaveTickerHandle.IsValid())
+	{
+		ScheduledAutosaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+		{
+			FlushScheduledAutosave();
+			return false;
+		}));
+	}
+	return true;
+}
+
+float UARSaveSubsystem::GetSaveThrottleRemainingSeconds() const
+{
+	if (MinSaveIntervalSeconds <= 0.f || LastSaveTimestampUtc.GetTicks() == 0)
+	{
+		return 0.f;
+	}
+
+	const double Elapsed = (FDateTime::UtcNow() - LastSaveTimestampUtc).GetTotalSeconds();
+	return Elapsed < MinSaveIntervalSeconds ? static_cast<float>(MinSaveIntervalSeconds - Elapsed) : 0.f;
+}
+
+void UARSaveSubsystem::ArmAutosaveStalenessTimer(const float DelaySeconds)
+{
+	if (!bAutosaveAtSafeBoundaries || MaxAutosaveStalenessSeconds <= 0.f)
+	{
+		return;
+	}
+
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		GI->GetTimerManager().SetTimer(AutosaveStalenessTimerHandle, this, &UARSaveSubsystem::HandleAutosaveStalenessExpired, FMath::Max(DelaySeconds, 0.1f), false);
+	}
+}
+
+void UARSaveSubsystem::ArmAutosaveStalenessRetry(const EARAutosaveBoundary Boundary, const float RetrySeconds)
+{
+	// The staleness timer itself just fired, so it always needs re-arming. Other boundaries keep an already armed
+	// (possibly sooner) timer and only arm one when none is pending.
+	if (Boundary != EARAutosaveBoundary::MaxStaleness)
+	{
+		const UGameInstance* GI = GetGameInstance();
+		if (GI && GI->GetTimerManager().TimerExists(AutosaveStalenessTimerHandle))
+		{
+			return;
+		}
+	}
+
+	ArmAutosaveStalenessTimer(RetrySeconds);
+}
+
+void UARSaveSubsystem::HandleAutosaveStalenessExpired()
+{
+	TryRunScheduledAutosave(EARAutosaveBoundary::MaxStaleness);
+}
+
+void UARSaveSubsystem::FlushScheduledAutosave()
+{
+	ScheduledAutosaveTickerHandle.Reset();
+	const EARAutosaveBoundary Boundary = PendingAutosaveBoundary;
+	PendingAutosaveBoundary = EARAutosaveBoundary::None;
+	TryRunScheduledAutosave(Boundary);
+}
+
+bool UARSaveSubsystem::TryRunScheduledAutosave(const EARAutosaveBoundary Boundary)
+{
+	if (!bSaveDirty || !CurrentSaveGame || Boundary == EARAutosaveBoundary::None)
+	{
+		return false;
+	}
+
+	// A queued travel save already owns the next write.
+	if (bDeferredTravelSavePending)
+	{
+		return false;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		return false;
+	}
+
+	// Boundaries are frequent enough to simply skip when busy; the staleness bound retries shortly instead. The
+	// retry is armed for every boundary: the staleness timer may have been cleared by a save that has not finished,
+	// and MarkSaveDirty only re-arms it on a clean -> dirty transition.
+	const float ThrottleRemaining = GetSaveThrottleRemainingSeconds();
+	if (IsSaveInProgress() || ThrottleRemaining > 0.f)
+	{
+		ArmAutosaveStalenessRetry(Boundary, FMath::Max(ThrottleRemaining, 1.f));
+		return false;
+	}
+
+	FARSaveResult SaveResult;
+	if (!SaveCurrentGameInternal(CurrentSlotBaseName, true, SaveResult, false, /*bBackgroundWrite*/ true))
+	{
+		UE_LOG(ARLog, Warning, TEXT("[SaveSubsystem] Autosave at boundary %s failed: %s"),
+			*UEnum::GetValueAsString(Boundary), *SaveResult.Error);
+		ArmAutosaveStalenessRetry(Boundary, FMath::Max(MinSaveIntervalSeconds, 1.f));
+		return false;
+	}
+
+	if (UGameInstance* GI = GetGameInstance())
+	{
+		GI->GetTimerManager().ClearTimer(AutosaveStalenessTimerHandle);
+	}
+
+	UE_LOG(ARLog, Verbose, TEXT("[SaveSubsystem] Autosave queued at boundary %s (Slot=%s Rev=%d)."),
+		*UEnum::GetValueAsString(Boundary), *SaveResult.SlotName.ToString(), SaveResult.SlotNumber);
+	return true;
 }
 
 FGameplayTagContainer UARSaveSubsystem::GetProgressionTags() const
@@ -1390,6 +1848,7 @@ bool UARSaveSubsystem::AddProgressionTag(FGameplayTag ProgressionTag)
 
 	CurrentSaveGame->ProgressionTags.AddTag(ProgressionTag);
 	MarkSaveDirty();
+	OnProgressionTagChanged.Broadcast(ProgressionTag, true);
 	return true;
 }
 
@@ -1407,6 +1866,7 @@ bool UARSaveSubsystem::RemoveProgressionTag(FGameplayTag ProgressionTag)
 
 	CurrentSaveGame->ProgressionTags.RemoveTag(ProgressionTag);
 	MarkSaveDirty();
+	OnProgressionTagChanged.Broadcast(ProgressionTag, false);
 	return true;
 }
 
@@ -1463,6 +1923,9 @@ void UARSaveSubsystem::ApplyLoadedSave(UARSaveGame* LoadedSave, const FARSaveRes
 	CurrentSlotBaseName = LoadResult.SlotName;
 	LastSaveTimestampUtc = LoadedSave->LastSaved;
 	bSaveDirty = false;
+	// Travel snapshots belong to the previous session's state; a freshly loaded save supersedes them.
+	PendingTravelPlayerSnapshots.Reset();
+	bDeferredTravelSavePending = false;
 	FlushPendingCanonicalSyncRequests();
 
 	if (UARSaveIndexGame* IndexObj = Cast<UARSaveIndexGame>(UGameplayStatics::LoadGameFromSlot(ARSaveInternal::SaveIndexSlot, DefaultUserIndex)))
@@ -2,6 +2,7 @@
 
 #include "ARFactionSubsystem.h"
 #include "ARLog.h"
+#include "ARSaveSubsystem.h"
 #include "Engine/GameInstance.h"
 
 AARShopGameMode::AARShopGameMode()
@@ -9,6 +10,22 @@ AARShopGameMode::AARShopGameMode()
 	ModeTag = FGameplayTag::RequestGameplayTag(TEXT("Mode.Shop"), false);
 }
 
+void AARShopGameMode::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	// Shop entry is a calm point; any state left dirty by the previous mode can be written now.
+	if (UARSaveSubsystem* SaveSubsystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<UARSaveSubsystem>() : nullptr)
+	{
+		SaveSubsystem->NotifyAutosaveBoundary(EARAutosaveBoundary::ShopEntry);
+	}
+}
+
 bool AARShopGameMode::PreStartTravel(const FString& URL, const FString& Options, bool bSkipReadyChecks)
 {
 	if (!Super::PreStartTravel(URL, Options, bSkipReadyChecks))
@@ -14,7 +14,18 @@ TSubclassOf<UStateTreeSchema> UARStateTreeAIComponent::GetSchema() const
 void UARStateTreeAIComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	RefreshActiveStateTags();
+
+	if (!bActiveStateTagsDirty && IsRunning())
+	{
+		const FStateTreeExecutionState* ExecState = InstanceData.GetExecutionState();
+		bActiveStateTagsDirty = ExecState && ExecState->StateChangeCount != ObservedStateChangeCount;
+	}
+
+	if (bActiveStateTagsDirty)
+	{
+		RefreshActiveStateTags();
+	}
+	FlushActiveStateTags();
 }
 
 void UARStateTreeAIComponent::StartLogic()
@@ -25,6 +36,8 @@ void UARStateTreeAIComponent::StartLogic()
 			*GetNameSafe(GetOwner()));
 	}
 
+	// Tree assets can be recompiled between runs (editor), so state tag tables are rebuilt per run.
+	StateTagReader.Reset();
 	Super::StartLogic();
 
 	if (!IsRunning())
@@ -38,7 +51,9 @@ void UARStateTreeAIComponent::StartLogic()
 			*GetNameSafe(GetOwner()), *GetNameSafe(StateTreeRef.GetStateTree()));
 	}
 
+	bActiveStateTagsDirty = true;
 	RefreshActiveStateTags();
+	FlushActiveStateTags();
 }
 
 void UARStateTreeAIComponent::StopLogic(const FString& Reason)
@@ -46,19 +61,24 @@ void UARStateTreeAIComponent::StopLogic(const FString& Reason)
 	Super::StopLogic(Reason);
 	UE_LOG(ARLog, Verbose, TEXT("[EnemyAI|StateTreeComp] StopLogic on '%s'. Reason: %s"),
 		*GetNameSafe(GetOwner()), *Reason);
+	bActiveStateTagsDirty = true;
 	RefreshActiveStateTags();
+	FlushActiveStateTags();
 }
 
 void UARStateTreeAIComponent::Cleanup()
 {
 	Super::Cleanup();
+	bActiveStateTagsDirty = true;
 	RefreshActiveStateTags();
+	FlushActiveStateTags();
 }
 
 void UARStateTreeAIComponent::RefreshActiveStateTags()
 {
 	FGameplayTagContainer NewTags;
 	bool bCouldReadContext = false;
+	uint16 StateChangeCount = 0;
 
 	if (IsRunning())
 	{
@@ -67,31 +87,17 @@ void UARStateTreeAIComponent::RefreshActiveStateTags()
 		if (RootStateTree && OwnerObject)
 		{
 			FStateTreeReadOnlyExecutionContext Context(OwnerObject, RootStateTree, InstanceData);
-			if (Context.IsValid())
+			bCouldReadContext = StateTagReader.CollectActiveStateTags(Context, *RootStateTree, NewTags);
+			if (bCouldReadContext)
 			{
-				bCouldReadContext = true;
-				const TConstArrayView<FStateTreeExecutionFrame> ActiveFrames = Context.GetActiveFrames();
-				for (const FStateTreeExecutionFrame& ActiveFrame : ActiveFrames)
+				if (const FStateTreeExecutionState* ExecState = InstanceData.GetExecutionState())
 				{
-					const UStateTree* FrameStateTree = ActiveFrame.StateTree ? ActiveFrame.StateTree.Get() : RootStateTree;
-					if (!FrameStateTree)
-					{
-						continue;
-					}
-
-					for (const FStateTreeStateHandle ActiveStateHandle : ActiveFrame.ActiveStates)
-					{
-						const FCompactStateTreeState* ActiveState = FrameStateTree->GetStateFromHandle(ActiveStateHandle);
-						if (ActiveState && ActiveState->Tag.IsValid())
-						{
-							NewTags.AddTag(ActiveState->Tag);
-						}
-					}
+					StateChangeCount = ExecState->StateChangeCount;
 				}
 			}
 		}
 
-		// When the tree is running but context is transiently unreadable, keep previous tags.
+		// When the tree is running but context is transiently unreadable, keep previous tags and retry next tick.
 		// Treating this as empty causes false remove/add churn and can destabilize tag-driven conditions.
 		if (!bCouldReadContext)
 		{
@@ -99,32 +105,108 @@ void UARStateTreeAIComponent::RefreshActiveStateTags()
 		}
 	}
 
-	EmitTagDelta(NewTags);
-	CurrentActiveStateTags = MoveTemp(NewTags);
+	ObservedStateChangeCount = StateChangeCount;
+	bActiveStateTagsDirty = false;
+	PendingActiveStateTags = MoveTemp(NewTags);
+	bHasPendingActiveStateTags = true;
+}
+
+void UARStateTreeAIComponent::FlushActiveStateTags()
+{
+	if (!bHasPendingActiveStateTags)
+	{
+		return;
+	}
+
+	bHasPendingActiveStateTags = false;
+	EmitTagDelta(PendingActiveStateTags);
+	CurrentActiveStateTags = MoveTemp(PendingActiveStateTags);
+	PendingActiveStateTags.Reset();
 }
 
 void UARStateTreeAIComponent::EmitTagDelta(const FGameplayTagContainer& NewTags)
 {
 	FGameplayTagContainer AddedTags;
+	FGameplayTagContainer RemovedTags;
+	FARStateTreeStateTagReader::ComputeTagDelta(CurrentActiveStateTags, NewTags, AddedTags, RemovedTags);
+
+	if (!AddedTags.IsEmpty() || !RemovedTags.IsEmpty())
+	{
+		OnActiveStateTagsChanged.Broadcast(AddedTags, RemovedTags);
+	}
+}
+
+bool FARStateTreeStateTagReader::CollectActiveStateTags(
+	const FStateTreeReadOnlyExecutionContext& Context,
+	const UStateTree& RootStateTree,
+	FGameplayTagContainer& OutTags)
+{
+	if (!Context.IsValid())
+	{
+		return false;
+	}
+
+	const TConstArrayView<FStateTreeExecutionFrame> ActiveFrames = Context.GetActiveFrames();
+	for (const FStateTreeExecutionFrame& ActiveFrame : ActiveFrames)
+	{
+		const UStateTree* FrameStateTree = ActiveFrame.StateTree ? ActiveFrame.StateTree.Get() : &RootStateTree;
+		if (!FrameStateTree)
+		{
+			continue;
+		}
+
+		const TArray<FGameplayTag>& StateTags = GetStateTagTable(*FrameStateTree);
+		for (const FStateTreeStateHandle ActiveStateHandle : ActiveFrame.ActiveStates)
+		{
+			if (StateTags.IsValidIndex(ActiveStateHandle.Index) && StateTags[ActiveStateHandle.Index].IsValid())
+			{
+				OutTags.AddTag(StateTags[ActiveStateHandle.Index]);
+			}
+		}
+	}
+
+	return true;
+}
+
+void FARStateTreeStateTagReader::ComputeTagDelta(
+	const FGameplayTagContainer& OldTags,
+	const FGameplayTagContainer& NewTags,
+	FGameplayTagContainer& OutAddedTags,
+	FGameplayTagContainer& OutRemovedTags)
+{
 	for (const FGameplayTag Tag : NewTags)
 	{
-		if (!CurrentActiveStateTags.HasTagExact(Tag))
+		if (!OldTags.HasTagExact(Tag))
 		{
-			AddedTags.AddTag(Tag);
+			OutAddedTags.AddTag(Tag);
 		}
 	}
 
-	FGameplayTagContainer RemovedTags;
-	for (const FGameplayTag Tag : CurrentActiveStateTags)
+	for (const FGameplayTag Tag : OldTags)
 	{
 		if (!NewTags.HasTagExact(Tag))
 		{
-			RemovedTags.AddTag(Tag);
+			OutRemovedTags.AddTag(Tag);
 		}
 	}
+}
 
-	if (!AddedTags.IsEmpty() || !RemovedTags.IsEmpty())
+const TArray<FGameplayTag>& FARStateTreeStateTagReader::GetStateTagTable(const UStateTree& StateTree)
+{
+	if (const TArray<FGameplayTag>* Existing = StateTagTables.Find(&StateTree))
 	{
-		OnActiveStateTagsChanged.Broadcast(AddedTags, RemovedTags);
+		return *Existing;
+	}
+
+	TArray<FGameplayTag>& Table = StateTagTables.Add(&StateTree);
+	for (int32 Index = 0; Index < MAX_uint16; ++Index)
+	{
+		const FCompactStateTreeState* State = StateTree.GetStateFromHandle(FStateTreeStateHandle(static_cast<uint16>(Index)));
+		if (!State)
+		{
+			break;
+		}
+		Table.Add(State->Tag);
 	}
+	return Table;
 }
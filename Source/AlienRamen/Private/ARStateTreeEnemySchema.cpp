@@ -0,0 +1,34 @@
+#include "ARStateTreeEnemySchema.h"
+
+#include "AREnemyBase.h"
+
+UARStateTreeEnemySchema::UARStateTreeEnemySchema(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	ContextActorClass = AAREnemyBase::StaticClass();
+	SyncContextDescriptorTypes();
+}
+
+void UARStateTreeEnemySchema::PostLoad()
+{
+	Super::PostLoad();
+	SyncContextDescriptorTypes();
+}
+
+#if WITH_EDITOR
+void UARStateTreeEnemySchema::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeChainProperty(PropertyChangedEvent);
+	SyncContextDescriptorTypes();
+}
+#endif
+
+void UARStateTreeEnemySchema::SyncContextDescriptorTypes()
+{
+	ContextActorClass = AAREnemyBase::StaticClass();
+
+	if (ContextDataDescs.IsValidIndex(0))
+	{
+		ContextDataDescs[0].Struct = ContextActorClass.Get();
+	}
+}
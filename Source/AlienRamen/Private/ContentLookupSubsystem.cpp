@@ -3,7 +3,12 @@
 #include "ContentLookupSubsystem.h"
 #include "ARContentLookupSettings.h"
 #include "ARLog.h"
+#include "Engine/AssetManager.h"
 #include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
+#include "GameplayTagsManager.h"
+#include "Misc/Paths.h"
+#include "UObject/UnrealType.h"
 #include "UObject/SoftObjectPtr.h"
 #include "StructUtils/InstancedStruct.h"
 
@@ -17,6 +22,24 @@ static FString GetLeafSegment(const FString& In)
 	return In;
 }
 
+static void GatherRowSoftReferences(const UScriptStruct* RowStruct, const uint8* RowData, TSet<FSoftObjectPath>& OutPaths)
+{
+	if (!RowStruct || !RowData)
+	{
+		return;
+	}
+
+	// Covers TSoftObjectPtr and TSoftClassPtr (FSoftClassProperty derives from FSoftObjectProperty), nested structs and arrays included.
+	for (TPropertyValueIterator<FSoftObjectProperty> It(RowStruct, RowData); It; ++It)
+	{
+		const FSoftObjectPath& Path = static_cast<const FSoftObjectPtr*>(It.Value())->ToSoftObjectPath();
+		if (Path.IsValid())
+		{
+			OutPaths.Add(Path);
+		}
+	}
+}
+
 void UContentLookupSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -45,16 +68,106 @@ void UContentLookupSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 			UE_LOG(ARLog, Warning, TEXT("[ContentLookup] Registry validation warning: %s"), *Err);
 		}
 	}
+
+	LoadContentPack();
+	RebuildTagIndex();
+
+	if (Settings && Settings->bWarmupTablesOnStartup)
+	{
+		StartWarmup();
+	}
 }
 
 void UContentLookupSubsystem::Deinitialize()
 {
-	ClearCache();
+	CancelWarmup();
+	ResetTagIndex();
+	LoadedTables.Reset();
+	ContentPack.Reset();
+	PackRowStructs.Reset();
 	Registry = nullptr;
 
 	Super::Deinitialize();
 }
 
+void UContentLookupSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	// Pack rows live outside any UObject, so their object references are reported here (DataTables do the same for their RowMap).
+	UContentLookupSubsystem* This = CastChecked<UContentLookupSubsystem>(InThis);
+	for (TPair<int32, FContentLookupPackedRow>& Pair : This->MaterializedPackRows)
+	{
+		Collector.AddPropertyReferencesWithStructARO(Pair.Value.RowStruct, Pair.Value.Memory, This);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UContentLookupSubsystem::LoadContentPack()
+{
+	ContentPack.Reset();
+
+	// The editor always reads DataTables so authoring changes show up without a rebake.
+	const UARContentLookupSettings* Settings = GetDefault<UARContentLookupSettings>();
+	if (GIsEditor || !Settings || !Settings->bUseContentPack || Settings->ContentPackPath.IsEmpty())
+	{
+		return;
+	}
+
+	const FString PackPath = FPaths::Combine(FPaths::ProjectContentDir(), Settings->ContentPackPath);
+	if (!FPaths::FileExists(PackPath))
+	{
+		UE_LOG(ARLog, Log, TEXT("[ContentLookup] No content pack at '%s'; serving rows from DataTables."), *PackPath);
+		return;
+	}
+
+	TUniquePtr<FARContentPack> Pack = MakeUnique<FARContentPack>();
+	FString Error;
+	if (!Pack->LoadFromFile(PackPath, Error))
+	{
+		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] Ignoring content pack '%s': %s"), *PackPath, *Error);
+		return;
+	}
+
+	UE_LOG(ARLog, Log, TEXT("[ContentLookup] Content pack loaded: '%s' (%d routes)."), *PackPath, Pack->GetRouteCount());
+	ContentPack = MoveTemp(Pack);
+}
+
+const uint8* UContentLookupSubsystem::MaterializePackRow(const int32 PackRowIndex, const UScriptStruct* RowStruct)
+{
+	if (const FContentLookupPackedRow* Existing = MaterializedPackRows.Find(PackRowIndex))
+	{
+		return Existing->Memory;
+	}
+
+	if (!ContentPack || !RowStruct)
+	{
+		return nullptr;
+	}
+
+	uint8* Memory = static_cast<uint8*>(FMemory::Malloc(RowStruct->GetStructureSize(), RowStruct->GetMinAlignment()));
+	RowStruct->InitializeStruct(Memory);
+	if (!ContentPack->DeserializeRow(PackRowIndex, RowStruct, Memory))
+	{
+		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] Content pack row %d failed to deserialize as '%s'."), PackRowIndex, *GetNameSafe(RowStruct));
+		RowStruct->DestroyStruct(Memory);
+		FMemory::Free(Memory);
+		return nullptr;
+	}
+
+	MaterializedPackRows.Add(PackRowIndex, FContentLookupPackedRow{ RowStruct, Memory });
+	return Memory;
+}
+
+void UContentLookupSubsystem::ReleasePackRows()
+{
+	for (TPair<int32, FContentLookupPackedRow>& Pair : MaterializedPackRows)
+	{
+		Pair.Value.RowStruct->DestroyStruct(Pair.Value.Memory);
+		FMemory::Free(Pair.Value.Memory);
+	}
+	MaterializedPackRows.Reset();
+}
+
 void UContentLookupSubsystem::SetRegistry(UContentLookupRegistry* InRegistry)
 {
 	if (!InRegistry)
@@ -73,7 +186,429 @@ void UContentLookupSubsystem::SetRegistry(UContentLookupRegistry* InRegistry)
 
 void UContentLookupSubsystem::ClearCache()
 {
+	const bool bRestartWarmup = bWarmupStarted;
+	CancelWarmup();
+	ResetTagIndex();
 	LoadedTables.Reset();
+	RebuildTagIndex();
+
+	if (bRestartWarmup)
+	{
+		StartWarmup();
+	}
+}
+
+void UContentLookupSubsystem::StartWarmup()
+{
+	CancelWarmup();
+	EnsureTagIndex();
+	bWarmupStarted = true;
+
+	TArray<FSoftObjectPath> TablePaths;
+	for (const FContentLookupIndexedRoute& Route : IndexedRoutes)
+	{
+		if (Route.PackRouteIndex == INDEX_NONE && !Route.DataTable.IsNull() && !LoadedTables.Contains(Route.RootTag))
+		{
+			TablePaths.AddUnique(Route.DataTable.ToSoftObjectPath());
+		}
+	}
+
+	const uint32 Serial = WarmupSerial;
+	UE_LOG(ARLog, Log, TEXT("[ContentLookup] Warmup started: streaming %d tables."), TablePaths.Num());
+	if (TablePaths.Num() > 0)
+	{
+		FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+		WarmupTablesHandle = Streamable.RequestAsyncLoad(
+			TablePaths,
+			FStreamableDelegate::CreateUObject(this, &UContentLookupSubsystem::HandleWarmupTablesLoaded, Serial),
+			FStreamableManager::AsyncLoadHighPriority);
+		if (WarmupTablesHandle.IsValid())
+		{
+			return;
+		}
+	}
+
+	HandleWarmupTablesLoaded(Serial);
+}
+
+void UContentLookupSubsystem::CancelWarmup()
+{
+	// Bumping the serial turns callbacks of the previous warmup into no-ops.
+	++WarmupSerial;
+	bWarmupComplete = false;
+
+	if (WarmupTablesHandle.IsValid())
+	{
+		if (WarmupTablesHandle->IsLoadingInProgress())
+		{
+			WarmupTablesHandle->CancelHandle();
+		}
+		else
+		{
+			WarmupTablesHandle->ReleaseHandle();
+		}
+		WarmupTablesHandle.Reset();
+	}
+	if (WarmupSoftReferencesHandle.IsValid())
+	{
+		WarmupSoftReferencesHandle->ReleaseHandle();
+		WarmupSoftReferencesHandle.Reset();
+	}
+}
+
+void UContentLookupSubsystem::HandleWarmupTablesLoaded(const uint32 Serial)
+{
+	if (Serial != WarmupSerial)
+	{
+		return;
+	}
+
+	const UARContentLookupSettings* Settings = GetDefault<UARContentLookupSettings>();
+	TSet<FSoftObjectPath> SoftReferences;
+	for (int32 RouteIndex = 0; RouteIndex < IndexedRoutes.Num(); ++RouteIndex)
+	{
+		const FContentLookupIndexedRoute& Route = IndexedRoutes[RouteIndex];
+		const bool bGatherSoftReferences = Settings && Settings->WarmupSoftReferenceRootTags.HasTagExact(Route.RootTag);
+		if (Route.PackRouteIndex != INDEX_NONE)
+		{
+			// Pack routes have no table to stream; their rows are only materialized when soft references are wanted.
+			if (bGatherSoftReferences && BindIndexedRoute(RouteIndex))
+			{
+				for (const FGameplayTag& Tag : Route.Tags)
+				{
+					FName RowName;
+					const uint8* RowData = nullptr;
+					const UScriptStruct* RowStruct = nullptr;
+					const UObject* RowOwner = nullptr;
+					if (FindIndexedRow(Tag, RowName, RowData, RowStruct, RowOwner))
+					{
+						GatherRowSoftReferences(RowStruct, RowData, SoftReferences);
+					}
+				}
+			}
+			continue;
+		}
+
+		UDataTable* Table = Route.DataTable.Get();
+		if (!Table)
+		{
+			UE_LOG(ARLog, Warning, TEXT("[ContentLookup] Warmup could not stream DataTable '%s' for route '%s'."),
+				*Route.DataTable.ToSoftObjectPath().ToString(), *Route.RootTag.ToString());
+			continue;
+		}
+
+		LoadedTables.Add(Route.RootTag, Table);
+		if (bGatherSoftReferences)
+		{
+			for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+			{
+				GatherRowSoftReferences(Table->GetRowStruct(), Row.Value, SoftReferences);
+			}
+		}
+	}
+
+	// LoadedTables now keeps the tables resident.
+	if (WarmupTablesHandle.IsValid())
+	{
+		WarmupTablesHandle->ReleaseHandle();
+		WarmupTablesHandle.Reset();
+	}
+
+	if (SoftReferences.Num() > 0)
+	{
+		UE_LOG(ARLog, Log, TEXT("[ContentLookup] Warmup tables ready; streaming %d row soft references."), SoftReferences.Num());
+		FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+		WarmupSoftReferencesHandle = Streamable.RequestAsyncLoad(
+			SoftReferences.Array(),
+			FStreamableDelegate::CreateUObject(this, &UContentLookupSubsystem::HandleWarmupSoftReferencesLoaded, Serial));
+		if (WarmupSoftReferencesHandle.IsValid())
+		{
+			return;
+		}
+	}
+
+	FinishWarmup();
+}
+
+void UContentLookupSubsystem::HandleWarmupSoftReferencesLoaded(const uint32 Serial)
+{
+	if (Serial != WarmupSerial)
+	{
+		return;
+	}
+
+	FinishWarmup();
+}
+
+void UContentLookupSubsystem::FinishWarmup()
+{
+	bWarmupComplete = true;
+	UE_LOG(ARLog, Log, TEXT("[ContentLookup] Warmup complete (%d tables resident, %d sync table loads so far)."),
+		LoadedTables.Num(), SyncTableLoadCount);
+	OnWarmupCompleted.Broadcast();
+}
+
+void UContentLookupSubsystem::ResetTagIndex()
+{
+	for (int32 RouteIndex = 0; RouteIndex < IndexedRoutes.Num(); ++RouteIndex)
+	{
+		UnbindIndexedRoute(RouteIndex);
+	}
+
+	TagIndex.Reset();
+	RouteIndexByRoot.Reset();
+	IndexedRoutes.Reset();
+	IndexedRegistry.Reset();
+	ReleasePackRows();
+	PackRowStructs.Reset();
+	bTagIndexBuilt = false;
+	++ContentSerial;
+}
+
+void UContentLookupSubsystem::EnsureTagIndex()
+{
+	UContentLookupRegistry* Active = GetActiveRegistry();
+	if (!bTagIndexBuilt || IndexedRegistry.Get() != Active)
+	{
+		RebuildTagIndex();
+	}
+}
+
+uint32 UContentLookupSubsystem::GetContentSerial()
+{
+	EnsureTagIndex();
+	return ContentSerial;
+}
+
+void UContentLookupSubsystem::RebuildTagIndex()
+{
+	ResetTagIndex();
+	bTagIndexBuilt = true;
+
+	UContentLookupRegistry* Active = GetActiveRegistry();
+	IndexedRegistry = Active;
+	if (!Active)
+	{
+		return;
+	}
+
+	// First route wins for duplicate roots, same as the previous linear scan.
+	TArray<int32> RouteDepths;
+	for (const FContentLookupRoute& Route : Active->Routes)
+	{
+		if (!Route.RootTag.IsValid() || RouteIndexByRoot.Contains(Route.RootTag))
+		{
+			continue;
+		}
+
+		const int32 RouteIndex = IndexedRoutes.AddDefaulted();
+		FContentLookupIndexedRoute& Indexed = IndexedRoutes[RouteIndex];
+		Indexed.RootTag = Route.RootTag;
+		Indexed.DataTable = Route.DataTable;
+		RouteIndexByRoot.Add(Route.RootTag, RouteIndex);
+
+		if (ContentPack)
+		{
+			const int32 PackRoute = ContentPack->FindRoute(Route.RootTag);
+			if (PackRoute != INDEX_NONE && ContentPack->GetRouteTablePath(PackRoute) == Route.DataTable.ToSoftObjectPath().ToString())
+			{
+				Indexed.PackRouteIndex = PackRoute;
+			}
+			else if (PackRoute != INDEX_NONE)
+			{
+				UE_LOG(ARLog, Warning, TEXT("[ContentLookup] Content pack route '%s' was baked from '%s' but the registry routes to '%s'; using the DataTable."),
+					*Route.RootTag.ToString(), *ContentPack->GetRouteTablePath(PackRoute), *Route.DataTable.ToSoftObjectPath().ToString());
+			}
+		}
+		RouteDepths.Add(Route.RootTag.GetGameplayTagParents().Num());
+	}
+
+	// Index shallow roots first so deeper roots overwrite their ancestors' entries (most specific route wins).
+	TArray<int32> RouteOrder;
+	RouteOrder.Reserve(IndexedRoutes.Num());
+	for (int32 RouteIndex = 0; RouteIndex < IndexedRoutes.Num(); ++RouteIndex)
+	{
+		RouteOrder.Add(RouteIndex);
+	}
+	RouteOrder.StableSort([&RouteDepths](int32 A, int32 B)
+	{
+		return RouteDepths[A] < RouteDepths[B];
+	});
+
+	UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+	for (const int32 RouteIndex : RouteOrder)
+	{
+		const FGameplayTag RootTag = IndexedRoutes[RouteIndex].RootTag;
+		auto IndexTag = [this, RouteIndex](const FGameplayTag& Tag)
+		{
+			FContentLookupTagIndexEntry& Entry = TagIndex.FindOrAdd(Tag);
+			Entry.RouteIndex = RouteIndex;
+			Entry.RowName = GetLeafRowNameFromTag(Tag);
+			Entry.RowData = nullptr;
+			Entry.PackRowIndex = INDEX_NONE;
+		};
+
+		IndexTag(RootTag);
+		const FGameplayTagContainer Children = TagsManager.RequestGameplayTagChildren(RootTag);
+		for (const FGameplayTag& Child : Children)
+		{
+			IndexTag(Child);
+		}
+	}
+
+	for (const TPair<FGameplayTag, FContentLookupTagIndexEntry>& Pair : TagIndex)
+	{
+		IndexedRoutes[Pair.Value.RouteIndex].Tags.Add(Pair.Key);
+	}
+
+	UE_LOG(ARLog, Verbose, TEXT("[ContentLookup] Tag index rebuilt: %d tags across %d routes (Registry=%s)."),
+		TagIndex.Num(), IndexedRoutes.Num(), *GetNameSafe(Active));
+}
+
+bool UContentLookupSubsystem::BindIndexedRoute(const int32 RouteIndex)
+{
+	if (!IndexedRoutes.IsValidIndex(RouteIndex))
+	{
+		return false;
+	}
+
+	FContentLookupIndexedRoute& Route = IndexedRoutes[RouteIndex];
+	if (Route.PackRouteIndex != INDEX_NONE && ContentPack)
+	{
+		const FString RowStructPath = ContentPack->GetRouteRowStructPath(Route.PackRouteIndex);
+		UScriptStruct* RowStruct = LoadObject<UScriptStruct>(nullptr, *RowStructPath);
+		if (!RowStruct)
+		{
+			UE_LOG(ARLog, Warning, TEXT("[ContentLookup] Content pack row struct '%s' for route '%s' is missing; using the DataTable."),
+				*RowStructPath, *Route.RootTag.ToString());
+			Route.PackRouteIndex = INDEX_NONE;
+			return BindIndexedRoute(RouteIndex);
+		}
+
+		UnbindIndexedRoute(RouteIndex);
+		PackRowStructs.AddUnique(RowStruct);
+		for (const FGameplayTag& Tag : Route.Tags)
+		{
+			if (FContentLookupTagIndexEntry* Entry = TagIndex.Find(Tag))
+			{
+				Entry->PackRowIndex = ContentPack->FindRow(Route.PackRouteIndex, Entry->RowName);
+			}
+		}
+		Route.RowStruct = RowStruct;
+		Route.RowOwner = this;
+		Route.bBound = true;
+		return true;
+	}
+
+	UDataTable* Table = nullptr;
+	if (TObjectPtr<UDataTable>* Cached = LoadedTables.Find(Route.RootTag))
+	{
+		Table = Cached->Get();
+	}
+	if (!Table)
+	{
+		FString LoadError;
+		Table = LoadAndCacheTable(Route.RootTag, Route.DataTable, LoadError);
+		if (!Table)
+		{
+			return false;
+		}
+	}
+
+	UnbindIndexedRoute(RouteIndex);
+	for (const FGameplayTag& Tag : Route.Tags)
+	{
+		if (FContentLookupTagIndexEntry* Entry = TagIndex.Find(Tag))
+		{
+			Entry->RowData = Table->FindRowUnchecked(Entry->RowName);
+		}
+	}
+	Route.BoundTable = Table;
+	Route.RowStruct = Table->GetRowStruct();
+	Route.RowOwner = Table;
+	Route.bBound = true;
+
+#if WITH_EDITOR
+	// Reimport/row edits reallocate RowMap memory; drop the bound pointers and rebind on next lookup.
+	Route.TableChangedHandle = Table->OnDataTableChanged().AddUObject(this, &UContentLookupSubsystem::HandleIndexedTableChanged, RouteIndex);
+#endif
+	return true;
+}
+
+void UContentLookupSubsystem::UnbindIndexedRoute(const int32 RouteIndex)
+{
+	if (!IndexedRoutes.IsValidIndex(RouteIndex))
+	{
+		return;
+	}
+
+	FContentLookupIndexedRoute& Route = IndexedRoutes[RouteIndex];
+#if WITH_EDITOR
+	if (UDataTable* Table = Route.BoundTable.Get())
+	{
+		Table->OnDataTableChanged().Remove(Route.TableChangedHandle);
+	}
+	Route.TableChangedHandle.Reset();
+#endif
+
+	for (const FGameplayTag& Tag : Route.Tags)
+	{
+		if (FContentLookupTagIndexEntry* Entry = TagIndex.Find(Tag))
+		{
+			Entry->RowData = nullptr;
+			Entry->PackRowIndex = INDEX_NONE;
+		}
+	}
+	Route.BoundTable.Reset();
+	Route.RowOwner.Reset();
+	Route.RowStruct = nullptr;
+	Route.bBound = false;
+}
+
+#if WITH_EDITOR
+void UContentLookupSubsystem::HandleIndexedTableChanged(const int32 RouteIndex)
+{
+	UnbindIndexedRoute(RouteIndex);
+	++ContentSerial;
+}
+#endif
+
+bool UContentLookupSubsystem::FindIndexedRow(
+	FGameplayTag Tag,
+	FName& OutRowName,
+	const uint8*& OutRowData,
+	const UScriptStruct*& OutRowStruct,
+	const UObject*& OutRowOwner)
+{
+	EnsureTagIndex();
+
+	FContentLookupTagIndexEntry* Entry = TagIndex.Find(Tag);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	FContentLookupIndexedRoute& Route = IndexedRoutes[Entry->RouteIndex];
+	const UObject* Owner = Route.RowOwner.Get();
+	if (!Route.bBound || !Owner)
+	{
+		if (!BindIndexedRoute(Entry->RouteIndex))
+		{
+			return false;
+		}
+		Owner = Route.RowOwner.Get();
+	}
+
+	if (!Entry->RowData && Entry->PackRowIndex != INDEX_NONE)
+	{
+		Entry->RowData = MaterializePackRow(Entry->PackRowIndex, Route.RowStruct);
+	}
+
+	OutRowName = Entry->RowName;
+	OutRowData = Entry->RowData;
+	OutRowStruct = Route.RowStruct;
+	OutRowOwner = Owner;
+	return Owner != nullptr;
 }
 
 FName UContentLookupSubsystem::GetLeafRowNameFromTag(FGameplayTag Tag)
@@ -125,8 +660,26 @@ bool UContentLookupSubsystem::DoesRowExistForTag(FGameplayTag Tag, FString& OutE
 {
 	OutError.Reset();
 
-	UDataTable* DT = nullptr;
 	FName RowName = NAME_None;
+	const uint8* IndexedRow = nullptr;
+	const UScriptStruct* RowStruct = nullptr;
+	const UObject* RowOwner = nullptr;
+	if (FindIndexedRow(Tag, RowName, IndexedRow, RowStruct, RowOwner))
+	{
+		if (IndexedRow)
+		{
+			return true;
+		}
+
+		OutError = FString::Printf(TEXT("Row '%s' not found in '%s' for tag '%s'."),
+			*RowName.ToString(),
+			*GetNameSafe(RowOwner),
+			*Tag.ToString());
+		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] %s"), *OutError);
+		return false;
+	}
+
+	UDataTable* DT = nullptr;
 	if (!GetTableAndRowNameFromTag(Tag, DT, RowName, OutError))
 	{
 		return false;
@@ -201,19 +754,30 @@ bool UContentLookupSubsystem::GetAllRowNamesForRootTag(FGameplayTag RootTag, TAr
 	OutRowNames.Reset();
 	OutError.Reset();
 
-	UDataTable* Table = nullptr;
-	if (!GetDataTableForRootTag(RootTag, Table, OutError))
+	// Pack-served routes answer from the pack's row index without loading the table.
+	EnsureTagIndex();
+	const int32* PackedRoute = RouteIndexByRoot.Find(RootTag);
+	if (ContentPack && PackedRoute && IndexedRoutes[*PackedRoute].PackRouteIndex != INDEX_NONE)
 	{
-		return false;
+		ContentPack->GetRouteRowNames(IndexedRoutes[*PackedRoute].PackRouteIndex, OutRowNames);
 	}
-
-	if (!Table)
+	else
 	{
-		OutError = FString::Printf(TEXT("Resolved null table for root '%s'."), *RootTag.ToString());
-		return false;
+		UDataTable* Table = nullptr;
+		if (!GetDataTableForRootTag(RootTag, Table, OutError))
+		{
+			return false;
+		}
+
+		if (!Table)
+		{
+			OutError = FString::Printf(TEXT("Resolved null table for root '%s'."), *RootTag.ToString());
+			return false;
+		}
+
+		OutRowNames = Table->GetRowNames();
 	}
 
-	OutRowNames = Table->GetRowNames();
 	OutRowNames.Sort([](const FName& A, const FName& B)
 	{
 		return A.ToString() < B.ToString();
@@ -242,24 +806,25 @@ bool UContentLookupSubsystem::GetDataTableForRootTag(
 		return false;
 	}
 
-	const FContentLookupRoute* FoundRoute = nullptr;
-	for (const FContentLookupRoute& Route : Active->Routes)
+	EnsureTagIndex();
+	const int32* RouteIndex = RouteIndexByRoot.Find(RootTag);
+	if (!RouteIndex)
 	{
-		if (Route.RootTag == RootTag)
-		{
-			FoundRoute = &Route;
-			break;
-		}
+		OutError = FString::Printf(TEXT("No route found for root tag '%s'."), *RootTag.ToString());
+		return false;
 	}
 
-	if (!FoundRoute)
+	if (TObjectPtr<UDataTable>* Cached = LoadedTables.Find(RootTag))
 	{
-		OutError = FString::Printf(TEXT("No route found for root tag '%s'."), *RootTag.ToString());
-		return false;
+		OutDataTable = Cached->Get();
+		if (OutDataTable)
+		{
+			return true;
+		}
 	}
 
 	FString LoadError;
-	OutDataTable = LoadAndCacheTable(RootTag, FoundRoute->DataTable, LoadError);
+	OutDataTable = LoadAndCacheTable(RootTag, IndexedRoutes[*RouteIndex].DataTable, LoadError);
 	if (!OutDataTable)
 	{
 		OutError = FString::Printf(TEXT("Failed to load table for root '%s': %s"), *RootTag.ToString(), *LoadError);
@@ -378,27 +943,17 @@ UDataTable* UContentLookupSubsystem::ResolveTableForTag(FGameplayTag Tag, FGamep
 		return nullptr;
 	}
 
-	// Best-match strategy: pick the most specific (longest) matching RootTag.
+	// Best-match strategy: pick the most specific matching RootTag by walking up the tag hierarchy.
 	// Example: if you ever had both Unlocks and Unlocks.Ships, choose Unlocks.Ships.
-	int32 BestLen = -1;
-	const FContentLookupRoute* BestRoute = nullptr;
-
-	for (const FContentLookupRoute& Route : Active->Routes)
+	EnsureTagIndex();
+	const FContentLookupIndexedRoute* BestRoute = nullptr;
+	for (FGameplayTag Candidate = Tag; Candidate.IsValid(); Candidate = Candidate.RequestDirectParent())
 	{
-		if (!Route.RootTag.IsValid())
-		{
-			continue;
-		}
-
-		if (Tag.MatchesTag(Route.RootTag))
+		if (const int32* RouteIndex = RouteIndexByRoot.Find(Candidate))
 		{
-			const int32 Len = Route.RootTag.ToString().Len();
-			if (Len > BestLen)
-			{
-				BestLen = Len;
-				BestRoute = &Route;
-				OutMatchedRoot = Route.RootTag;
-			}
+			BestRoute = &IndexedRoutes[*RouteIndex];
+			OutMatchedRoot = Candidate;
+			break;
 		}
 	}
 
@@ -429,7 +984,22 @@ UDataTable* UContentLookupSubsystem::LoadAndCacheTable(const FGameplayTag& RootT
 		return nullptr;
 	}
 
-	UDataTable* DT = TableRef.LoadSynchronous();
+	UDataTable* DT = TableRef.Get();
+	if (!DT)
+	{
+		// Anything reaching here missed warmup (or ran before it finished) and stalls the game thread.
+		++SyncTableLoadCount;
+		const UARContentLookupSettings* Settings = GetDefault<UARContentLookupSettings>();
+		if (!Settings || Settings->bReportSyncTableLoads)
+		{
+			UE_LOG(ARLog, Warning, TEXT("[ContentLookup] Sync-loading DataTable '%s' for route '%s' (warmup %s)."),
+				*TableRef.ToSoftObjectPath().ToString(),
+				*RootTag.ToString(),
+				bWarmupComplete ? TEXT("complete") : TEXT("pending"));
+		}
+		DT = TableRef.LoadSynchronous();
+	}
+
 	if (!DT)
 	{
 		OutError = FString::Printf(TEXT("Failed to load DataTable for route '%s'."), *RootTag.ToString());
@@ -441,77 +1011,83 @@ UDataTable* UContentLookupSubsystem::LoadAndCacheTable(const FGameplayTag& RootT
 	return DT;
 }
 
-bool UContentLookupSubsystem::LookupWithGameplayTag(
+const uint8* UContentLookupSubsystem::FindRowDataByTag(
 	FGameplayTag Tag,
-	FInstancedStruct& OutRow,
+	const UScriptStruct*& OutRowStruct,
+	const UObject*& OutRowOwner,
 	FString& OutError
 )
 {
-	OutRow.Reset();
+	OutRowStruct = nullptr;
+	OutRowOwner = nullptr;
 	OutError.Reset();
 
-	UDataTable* DT = nullptr;
 	FName RowName = NAME_None;
+	const uint8* RowData = nullptr;
+	const UScriptStruct* RowStruct = nullptr;
+	const UObject* RowOwner = nullptr;
 
-	if (!GetTableAndRowNameFromTag(Tag, DT, RowName, OutError))
+	// Index hit: row source and row memory are already resolved.
+	if (!FindIndexedRow(Tag, RowName, RowData, RowStruct, RowOwner))
 	{
-		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] LookupWithGameplayTag failed for '%s': %s"), *Tag.ToString(), *OutError);
-		return false;
+		UDataTable* DT = nullptr;
+		if (!GetTableAndRowNameFromTag(Tag, DT, RowName, OutError))
+		{
+			UE_LOG(ARLog, Warning, TEXT("[ContentLookup] FindRowDataByTag failed for '%s': %s"), *Tag.ToString(), *OutError);
+			return nullptr;
+		}
+
+		RowOwner = DT;
+		RowStruct = DT ? DT->GetRowStruct() : nullptr;
+		RowData = DT ? DT->FindRowUnchecked(RowName) : nullptr;
 	}
 
-	if (!DT)
+	if (!RowOwner)
 	{
-		OutError = FString::Printf(TEXT("Resolved DataTable is null for tag '%s'."), *Tag.ToString());
+		OutError = FString::Printf(TEXT("Resolved row source is null for tag '%s'."), *Tag.ToString());
 		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] %s"), *OutError);
-		return false;
+		return nullptr;
 	}
 
-	const UScriptStruct* RowStruct = DT->GetRowStruct();
 	if (!RowStruct)
 	{
-		OutError = FString::Printf(TEXT("DataTable '%s' has no RowStruct (tag '%s')."), *GetNameSafe(DT), *Tag.ToString());
+		OutError = FString::Printf(TEXT("'%s' has no RowStruct (tag '%s')."), *GetNameSafe(RowOwner), *Tag.ToString());
 		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] %s"), *OutError);
-		return false;
+		return nullptr;
 	}
 
-	// Find the row as raw memory.
-	// Using FindRow() is the most compatible approach.
-	static const FString Context(TEXT("ContentLookupSubsystem::LookupWithGameplayTag"));
-	const uint8* RowData = DT->FindRowUnchecked(RowName);
-
-	// If FindRowUnchecked isn't available in your build, comment the line above and uncomment this:
-	// const uint8* RowData = reinterpret_cast<const uint8*>(DT->FindRow<uint8>(RowName, Context, /*bWarnIfMissing*/ false));
-
-	// More universally safe fallback (no template gymnastics):
 	if (!RowData)
 	{
-		// FindRowUnchecked can return null if missing. Validate the row exists.
-		if (!DT->GetRowMap().Contains(RowName))
-		{
-			OutError = FString::Printf(TEXT("Row '%s' not found in DataTable '%s' for tag '%s'."),
-				*RowName.ToString(),
-				*GetNameSafe(DT),
-				*Tag.ToString());
-			UE_LOG(ARLog, Warning, TEXT("[ContentLookup] %s"), *OutError);
-			return false;
-		}
-
-		// Get raw pointer from row map
-		const uint8* const* RowPtr = DT->GetRowMap().Find(RowName);
-		RowData = RowPtr ? *RowPtr : nullptr;
+		OutError = FString::Printf(TEXT("Row '%s' not found in '%s' for tag '%s'."),
+			*RowName.ToString(),
+			*GetNameSafe(RowOwner),
+			*Tag.ToString());
+		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] %s"), *OutError);
+		return nullptr;
 	}
 
+	OutRowStruct = RowStruct;
+	OutRowOwner = RowOwner;
+	return RowData;
+}
+
+bool UContentLookupSubsystem::LookupWithGameplayTag(
+	FGameplayTag Tag,
+	FInstancedStruct& OutRow,
+	FString& OutError
+)
+{
+	OutRow.Reset();
+
+	const UScriptStruct* RowStruct = nullptr;
+	const UObject* RowOwner = nullptr;
+	const uint8* RowData = FindRowDataByTag(Tag, RowStruct, RowOwner, OutError);
 	if (!RowData)
 	{
-		OutError = FString::Printf(TEXT("Row '%s' could not be resolved in DataTable '%s' for tag '%s'."),
-			*RowName.ToString(),
-			*GetNameSafe(DT),
-			*Tag.ToString());
-		UE_LOG(ARLog, Warning, TEXT("[ContentLookup] %s"), *OutError);
 		return false;
 	}
 
-	// Copy the row into an InstancedStruct
+	// Copy the row into an InstancedStruct (Blueprint-facing; native callers should prefer FindRowViewByTag).
 	OutRow.InitializeAs(RowStruct);
 	void* Dest = OutRow.GetMutableMemory();
 	check(Dest);
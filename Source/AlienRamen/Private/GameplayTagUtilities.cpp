@@ -1,115 +1,151 @@
 #include "GameplayTagUtilities.h"
+#include "Algo/Reverse.h"
 #include "GameplayTagsManager.h"
+#include "Misc/ScopeRWLock.h"
 
-static FString JoinParts(const TArray<FString>& Parts, int32 NumParts)
+namespace GameplayTagUtilitiesInternal
 {
-	FString Out;
-	for (int32 i = 0; i < NumParts; ++i)
+	struct FTagHierarchyEntry
 	{
-		if (i > 0) Out += TEXT(".");
-		Out += Parts[i];
-	}
-	return Out;
-}
-
-bool UGameplayTagUtilities::SplitTagToParts(FGameplayTag Tag, TArray<FString>& OutParts)
-{
-	OutParts.Reset();
+		// Top-level tag first, ending with the tag itself; Num() is the depth.
+		TArray<FGameplayTag> Prefixes;
+		TArray<FGameplayTag> DirectChildren;
+		// Tag tree rebuilds (editor tag edits) replace every node, which expires this and forces a rebuild.
+		TWeakPtr<FGameplayTagNode> Node;
+	};
+
+	struct FTagHierarchyCache
+	{
+		FRWLock Lock;
+		TMap<FGameplayTag, FTagHierarchyEntry> Entries;
+	};
 
-	if (!Tag.IsValid())
+	static FTagHierarchyCache& GetCache()
 	{
-		return false;
+		static FTagHierarchyCache Cache;
+		return Cache;
 	}
 
-	const FString TagStr = Tag.ToString();
-	if (TagStr.IsEmpty())
+	static bool BuildEntry(const FGameplayTag Tag, FTagHierarchyEntry& OutEntry)
 	{
-		return false;
-	}
+		const TSharedPtr<FGameplayTagNode> Node = UGameplayTagsManager::Get().FindTagNode(Tag);
+		if (!Node.IsValid())
+		{
+			return false;
+		}
 
-	TagStr.ParseIntoArray(OutParts, TEXT("."), true);
-	return OutParts.Num() > 0;
-}
+		// The tree root has no tag of its own, so the walk stops below it.
+		for (const FGameplayTagNode* It = Node.Get(); It && It->GetCompleteTag().IsValid(); It = It->GetParentTagNode())
+		{
+			OutEntry.Prefixes.Add(It->GetCompleteTag());
+		}
+		Algo::Reverse(OutEntry.Prefixes);
 
-bool UGameplayTagUtilities::TryMakeTagFromParts(const TArray<FString>& Parts, int32 NumParts, FGameplayTag& OutTag)
-{
-	OutTag = FGameplayTag();
+		for (const TSharedPtr<FGameplayTagNode>& Child : Node->GetChildTagNodes())
+		{
+			if (Child.IsValid())
+			{
+				OutEntry.DirectChildren.Add(Child->GetCompleteTag());
+			}
+		}
+		OutEntry.Node = Node;
+		return OutEntry.Prefixes.Num() > 0;
+	}
 
-	if (NumParts <= 0 || NumParts > Parts.Num())
+	// Runs Visitor on Tag's cached entry, building it on first use. Returns false for unknown tags.
+	template <typename VisitorType>
+	static bool VisitEntry(const FGameplayTag Tag, VisitorType&& Visitor)
 	{
-		return false;
-	}
+		if (!Tag.IsValid())
+		{
+			return false;
+		}
+
+		FTagHierarchyCache& Cache = GetCache();
+		{
+			FReadScopeLock ReadLock(Cache.Lock);
+			const FTagHierarchyEntry* Entry = Cache.Entries.Find(Tag);
+			if (Entry && Entry->Node.IsValid())
+			{
+				Visitor(*Entry);
+				return true;
+			}
+		}
 
-	const FString Wanted = JoinParts(Parts, NumParts);
+		FTagHierarchyEntry Built;
+		if (!BuildEntry(Tag, Built))
+		{
+			return false;
+		}
 
-	// "false" here means: don't crash/assert if missing.
-	// If tag doesn't exist in your project settings, this returns invalid.
-	OutTag = UGameplayTagsManager::Get().RequestGameplayTag(FName(*Wanted), false);
-	return OutTag.IsValid();
+		FWriteScopeLock WriteLock(Cache.Lock);
+		Visitor(Cache.Entries.Add(Tag, MoveTemp(Built)));
+		return true;
+	}
 }
 
 int32 UGameplayTagUtilities::GetTagDepth(FGameplayTag Tag)
 {
-	TArray<FString> Parts;
-	if (!SplitTagToParts(Tag, Parts)) return 0;
-	return Parts.Num();
+	int32 Depth = 0;
+	GameplayTagUtilitiesInternal::VisitEntry(Tag, [&Depth](const GameplayTagUtilitiesInternal::FTagHierarchyEntry& Entry)
+	{
+		Depth = Entry.Prefixes.Num();
+	});
+	return Depth;
 }
 
 bool UGameplayTagUtilities::TryGetParentTag(FGameplayTag Tag, FGameplayTag& OutParent)
 {
-	TArray<FString> Parts;
-	if (!SplitTagToParts(Tag, Parts)) return false;
-	if (Parts.Num() < 2) return false;
-
-	return TryMakeTagFromParts(Parts, Parts.Num() - 1, OutParent);
+	return TryGetAncestorTag(Tag, 1, OutParent);
 }
 
 bool UGameplayTagUtilities::TryGetAncestorTag(FGameplayTag Tag, int32 UpLevels, FGameplayTag& OutAncestor)
 {
-	TArray<FString> Parts;
-	if (!SplitTagToParts(Tag, Parts)) return false;
+	OutAncestor = FGameplayTag();
 	if (UpLevels <= 0) return false;
 
-	const int32 WantedParts = Parts.Num() - UpLevels;
-	if (WantedParts < 1) return false;
-
-	return TryMakeTagFromParts(Parts, WantedParts, OutAncestor);
+	GameplayTagUtilitiesInternal::VisitEntry(Tag, [&](const GameplayTagUtilitiesInternal::FTagHierarchyEntry& Entry)
+	{
+		const int32 WantedDepth = Entry.Prefixes.Num() - UpLevels;
+		if (WantedDepth >= 1)
+		{
+			OutAncestor = Entry.Prefixes[WantedDepth - 1];
+		}
+	});
+	return OutAncestor.IsValid();
 }
 
 bool UGameplayTagUtilities::TryGetTopLevelTag(FGameplayTag Tag, FGameplayTag& OutTopLevel)
 {
-	TArray<FString> Parts;
-	if (!SplitTagToParts(Tag, Parts)) return false;
-
-	return TryMakeTagFromParts(Parts, 1, OutTopLevel);
+	return TryGetTagAtDepth(Tag, 1, OutTopLevel);
 }
 
 bool UGameplayTagUtilities::TryGetTagAtDepth(FGameplayTag Tag, int32 Depth, FGameplayTag& OutTagAtDepth)
 {
-	TArray<FString> Parts;
-	if (!SplitTagToParts(Tag, Parts)) return false;
-
-	// Depth is 1..Parts.Num()
-	if (Depth < 1 || Depth > Parts.Num()) return false;
+	OutTagAtDepth = FGameplayTag();
 
-	return TryMakeTagFromParts(Parts, Depth, OutTagAtDepth);
+	// Depth is 1..GetTagDepth(Tag)
+	GameplayTagUtilitiesInternal::VisitEntry(Tag, [&](const GameplayTagUtilitiesInternal::FTagHierarchyEntry& Entry)
+	{
+		if (Depth >= 1 && Depth <= Entry.Prefixes.Num())
+		{
+			OutTagAtDepth = Entry.Prefixes[Depth - 1];
+		}
+	});
+	return OutTagAtDepth.IsValid();
 }
 
 bool UGameplayTagUtilities::TryGetAllPrefixTags(FGameplayTag Tag, FGameplayTagContainer& OutPrefixes)
 {
 	OutPrefixes.Reset();
 
-	TArray<FString> Parts;
-	if (!SplitTagToParts(Tag, Parts)) return false;
-
-	for (int32 Depth = 1; Depth <= Parts.Num(); ++Depth)
+	GameplayTagUtilitiesInternal::VisitEntry(Tag, [&OutPrefixes](const GameplayTagUtilitiesInternal::FTagHierarchyEntry& Entry)
 	{
-		FGameplayTag Prefix;
-		if (TryMakeTagFromParts(Parts, Depth, Prefix))
+		for (const FGameplayTag& Prefix : Entry.Prefixes)
 		{
 			OutPrefixes.AddTag(Prefix);
 		}
-	}
+	});
 
 	return OutPrefixes.Num() > 0;
 }
@@ -165,31 +201,11 @@ bool UGameplayTagUtilities::GetDirectChildrenOfTag(
 		return false; // invalid input
 	}
 
-	UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
-
-	// Get ALL descendants (subtree) of ParentTag
-	const FGameplayTagContainer Descendants = Manager.RequestGameplayTagChildren(ParentTag);
-
-	if (Descendants.IsEmpty())
-	{
-		return true; // valid input, just no children
-	}
-
-	const int32 ParentDepth = GetTagDepth(ParentTag);
-	TArray<FGameplayTag> All;
-	Descendants.GetGameplayTagArray(All);
-
-	// Filter to only tags that are exactly 1 level deeper than parent
-	for (const FGameplayTag& T : All)
+	// Unknown tags are valid input with no children, as before.
+	GameplayTagUtilitiesInternal::VisitEntry(ParentTag, [&OutDirectChildren](const GameplayTagUtilitiesInternal::FTagHierarchyEntry& Entry)
 	{
-		if (!T.IsValid()) continue;
-
-		const int32 Depth = GetTagDepth(T);
-		if (Depth == ParentDepth + 1)
-		{
-			OutDirectChildren.Add(T);
-		}
-	}
+		OutDirectChildren = Entry.DirectChildren;
+	});
 
 	bFoundAny = OutDirectChildren.Num() > 0;
 	if (bFoundAny)
@@ -202,89 +202,147 @@ FInstancedStruct UHelperLibrary::ExtractObjectToStructByName(UObject* Source, US
 }
 
 // -------------------------
-// Implementation
+// Field plans
 // -------------------------
 
-void UHelperLibrary::ExtractObjectToStructByName_Impl(
-	UObject* Source,
-	const UStruct* StructType,
-	void* StructPtr,
-	bool bEnableLog,
-	bool bResetStructToDefaults)
+// Precomputed (struct field, object field) pairs for one struct/class pairing and copy direction.
+// Name normalization and compatibility checks run once per pairing instead of once per call.
+struct FARReflectionFieldPlan
 {
-	if (!Source || !StructType || !StructPtr)
-	{
-		return;
-	}
-
-	UClass* SourceClass = Source->GetClass();
+	TWeakObjectPtr<const UStruct> StructType;
+	TWeakObjectPtr<const UClass> ObjectClass;
+	TArray<TPair<const FProperty*, const FProperty*>> Fields;
+};
 
-	DebugLog(bEnableLog, FString::Printf(TEXT("ExtractObjectToStructByName: Source=%s Class=%s Struct=%s"),
-		*GetNameSafe(Source),
-		*GetNameSafe(SourceClass),
-		*GetNameSafe(StructType)));
+using FARReflectionFieldPlanKey = TTuple<const UStruct*, const UClass*, bool>;
 
-	// Only needed when caller passes in an already-live struct buffer they want reset.
-	// For FInstancedStruct::InitializeAs, the memory is already constructed.
-	if (bResetStructToDefaults)
-	{
-		StructType->DestroyStruct(StructPtr);
-		StructType->InitializeStruct(StructPtr);
-	}
+static void BuildFieldPlan(const UStruct* StructType, const UClass* ObjectClass, bool bObjectToStruct, bool bEnableLog, FARReflectionFieldPlan& OutPlan)
+{
+	OutPlan.StructType = StructType;
+	OutPlan.ObjectClass = ObjectClass;
+	OutPlan.Fields.Reset();
 
-	// Map normalized name -> source candidates
-	TMultiMap<FString, FProperty*> SrcByName;
-	for (TFieldIterator<FProperty> It(SourceClass); It; ++It)
+	// Map normalized name -> object candidates
+	TMultiMap<FString, const FProperty*> ObjectByName;
+	for (TFieldIterator<FProperty> It(ObjectClass); It; ++It)
 	{
-		FProperty* P = *It;
+		const FProperty* P = *It;
 		if (!P) continue;
-		SrcByName.Add(NormalizePropNameKey(P), P);
+		ObjectByName.Add(NormalizePropNameKey(P), P);
 	}
 
-	// Iterate DEST (struct) properties, find matching SOURCE (object) properties.
 	for (TFieldIterator<FProperty> It(StructType); It; ++It)
 	{
-		FProperty* DstProp = *It;
-		if (!DstProp) continue;
+		const FProperty* StructProp = *It;
+		if (!StructProp) continue;
 
-		const FString DstKey = NormalizePropNameKey(DstProp);
-		const FName CleanName = CleanPropName(DstProp);
+		const FName CleanName = CleanPropName(StructProp);
 
-		TArray<FProperty*> Candidates;
-		SrcByName.MultiFind(DstKey, Candidates);
+		TArray<const FProperty*> Candidates;
+		ObjectByName.MultiFind(NormalizePropNameKey(StructProp), Candidates);
 
 		if (Candidates.Num() == 0)
 		{
-			DebugLog(bEnableLog, FString::Printf(TEXT("  MISSING ON SOURCE: %s"), *CleanName.ToString()));
+			DebugLog(bEnableLog, FString::Printf(TEXT("  %s: %s"),
+				bObjectToStruct ? TEXT("MISSING ON SOURCE") : TEXT("MISSING"), *CleanName.ToString()));
 			continue;
 		}
 
-		FProperty* BestSrc = nullptr;
-		for (FProperty* Cand : Candidates)
+		const FProperty* BestObjectProp = nullptr;
+		for (const FProperty* Cand : Candidates)
 		{
-			if (ArePropertiesCompatible(Cand, DstProp))
+			const bool bCompatible = bObjectToStruct
+				? ArePropertiesCompatible(Cand, StructProp)
+				: ArePropertiesCompatible(StructProp, Cand);
+			if (bCompatible)
 			{
-				BestSrc = Cand;
+				BestObjectProp = Cand;
 				break;
 			}
 		}
 
-		if (!BestSrc)
+		if (!BestObjectProp)
 		{
-			const FString SrcTypeName = Candidates[0] ? Candidates[0]->GetClass()->GetName() : TEXT("Unknown");
-			const FString DstTypeName = DstProp->GetClass()->GetName();
+			const FString ObjectTypeName = Candidates[0] ? Candidates[0]->GetClass()->GetName() : TEXT("Unknown");
+			const FString StructTypeName = StructProp->GetClass()->GetName();
 
 			DebugLog(bEnableLog, FString::Printf(TEXT("  TYPE MISMATCH: %s (Src=%s Dst=%s)"),
-				*CleanName.ToString(), *SrcTypeName, *DstTypeName));
+				*CleanName.ToString(),
+				bObjectToStruct ? *ObjectTypeName : *StructTypeName,
+				bObjectToStruct ? *StructTypeName : *ObjectTypeName));
 			continue;
 		}
 
-		const void* SrcValuePtr = BestSrc->ContainerPtrToValuePtr<void>(Source);
-		void* DstValuePtr = DstProp->ContainerPtrToValuePtr<void>(StructPtr);
+		OutPlan.Fields.Emplace(StructProp, BestObjectProp);
+		DebugLog(bEnableLog, FString::Printf(TEXT("  MAPPED: %s"), *CleanName.ToString()));
+	}
+}
+
+static const FARReflectionFieldPlan& FindOrBuildFieldPlan(const UStruct* StructType, const UClass* ObjectClass, bool bObjectToStruct, bool bEnableLog)
+{
+	// Plans are only cached on the game thread; other callers get a throwaway plan.
+	if (!IsInGameThread())
+	{
+		static thread_local FARReflectionFieldPlan ScratchPlan;
+		BuildFieldPlan(StructType, ObjectClass, bObjectToStruct, bEnableLog, ScratchPlan);
+		return ScratchPlan;
+	}
+
+	static TMap<FARReflectionFieldPlanKey, FARReflectionFieldPlan> PlanCache;
+
+	FARReflectionFieldPlan& Plan = PlanCache.FindOrAdd(FARReflectionFieldPlanKey(StructType, ObjectClass, bObjectToStruct));
+
+	// Weak pointers go stale when a type is GC'd (e.g. Blueprint recompile); a recycled address then rebuilds.
+	const bool bPlanValid = Plan.StructType.Get() == StructType && Plan.ObjectClass.Get() == ObjectClass;
+	if (!bPlanValid)
+	{
+		DebugLog(bEnableLog, FString::Printf(TEXT("Building field plan: Struct=%s Class=%s Direction=%s"),
+			*GetNameSafe(StructType),
+			*GetNameSafe(ObjectClass),
+			bObjectToStruct ? TEXT("ObjectToStruct") : TEXT("StructToObject")));
+		BuildFieldPlan(StructType, ObjectClass, bObjectToStruct, bEnableLog, Plan);
+	}
+
+	return Plan;
+}
+
+// -------------------------
+// Implementation
+// -------------------------
+
+void UHelperLibrary::ExtractObjectToStructByName_Impl(
+	UObject* Source,
+	const UStruct* StructType,
+	void* StructPtr,
+	bool bEnableLog,
+	bool bResetStructToDefaults)
+{
+	if (!Source || !StructType || !StructPtr)
+	{
+		return;
+	}
+
+	UClass* SourceClass = Source->GetClass();
+
+	DebugLog(bEnableLog, FString::Printf(TEXT("ExtractObjectToStructByName: Source=%s Class=%s Struct=%s"),
+		*GetNameSafe(Source),
+		*GetNameSafe(SourceClass),
+		*GetNameSafe(StructType)));
 
-		DstProp->CopyCompleteValue(DstValuePtr, SrcValuePtr);
+	// Only needed when caller passes in an already-live struct buffer they want reset.
+	// For FInstancedStruct::InitializeAs, the memory is already constructed.
+	if (bResetStructToDefaults)
+	{
+		StructType->DestroyStruct(StructPtr);
+		StructType->InitializeStruct(StructPtr);
+	}
 
-		DebugLog(bEnableLog, FString::Printf(TEXT("  COPIED: %s"), *CleanName.ToString()));
+	const FARReflectionFieldPlan& Plan = FindOrBuildFieldPlan(StructType, SourceClass, /*bObjectToStruct*/ true, bEnableLog);
+	for (const TPair<const FProperty*, const FProperty*>& Field : Plan.Fields)
+	{
+		const FProperty* DstProp = Field.Key;
+		const FProperty* SrcProp = Field.Value;
+		DstProp->CopyCompleteValue(DstProp->ContainerPtrToValuePtr<void>(StructPtr), SrcProp->ContainerPtrToValuePtr<void>(Source));
 	}
 }
 
@@ -306,57 +364,11 @@ void UHelperLibrary::ApplyStructToObjectByName_Impl(
 		*GetNameSafe(TargetClass),
 		*GetNameSafe(StructType)));
 
-	// Map normalized name -> destination candidates
-	TMultiMap<FString, FProperty*> DstByName;
-	for (TFieldIterator<FProperty> It(TargetClass); It; ++It)
-	{
-		FProperty* P = *It;
-		if (!P) continue;
-		DstByName.Add(NormalizePropNameKey(P), P);
-	}
-
-	for (TFieldIterator<FProperty> It(StructType); It; ++It)
+	const FARReflectionFieldPlan& Plan = FindOrBuildFieldPlan(StructType, TargetClass, /*bObjectToStruct*/ false, bEnableLog);
+	for (const TPair<const FProperty*, const FProperty*>& Field : Plan.Fields)
 	{
-		FProperty* SrcProp = *It;
-		if (!SrcProp) continue;
-
-		const FString SrcKey = NormalizePropNameKey(SrcProp);
-		const FName CleanName = CleanPropName(SrcProp);
-
-		TArray<FProperty*> Candidates;
-		DstByName.MultiFind(SrcKey, Candidates);
-
-		if (Candidates.Num() == 0)
-		{
-			DebugLog(bEnableLog, FString::Printf(TEXT("  MISSING: %s"), *CleanName.ToString()));
-			continue;
-		}
-
-		FProperty* BestDst = nullptr;
-		for (FProperty* Cand : Candidates)
-		{
-			if (ArePropertiesCompatible(SrcProp, Cand))
-			{
-				BestDst = Cand;
-				break;
-			}
-		}
-
-		if (!BestDst)
-		{
-			const FString SrcTypeName = SrcProp->GetClass()->GetName();
-			const FString DstTypeName = Candidates[0] ? Candidates[0]->GetClass()->GetName() : TEXT("Unknown");
-
-			DebugLog(bEnableLog, FString::Printf(TEXT("  TYPE MISMATCH: %s (Src=%s Dst=%s)"),
-				*CleanName.ToString(), *SrcTypeName, *DstTypeName));
-			continue;
-		}
-
-		const void* SrcValuePtr = SrcProp->ContainerPtrToValuePtr<void>(StructPtr);
-		void* DstValuePtr = BestDst->ContainerPtrToValuePtr<void>(Target);
-
-		BestDst->CopyCompleteValue(DstValuePtr, SrcValuePtr);
-
-		DebugLog(bEnableLog, FString::Printf(TEXT("  COPIED: %s"), *CleanName.ToString()));
+		const FProperty* SrcProp = Field.Key;
+		const FProperty* DstProp = Field.Value;
+		DstProp->CopyCompleteValue(DstProp->ContainerPtrToValuePtr<void>(Target), SrcProp->ContainerPtrToValuePtr<void>(StructPtr));
 	}
 }
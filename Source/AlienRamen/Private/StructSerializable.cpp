@@ -6,6 +6,93 @@
 #include "GameFramework/Actor.h"
 #include "UObject/UnrealType.h"
 
+namespace ARStructSerializableInternal
+{
+	using FAccessorKey = TPair<const UClass*, const UScriptStruct*>;
+
+	static TMap<FAccessorKey, FARStructStateAccessor>& GetAccessors()
+	{
+		static TMap<FAccessorKey, FARStructStateAccessor> Accessors;
+		return Accessors;
+	}
+
+	static TMap<TWeakObjectPtr<const UClass>, const FObjectProperty*>& GetStateStructPropertyCache()
+	{
+		static TMap<TWeakObjectPtr<const UClass>, const FObjectProperty*> Cache;
+		return Cache;
+	}
+
+	// Typed copy when the (class, struct) pair is registered, otherwise reflection by name.
+	static void ApplyStateStruct(UObject* Target, const FInstancedStruct& State)
+	{
+		if (const FARStructStateAccessor* Accessor = FARStructStateAccessorRegistry::Find(Target->GetClass(), State.GetScriptStruct()))
+		{
+			Accessor->Apply(*Target, State.GetMemory());
+			return;
+		}
+
+		UHelperLibrary::ApplyStructToObjectByName(Target, State);
+	}
+}
+
+void FARStructStateAccessorRegistry::Register(const UClass* OwnerClass, const UScriptStruct* StateStruct, const FARStructStateAccessor& Accessor)
+{
+	check(IsInGameThread());
+	if (!OwnerClass || !StateStruct || !Accessor.Extract || !Accessor.Apply)
+	{
+		return;
+	}
+
+	ARStructSerializableInternal::GetAccessors().Add(ARStructSerializableInternal::FAccessorKey(OwnerClass, StateStruct), Accessor);
+}
+
+const FARStructStateAccessor* FARStructStateAccessorRegistry::Find(const UClass* ObjectClass, const UScriptStruct* StateStruct)
+{
+	if (!StateStruct || !IsInGameThread())
+	{
+		return nullptr;
+	}
+
+	const TMap<ARStructSerializableInternal::FAccessorKey, FARStructStateAccessor>& Accessors = ARStructSerializableInternal::GetAccessors();
+	if (Accessors.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	for (const UClass* Class = ObjectClass; Class; Class = Class->GetSuperClass())
+	{
+		if (const FARStructStateAccessor* Accessor = Accessors.Find(ARStructSerializableInternal::FAccessorKey(Class, StateStruct)))
+		{
+			return Accessor;
+		}
+	}
+
+	return nullptr;
+}
+
+const FObjectProperty* FARStructStateAccessorRegistry::FindClassStateStructProperty(const UClass* ObjectClass)
+{
+	if (!ObjectClass)
+	{
+		return nullptr;
+	}
+
+	if (!IsInGameThread())
+	{
+		return FindFProperty<FObjectProperty>(ObjectClass, TEXT("ClassStateStruct"));
+	}
+
+	TMap<TWeakObjectPtr<const UClass>, const FObjectProperty*>& Cache = ARStructSerializableInternal::GetStateStructPropertyCache();
+	if (const FObjectProperty* const* Cached = Cache.Find(ObjectClass))
+	{
+		return *Cached;
+	}
+
+	const FObjectProperty* Property = FindFProperty<FObjectProperty>(ObjectClass, TEXT("ClassStateStruct"));
+	Cache.Add(ObjectClass, Property);
+	return Property;
+}
+
 void IStructSerializable::ExtractStateToStruct_Implementation(FInstancedStruct& CurrentState) const
 {
 	const UObject* SelfObject = _getUObject();
@@ -23,6 +110,17 @@ void IStructSerializable::ExtractStateToStruct_Implementation(FInstancedStruct&
 		return;
 	}
 
+	if (const FARStructStateAccessor* Accessor = FARStructStateAccessorRegistry::Find(SelfObject->GetClass(), StateStruct))
+	{
+		// Reuse the caller's buffer when it already holds this struct; typed extract overwrites every field.
+		if (CurrentState.GetScriptStruct() != StateStruct)
+		{
+			CurrentState.InitializeAs(StateStruct);
+		}
+		Accessor->Extract(*SelfObject, CurrentState.GetMutableMemory());
+		return;
+	}
+
 	CurrentState = UHelperLibrary::ExtractObjectToStructByName(const_cast<UObject*>(SelfObject), StateStruct);
 }
 
@@ -72,7 +170,7 @@ bool IStructSerializable::ApplyStateFromStruct_Implementation(const FInstancedSt
 				*GetNameSafe(ExpectedStruct),
 				*GetNameSafe(IncomingStruct));
 
-			UHelperLibrary::ApplyStructToObjectByName(SelfObject, SavedState);
+			ARStructSerializableInternal::ApplyStateStruct(SelfObject, SavedState);
 			return true;
 		}
 
@@ -84,7 +182,7 @@ bool IStructSerializable::ApplyStateFromStruct_Implementation(const FInstancedSt
 		return false;
 	}
 
-	UHelperLibrary::ApplyStructToObjectByName(SelfObject, SavedState);
+	ARStructSerializableInternal::ApplyStateStruct(SelfObject, SavedState);
 	return true;
 }
 
@@ -97,7 +195,7 @@ UScriptStruct* IStructSerializable::GetStateStruct_Implementation() const
 		return nullptr;
 	}
 
-	const FObjectProperty* StructProperty = FindFProperty<FObjectProperty>(SelfObject->GetClass(), TEXT("ClassStateStruct"));
+	const FObjectProperty* StructProperty = FARStructStateAccessorRegistry::FindClassStateStructProperty(SelfObject->GetClass());
 	if (!StructProperty)
 	{
 		UE_LOG(ARLog, Error,
@@ -0,0 +1,85 @@
+/**
+ * @file ARBenchmarkTestUtils.h
+ * @brief Preset lookup and timing helpers shared by the PerfFilter benchmark tests.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+namespace ARBenchmarkTestUtils
+{
+	/** Finds a preset by its Name (case-insensitive); presets are exposed as complex-test parameters. */
+	template <typename ScaleType, int32 PresetCount>
+	const ScaleType* FindPreset(const ScaleType (&Presets)[PresetCount], const FString& Name)
+	{
+		for (const ScaleType& Preset : Presets)
+		{
+			if (Name.Equals(Preset.Name, ESearchCase::IgnoreCase))
+			{
+				return &Preset;
+			}
+		}
+		return nullptr;
+	}
+
+	/** Samples of one measured path, in milliseconds. Bytes is optional payload size for reports. */
+	struct FTiming
+	{
+		FString Path;
+		TArray<double> SamplesMs;
+		int64 Bytes = 0;
+
+		double Total() const
+		{
+			double Sum = 0.0;
+			for (const double Sample : SamplesMs)
+			{
+				Sum += Sample;
+			}
+			return Sum;
+		}
+
+		double Min() const
+		{
+			double Value = TNumericLimits<double>::Max();
+			for (const double Sample : SamplesMs)
+			{
+				Value = FMath::Min(Value, Sample);
+			}
+			return SamplesMs.Num() > 0 ? Value : 0.0;
+		}
+
+		double Mean() const
+		{
+			return SamplesMs.Num() > 0 ? Total() / SamplesMs.Num() : 0.0;
+		}
+
+		double Median() const
+		{
+			if (SamplesMs.Num() == 0)
+			{
+				return 0.0;
+			}
+			TArray<double> Sorted = SamplesMs;
+			Sorted.Sort();
+			return Sorted[Sorted.Num() / 2];
+		}
+	};
+
+	/** Runs Body(Iteration) Iterations times, sampling each call separately. */
+	template <typename FuncType>
+	FTiming Measure(const TCHAR* Path, const int32 Iterations, FuncType&& Body)
+	{
+		FTiming Timing;
+		Timing.Path = Path;
+		Timing.SamplesMs.Reserve(Iterations);
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Body(Iteration);
+			Timing.SamplesMs.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+		}
+		return Timing;
+	}
+}
@@ -0,0 +1,104 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "ARContentPack.h"
+#include "ARInvaderTypes.h"
+#include "Engine/DataTable.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace ARContentPackTest
+{
+	static UDataTable* MakeEnemyTable()
+	{
+		UDataTable* Table = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+		Table->RowStruct = FARInvaderEnemyDefRow::StaticStruct();
+
+		for (int32 Index = 0; Index < 16; ++Index)
+		{
+			FARInvaderEnemyDefRow Row;
+			Row.bEnabled = (Index % 3) != 0;
+			Row.DisplayName = FText::FromString(FString::Printf(TEXT("Enemy %d"), Index));
+			Row.EnemyClass = TSoftClassPtr<AAREnemyBase>(FSoftObjectPath(FString::Printf(TEXT("/Game/Test/BP_Enemy_%d.BP_Enemy_%d_C"), Index, Index)));
+			Row.BaseSpiceKillValue = 1.0f + Index;
+			Row.RuntimeInit.MaxHealth = 50.0f * (Index + 1);
+			Table->AddRow(FName(*FString::Printf(TEXT("Enemy_%d"), Index)), Row);
+		}
+		return Table;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARContentPackRoundTripTest,
+	"AlienRamen.ContentLookup.ContentPack.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARContentPackRoundTripTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	const TStrongObjectPtr<UDataTable> Table(ARContentPackTest::MakeEnemyTable());
+	FARContentPackSourceRoute Source;
+	Source.RootTag = FGameplayTag::RequestGameplayTag(TEXT("Enemy.Identifier"), /*ErrorIfNotFound*/ false);
+	Source.TablePath = FSoftObjectPath(TEXT("/Game/Test/DT_TestEnemies.DT_TestEnemies"));
+	Source.Table = Table.Get();
+	if (!Source.RootTag.IsValid())
+	{
+		AddWarning(TEXT("Enemy.Identifier tag is not registered; skipping."));
+		return true;
+	}
+
+	TArray<uint8> Bytes;
+	FString Error;
+	if (!TestTrue(TEXT("Pack builds"), FARContentPack::Build(MakeArrayView(&Source, 1), Bytes, Error)))
+	{
+		AddError(Error);
+		return false;
+	}
+
+	FARContentPack Pack;
+	TArray<uint8> BytesCopy = Bytes;
+	if (!TestTrue(TEXT("Pack loads"), Pack.LoadFromMemory(MoveTemp(BytesCopy), Error)))
+	{
+		AddError(Error);
+		return false;
+	}
+
+	TArray<FString> Mismatches;
+	TestTrue(TEXT("Pack matches source table"), Pack.Verify(MakeArrayView(&Source, 1), Mismatches));
+	for (const FString& Mismatch : Mismatches)
+	{
+		AddError(Mismatch);
+	}
+
+	const int32 RouteIndex = Pack.FindRoute(Source.RootTag);
+	TestEqual(TEXT("Route found"), RouteIndex, 0);
+	TestTrue(TEXT("Existing row found"), Pack.FindRow(RouteIndex, TEXT("Enemy_7")) != INDEX_NONE);
+	TestTrue(TEXT("Row lookup is case-insensitive like FName"), Pack.FindRow(RouteIndex, TEXT("enemy_7")) != INDEX_NONE);
+	TestEqual(TEXT("Missing row not found"), Pack.FindRow(RouteIndex, TEXT("Enemy_99")), INDEX_NONE);
+
+	TArray<FName> RowNames;
+	Pack.GetRouteRowNames(RouteIndex, RowNames);
+	TestEqual(TEXT("All row names present"), RowNames.Num(), Table->GetRowMap().Num());
+
+	FARInvaderEnemyDefRow Loaded;
+	TestTrue(TEXT("Row deserializes"), Pack.DeserializeRow(Pack.FindRow(RouteIndex, TEXT("Enemy_7")), FARInvaderEnemyDefRow::StaticStruct(), &Loaded));
+	TestEqual(TEXT("Row payload survives"), Loaded.RuntimeInit.MaxHealth, 400.0f);
+	TestEqual(TEXT("Soft class path survives"), Loaded.EnemyClass.ToSoftObjectPath().ToString(), FString(TEXT("/Game/Test/BP_Enemy_7.BP_Enemy_7_C")));
+
+	// A source edit after baking must be caught by verification.
+	if (FARInvaderEnemyDefRow* Edited = Table->FindRow<FARInvaderEnemyDefRow>(TEXT("Enemy_3"), TEXT("ContentPackTest")))
+	{
+		Edited->BaseSpiceKillValue += 10.0f;
+	}
+	TestFalse(TEXT("Verification detects a stale pack"), Pack.Verify(MakeArrayView(&Source, 1), Mismatches));
+
+	// Corrupt header is rejected.
+	Bytes[0] ^= 0xFF;
+	FARContentPack Corrupt;
+	TestFalse(TEXT("Corrupt pack rejected"), Corrupt.LoadFromMemory(MoveTemp(Bytes), Error));
+	TestFalse(TEXT("Corrupt pack stays unloaded"), Corrupt.IsLoaded());
+	return true;
+}
+
+#endif
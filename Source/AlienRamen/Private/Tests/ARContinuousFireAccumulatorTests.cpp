@@ -0,0 +1,60 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "ARContinuousFireAbility.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARContinuousFireAccumulatorTest,
+	"AlienRamen.Ship.ContinuousFire.Accumulator",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARContinuousFireAccumulatorTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	// 8 shots/s with power-of-two step times keeps the arithmetic exact.
+	const float FireRate = 8.f;
+	const int32 MaxShots = 4;
+	const float Tolerance = KINDA_SMALL_NUMBER;
+
+	FARFireAccumulator Hold;
+	Hold.Begin(0.0, FireRate);
+	TestEqual(TEXT("First press fires immediately"), Hold.Step(0.0, FireRate, MaxShots), 1);
+	TestEqual(TEXT("Half a cadence later nothing is due"), Hold.Step(0.0625, FireRate, MaxShots), 0);
+	TestEqual(TEXT("A full cadence later one shot is due"), Hold.Step(0.125, FireRate, MaxShots), 1);
+
+	// Release and re-press half a cadence after the last shot: the rest of the cadence is waited out.
+	Hold.Begin(0.1875, FireRate);
+	TestEqual(TEXT("Re-press inside the cadence does not fire"), Hold.Step(0.1875, FireRate, MaxShots), 0);
+	TestEqual(TEXT("Re-press fires when the cadence completes"), Hold.Step(0.25, FireRate, MaxShots), 1);
+
+	Hold.Begin(10.0, FireRate);
+	TestEqual(TEXT("Re-press after a long pause fires immediately"), Hold.Step(10.0, FireRate, MaxShots), 1);
+
+	// A one-second hitch makes eight shots due; the step emits the cap and drops the rest.
+	FARFireAccumulator Hitch;
+	Hitch.Begin(0.0, FireRate);
+	Hitch.Step(0.0, FireRate, MaxShots);
+	TestEqual(TEXT("Hitch emits at most MaxShots"), Hitch.Step(1.0, FireRate, MaxShots), MaxShots);
+	TestEqual(TEXT("Backlog beyond the cap is dropped"), Hitch.Pending, 0.f, Tolerance);
+	TestEqual(TEXT("No burst follows the cap"), Hitch.Step(1.0625, FireRate, MaxShots), 0);
+	TestEqual(TEXT("Cadence resumes from the capped step"), Hitch.Step(1.125, FireRate, MaxShots), 1);
+
+	// 2.5 shots due: two are emitted, the newest came due half a shot ago and the older one a full cadence before it.
+	FARFireAccumulator Batch;
+	Batch.Begin(0.0, FireRate);
+	Batch.Step(0.0, FireRate, MaxShots);
+	if (TestEqual(TEXT("Step with 2.5 shots due emits two"), Batch.Step(0.3125, FireRate, MaxShots), 2))
+	{
+		TestEqual(TEXT("Oldest shot offset"), Batch.GetShotTimeOffset(0, 2), 0.1875f, Tolerance);
+		TestEqual(TEXT("Newest shot offset"), Batch.GetShotTimeOffset(1, 2), 0.0625f, Tolerance);
+		TestEqual(TEXT("Shots are spaced by the cadence"), Batch.GetShotTimeOffset(0, 2) - Batch.GetShotTimeOffset(1, 2), Batch.GetShotInterval(), Tolerance);
+		TestEqual(TEXT("Out of range index has no offset"), Batch.GetShotTimeOffset(2, 2), 0.f, Tolerance);
+		TestEqual(TEXT("Remainder carries into the next step"), Batch.Pending, 0.5f, Tolerance);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,6 +3,7 @@
 #include "Misc/AutomationTest.h"
 
 #include "ARDialogueTypes.h"
+#include "ARNPCSubsystem.h"
 #include "ARSaveGame.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -21,7 +22,7 @@ bool FARDialogueSchemaVersionTest::RunTest(const FString& Parameters)
 	TestTrue(TEXT("Current schema version is positive"), CurrentSchemaVersion > 0);
 	TestTrue(TEXT("Min supported schema version is positive"), MinSupportedSchemaVersion > 0);
 	TestTrue(TEXT("Current schema version is >= min supported schema"), CurrentSchemaVersion >= MinSupportedSchemaVersion);
-	TestEqual(TEXT("Without migrations, current schema equals min supported schema"), CurrentSchemaVersion, MinSupportedSchemaVersion);
+	TestEqual(TEXT("Min supported schema is the legacy inline layout migrated on load"), MinSupportedSchemaVersion, UARSaveGame::LegacyInlineSchemaVersion);
 	TestTrue(TEXT("Current schema is supported"), UARSaveGame::IsSchemaVersionSupported(CurrentSchemaVersion));
 	return true;
 }
@@ -56,19 +57,19 @@ bool FARDialogueSaveSanitizeTest::RunTest(const FString& Parameters)
 	{
 		FARNpcRelationshipState InvalidNpc;
 		InvalidNpc.LoveRating = 10;
-		Save->NpcRelationshipStates.Add(InvalidNpc);
+		Save->GetMutableNpcRelationshipStates().Add(InvalidNpc);
 
 		FARNpcRelationshipState ValidNpc;
 		ValidNpc.NpcTag = ValidNpcTag;
 		ValidNpc.LoveRating = -3;
-		Save->NpcRelationshipStates.Add(ValidNpc);
+		Save->GetMutableNpcRelationshipStates().Add(ValidNpc);
 	}
 
 	// Invalid canonical choice entry should be removed.
 	{
 		FARDialogueCanonicalChoiceState Invalid;
 		Invalid.NodeTag = ValidNodeTag;
-		Save->DialogueCanonicalChoiceStates.Add(Invalid);
+		Save->GetMutableDialogueCanonicalChoiceStates().Add(Invalid);
 	}
 
 	// Duplicate canonical node should dedupe down to one entry.
@@ -76,30 +77,30 @@ bool FARDialogueSaveSanitizeTest::RunTest(const FString& Parameters)
 		FARDialogueCanonicalChoiceState A;
 		A.NodeTag = ValidNodeTag;
 		A.ChoiceTag = ValidChoiceTag;
-		Save->DialogueCanonicalChoiceStates.Add(A);
+		Save->GetMutableDialogueCanonicalChoiceStates().Add(A);
 
 		FARDialogueCanonicalChoiceState B;
 		B.NodeTag = ValidNodeTag;
 		B.ChoiceTag = ValidChoiceTag;
-		Save->DialogueCanonicalChoiceStates.Add(B);
+		Save->GetMutableDialogueCanonicalChoiceStates().Add(B);
 	}
 
 	TArray<FString> Warnings;
 	const int32 ClampedCount = Save->ValidateAndSanitize(&Warnings);
 	TestTrue(TEXT("Sanitization performs at least one correction"), ClampedCount > 0);
 
-	TestEqual(TEXT("NPC relationship entries sanitized to one valid row"), Save->NpcRelationshipStates.Num(), 1);
-	if (Save->NpcRelationshipStates.Num() == 1)
+	TestEqual(TEXT("NPC relationship entries sanitized to one valid row"), Save->GetNpcRelationshipStates().Num(), 1);
+	if (Save->GetNpcRelationshipStates().Num() == 1)
 	{
-		TestTrue(TEXT("Remaining NPC tag is valid"), Save->NpcRelationshipStates[0].NpcTag.IsValid());
-		TestEqual(TEXT("Remaining NPC love clamped to non-negative"), Save->NpcRelationshipStates[0].LoveRating, 0);
+		TestTrue(TEXT("Remaining NPC tag is valid"), Save->GetNpcRelationshipStates()[0].NpcTag.IsValid());
+		TestEqual(TEXT("Remaining NPC love clamped to non-negative"), Save->GetNpcRelationshipStates()[0].LoveRating, 0);
 	}
 
-	TestEqual(TEXT("Canonical dialogue choice entries deduped to one row"), Save->DialogueCanonicalChoiceStates.Num(), 1);
-	if (Save->DialogueCanonicalChoiceStates.Num() == 1)
+	TestEqual(TEXT("Canonical dialogue choice entries deduped to one row"), Save->GetDialogueCanonicalChoiceStates().Num(), 1);
+	if (Save->GetDialogueCanonicalChoiceStates().Num() == 1)
 	{
-		TestTrue(TEXT("Canonical node tag remains valid"), Save->DialogueCanonicalChoiceStates[0].NodeTag.IsValid());
-		TestTrue(TEXT("Canonical choice tag remains valid"), Save->DialogueCanonicalChoiceStates[0].ChoiceTag.IsValid());
+		TestTrue(TEXT("Canonical node tag remains valid"), Save->GetDialogueCanonicalChoiceStates()[0].NodeTag.IsValid());
+		TestTrue(TEXT("Canonical choice tag remains valid"), Save->GetDialogueCanonicalChoiceStates()[0].ChoiceTag.IsValid());
 	}
 
 	TestTrue(TEXT("Warnings produced for invalid/duplicate dialogue data"), Warnings.Num() > 0);
@@ -192,6 +193,141 @@ bool FARPlayerDialogueHistoryStateDefaultsTest::RunTest(const FString& Parameter
 
 	const FARPlayerDialogueHistoryState State;
 	TestTrue(TEXT("Default seen node tags is empty"), State.SeenNodeTags.IsEmpty());
+	TestTrue(TEXT("Default seen node bits is empty"), State.SeenNodeBits.IsEmpty());
+	TestFalse(TEXT("Default state has seen nothing"), State.HasSeenNodeIndex(0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARDialogueHistoryCompactionTest,
+	"AlienRamen.Dialogue.Save.HistoryCompaction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARDialogueHistoryCompactionTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	UARSaveGame* Save = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+	if (!TestNotNull(TEXT("Created save object"), Save))
+	{
+		return false;
+	}
+
+	const FGameplayTag NodeA = FGameplayTag::RequestGameplayTag(FName(TEXT("Dialogue.Node")), false);
+	const FGameplayTag NodeB = FGameplayTag::RequestGameplayTag(FName(TEXT("Progression.Dialogue.Choice")), false);
+	if (!TestTrue(TEXT("Test tags exist"), NodeA.IsValid() && NodeB.IsValid()))
+	{
+		return false;
+	}
+
+	// Legacy rows carry their seen set as tags; writing the save folds them into bitsets.
+	FARPlayerDialogueHistoryState& Legacy = Save->GetMutablePlayerDialogueHistoryStates().AddDefaulted_GetRef();
+	Legacy.Identity.PlayerSlot = EARPlayerSlot::P1;
+	Legacy.SeenNodeTags.AddTag(NodeA);
+
+	TArray<uint8> Bytes;
+	if (!TestTrue(TEXT("Save serializes"), UGameplayStatics::SaveGameToMemory(Save, Bytes)))
+	{
+		return false;
+	}
+
+	UARSaveGame* Loaded = Cast<UARSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes));
+	if (!TestNotNull(TEXT("Save deserializes"), Loaded))
+	{
+		return false;
+	}
+
+	const int32 IndexA = Loaded->FindDialogueNodeIndex(NodeA);
+	TestTrue(TEXT("Migrated node has a stable index"), IndexA != INDEX_NONE);
+	TestEqual(TEXT("Unseen node has no index"), Loaded->FindDialogueNodeIndex(NodeB), static_cast<int32>(INDEX_NONE));
+	if (!TestEqual(TEXT("History row survives"), Loaded->GetPlayerDialogueHistoryStates().Num(), 1))
+	{
+		return false;
+	}
+
+	FARPlayerDialogueHistoryState& History = Loaded->GetMutablePlayerDialogueHistoryStates()[0];
+	TestTrue(TEXT("Legacy tags were drained"), History.SeenNodeTags.IsEmpty());
+	TestTrue(TEXT("Migrated node is seen"), History.HasSeenNodeIndex(IndexA));
+
+	const int32 IndexB = Loaded->FindOrAddDialogueNodeIndex(NodeB);
+	TestTrue(TEXT("New node appends after existing ones"), IndexB > IndexA);
+	TestTrue(TEXT("First mark reports a change"), History.MarkNodeIndexSeen(IndexB));
+	TestFalse(TEXT("Second mark is a no-op"), History.MarkNodeIndexSeen(IndexB));
+	TestEqual(TEXT("Index is stable across lookups"), Loaded->FindOrAddDialogueNodeIndex(NodeA), IndexA);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARNpcStateRegistryTest,
+	"AlienRamen.Dialogue.Save.NpcStateRegistry",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARNpcStateRegistryTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	UARSaveGame* Save = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+	UARSaveGame* OtherSave = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+	if (!TestNotNull(TEXT("Created save objects"), Save) || !TestNotNull(TEXT("Created other save"), OtherSave))
+	{
+		return false;
+	}
+
+	const FGameplayTag NpcA = FGameplayTag::RequestGameplayTag(FName(TEXT("NPC.Identity")), false);
+	const FGameplayTag NpcB = FGameplayTag::RequestGameplayTag(FName(TEXT("Dialogue.Node")), false);
+	if (!TestTrue(TEXT("Test tags exist"), NpcA.IsValid() && NpcB.IsValid()))
+	{
+		return false;
+	}
+
+	FARNpcRelationshipState Existing;
+	Existing.NpcTag = NpcA;
+	Existing.LoveRating = 4;
+	Save->GetMutableNpcRelationshipStates().Add(Existing);
+
+	FARNpcStateRegistry Registry;
+	const FARNpcStateHandle HandleA = Registry.FindHandle(Save, NpcA);
+	TestTrue(TEXT("Existing save entry is indexed"), HandleA.IsValid());
+	TestFalse(TEXT("Unknown NPC has no handle"), Registry.FindHandle(Save, NpcB).IsValid());
+
+	FARNpcRelationshipState Added;
+	Added.NpcTag = NpcB;
+	const FARNpcStateHandle HandleB = Registry.AddState(Save, Added);
+	TestEqual(TEXT("Added state lands in the save array"), Save->GetNpcRelationshipStates().Num(), 2);
+	TestTrue(TEXT("Earlier handle survives an add"), Registry.Resolve(Save, HandleA) != nullptr);
+
+	// Writes go straight to the save array; there is nothing to merge back on commit.
+	if (FARNpcRelationshipState* StateB = Registry.Resolve(Save, HandleB))
+	{
+		StateB->LoveRating = 9;
+	}
+	TestEqual(TEXT("Write through handle is visible in the save"), Save->GetNpcRelationshipStates()[1].LoveRating, 9);
+
+	// Reordering the array behind the registry invalidates handles, and lookups re-index.
+	Save->SetNpcRelationshipStates({ Save->GetNpcRelationshipStates()[1], Save->GetNpcRelationshipStates()[0] });
+	TestNull(TEXT("Handle to a moved slot no longer resolves"), Registry.Resolve(Save, HandleA));
+	const FARNpcStateHandle Reindexed = Registry.FindHandle(Save, NpcA);
+	const FARNpcRelationshipState* StateA = Registry.Resolve(Save, Reindexed);
+	TestTrue(TEXT("Re-indexed lookup finds the moved state"), StateA && StateA->LoveRating == 4);
+
+	// A same-size rewrite that introduces a new tag must not read as a miss (which would add a duplicate row).
+	const FGameplayTag NpcC = FGameplayTag::RequestGameplayTag(FName(TEXT("NPC")), false);
+	if (TestTrue(TEXT("Parent test tag exists"), NpcC.IsValid()))
+	{
+		FARNpcRelationshipState Replacement;
+		Replacement.NpcTag = NpcC;
+		Replacement.LoveRating = 7;
+		Save->SetNpcRelationshipStates({ Save->GetNpcRelationshipStates()[0], Replacement });
+		const FARNpcRelationshipState* StateC = Registry.Resolve(Save, Registry.FindHandle(Save, NpcC));
+		TestTrue(TEXT("Same-size rewrite is re-indexed"), StateC && StateC->LoveRating == 7);
+		FARNpcRelationshipState Duplicate;
+		Duplicate.NpcTag = NpcC;
+		Registry.AddState(Save, Duplicate);
+		TestEqual(TEXT("Adding an existing tag after a rewrite does not duplicate it"), Save->GetNpcRelationshipStates().Num(), 2);
+	}
+
+	TestNull(TEXT("Handles do not resolve against another save"), Registry.Resolve(OtherSave, Reindexed));
+	TestFalse(TEXT("Other save has its own index"), Registry.FindHandle(OtherSave, NpcA).IsValid());
 	return true;
 }
 
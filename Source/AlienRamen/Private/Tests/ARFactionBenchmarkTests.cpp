@@ -0,0 +1,283 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "ARBenchmarkTestUtils.h"
+#include "ARFactionScoring.h"
+#include "ARFactionSubsystem.h"
+#include "ARSaveGame.h"
+#include "ARSaveSubsystem.h"
+#include "ContentLookupSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameplayTagsManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeExit.h"
+#include "UObject/StrongObjectPtr.h"
+
+/** Friend of UARFactionSubsystem/UARSaveSubsystem: swaps routed content and the slot-backed save for synthetic data. */
+struct FARFactionBenchmarkAccess
+{
+	// Builds the scoring index from Entries and stamps it with the live content serial, so the subsystem's
+	// EnsureDefinitionCache treats it as current instead of re-resolving routed faction rows.
+	static bool SeedDefinitions(UARFactionSubsystem& Faction, UContentLookupSubsystem& Lookup, TArray<FARFactionScoringIndex::FEntry>&& Entries)
+	{
+		Faction.ScoringIndex.Reset();
+		Faction.ScoringIndex.Build(MoveTemp(Entries));
+		Faction.ScoringContentSerial = Lookup.GetContentSerial();
+		return Faction.ScoringIndex.IsBuilt();
+	}
+
+	static bool IsSeedCurrent(const UARFactionSubsystem& Faction, UContentLookupSubsystem& Lookup)
+	{
+		return Faction.ScoringIndex.IsBuilt() && Faction.ScoringContentSerial == Lookup.GetContentSerial();
+	}
+
+	static void SetCurrentSave(UARSaveSubsystem& Save, UARSaveGame* SaveGame)
+	{
+		Save.CurrentSaveGame = SaveGame;
+	}
+};
+
+namespace ARFactionBenchmark
+{
+	/** Synthetic faction content size. Presets are exposed as complex-test parameters. */
+	struct FScale
+	{
+		const TCHAR* Name = TEXT("");
+		int32 Factions = 4;
+		int32 RulesPerFaction = 4;
+		int32 TogglesPerCycle = 2;
+		int32 Cycles = 200;
+	};
+
+	static const FScale Presets[] = {
+		{ TEXT("Small"), 4, 4, 2, 200 },
+		{ TEXT("Medium"), 16, 16, 4, 400 },
+		{ TEXT("Large"), 64, 32, 8, 800 },
+	};
+
+	using ARBenchmarkTestUtils::FTiming;
+	using ARBenchmarkTestUtils::Measure;
+
+	/** Factions with rules keyed round-robin on registered tags, so rules share condition tags across factions. */
+	static TArray<FARFactionScoringIndex::FEntry> BuildSyntheticEntries(const FScale& Scale, const TArray<FGameplayTag>& TagPool)
+	{
+		TArray<FARFactionScoringIndex::FEntry> Entries;
+		int32 TagCursor = 0;
+		for (int32 FactionIndex = 0; FactionIndex < Scale.Factions; ++FactionIndex)
+		{
+			FARFactionScoringIndex::FEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.FactionTag = TagPool[FactionIndex % TagPool.Num()];
+			Entry.Definition.FactionTag = Entry.FactionTag;
+			Entry.Definition.BasePopularity = static_cast<float>(FactionIndex);
+			for (int32 RuleIndex = 0; RuleIndex < Scale.RulesPerFaction; ++RuleIndex)
+			{
+				FARFactionPopularityModifierRule& Rule = Entry.Definition.PopularityModifierRules.AddDefaulted_GetRef();
+				Rule.ConditionTag = TagPool[(TagCursor++ * 7) % TagPool.Num()];
+				Rule.Delta = (RuleIndex % 2 == 0) ? 1.5f : -0.5f;
+			}
+		}
+		return Entries;
+	}
+
+	/** Progression tags per cycle: each cycle flips TogglesPerCycle tags relative to the previous one. */
+	static TArray<FGameplayTagContainer> BuildCycleProgressionTags(const FScale& Scale, const TArray<FGameplayTag>& TagPool)
+	{
+		TArray<FGameplayTagContainer> CycleTags;
+		CycleTags.Reserve(Scale.Cycles);
+		FGameplayTagContainer Current;
+		int32 TagCursor = 0;
+		for (int32 Cycle = 0; Cycle < Scale.Cycles; ++Cycle)
+		{
+			for (int32 Toggle = 0; Toggle < Scale.TogglesPerCycle; ++Toggle)
+			{
+				const FGameplayTag Tag = TagPool[(TagCursor++ * 13) % TagPool.Num()];
+				if (Current.HasTagExact(Tag))
+				{
+					Current.RemoveTag(Tag);
+				}
+				else
+				{
+					Current.AddTag(Tag);
+				}
+			}
+			CycleTags.Add(Current);
+		}
+		return CycleTags;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FARFactionBenchmarkTest,
+	"AlienRamen.Faction.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FARFactionBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const ARFactionBenchmark::FScale& Preset : ARFactionBenchmark::Presets)
+	{
+		OutBeautifiedNames.Add(Preset.Name);
+		OutTestCommands.Add(Preset.Name);
+	}
+}
+
+bool FARFactionBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace ARFactionBenchmark;
+
+	const FScale* ScalePtr = ARBenchmarkTestUtils::FindPreset(Presets, Parameters);
+	if (!ScalePtr)
+	{
+		AddError(FString::Printf(TEXT("Unknown faction benchmark preset '%s'."), *Parameters));
+		return false;
+	}
+	const FScale& Scale = *ScalePtr;
+
+	FGameplayTagContainer AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+	TArray<FGameplayTag> TagPool;
+	AllTags.GetGameplayTagArray(TagPool);
+	if (!TestTrue(TEXT("Registered gameplay tags available for synthetic factions"), TagPool.Num() > 0))
+	{
+		return false;
+	}
+
+	const TArray<FGameplayTagContainer> CycleTags = BuildCycleProgressionTags(Scale, TagPool);
+	TArray<FTiming> Timings;
+
+	// Correctness first: after every cycle the incremental deltas must equal a full re-score.
+	{
+		FARFactionScoringIndex Index;
+		Index.Build(BuildSyntheticEntries(Scale, TagPool));
+		int32 Mismatches = 0;
+		for (const FGameplayTagContainer& ProgressionTags : CycleTags)
+		{
+			Index.UpdateModifierDeltas(ProgressionTags);
+			for (const FARFactionScoringIndex::FEntry& Entry : Index.GetEntries())
+			{
+				if (!FMath::IsNearlyEqual(Entry.ModifierDelta, FARFactionScoringIndex::ComputeModifierDelta(Entry.Definition, ProgressionTags)))
+				{
+					++Mismatches;
+				}
+			}
+		}
+		TestEqual(TEXT("Incremental deltas match a full re-score every cycle"), Mismatches, 0);
+	}
+
+	FARFactionScoringIndex Index;
+	Timings.Add(Measure(TEXT("BuildIndex"), 1, [&](int32)
+	{
+		Index.Build(BuildSyntheticEntries(Scale, TagPool));
+	}));
+
+	// Baseline: what every election cost before the cache, every rule of every faction.
+	float FullSum = 0.0f;
+	Timings.Add(Measure(TEXT("FullRescore"), Scale.Cycles, [&](const int32 Cycle)
+	{
+		for (const FARFactionScoringIndex::FEntry& Entry : Index.GetEntries())
+		{
+			FullSum += FARFactionScoringIndex::ComputeModifierDelta(Entry.Definition, CycleTags[Cycle]);
+		}
+	}));
+
+	int64 RescoredFactions = 0;
+	Timings.Add(Measure(TEXT("IncrementalRescore"), Scale.Cycles, [&](const int32 Cycle)
+	{
+		RescoredFactions += Index.UpdateModifierDeltas(CycleTags[Cycle]);
+	}));
+
+	// Election paths run through UARFactionSubsystem itself, hosted by a standalone game instance (no GameState, so
+	// winners land only in the synthetic save).
+	const TStrongObjectPtr<UGameInstance> GameInstance(NewObject<UGameInstance>(GEngine));
+	GameInstance->InitializeStandalone();
+	ON_SCOPE_EXIT
+	{
+		UWorld* World = GameInstance->GetWorld();
+		GameInstance->Shutdown();
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+	};
+
+	UARFactionSubsystem* Faction = GameInstance->GetSubsystem<UARFactionSubsystem>();
+	UARSaveSubsystem* SaveSubsystem = GameInstance->GetSubsystem<UARSaveSubsystem>();
+	UContentLookupSubsystem* Lookup = GameInstance->GetSubsystem<UContentLookupSubsystem>();
+	if (!TestNotNull(TEXT("Faction subsystem"), Faction) || !TestNotNull(TEXT("Save subsystem"), SaveSubsystem)
+		|| !TestNotNull(TEXT("Content lookup subsystem"), Lookup))
+	{
+		return false;
+	}
+
+	const TStrongObjectPtr<UARSaveGame> SaveHandle(Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass())));
+	if (!TestNotNull(TEXT("Synthetic save"), SaveHandle.Get()))
+	{
+		return false;
+	}
+	SaveHandle->FactionClout = FMath::Min(3, Scale.Factions);
+	FARFactionBenchmarkAccess::SetCurrentSave(*SaveSubsystem, SaveHandle.Get());
+	if (!TestTrue(TEXT("Synthetic faction definitions seeded"),
+		FARFactionBenchmarkAccess::SeedDefinitions(*Faction, *Lookup, BuildSyntheticEntries(Scale, TagPool))))
+	{
+		return false;
+	}
+
+	// Snapshot: rescore against the save's progression tags, drift, rank and pick candidates.
+	int32 SnapshotFailures = 0;
+	Timings.Add(Measure(TEXT("RefreshElectionSnapshot"), Scale.Cycles, [&](const int32 Cycle)
+	{
+		SaveHandle->ProgressionTags = CycleTags[Cycle];
+		SnapshotFailures += Faction->RefreshElectionSnapshot() ? 0 : 1;
+	}));
+	TestEqual(TEXT("Every snapshot refresh succeeds"), SnapshotFailures, 0);
+
+	// Full election: snapshot, both players vote (agreeing every other cycle), then finalize, which commits the
+	// popularity snapshot to the save and resolves the winner from the votes.
+	int32 FinalizeFailures = 0;
+	int32 WinnersOutsideCandidates = 0;
+	Timings.Add(Measure(TEXT("ElectionCycle"), Scale.Cycles, [&](const int32 Cycle)
+	{
+		SaveHandle->ProgressionTags = CycleTags[Cycle];
+		Faction->RefreshElectionSnapshot();
+		const TArray<FGameplayTag> Candidates = Faction->GetCurrentCandidates();
+		if (Candidates.IsEmpty())
+		{
+			++FinalizeFailures;
+			return;
+		}
+
+		Faction->SubmitVote(EARPlayerSlot::P1, Candidates[Cycle % Candidates.Num()]);
+		Faction->SubmitVote(EARPlayerSlot::P2, Candidates[(Cycle / 2) % Candidates.Num()]);
+
+		FGameplayTag Winner;
+		EARFactionWinnerReason Reason = EARFactionWinnerReason::NoValidFactions;
+		if (!Faction->FinalizeElectionForTravel(Winner, Reason))
+		{
+			++FinalizeFailures;
+			return;
+		}
+		WinnersOutsideCandidates += Candidates.Contains(Winner) ? 0 : 1;
+	}));
+	TestEqual(TEXT("Every election finalizes"), FinalizeFailures, 0);
+	TestEqual(TEXT("Every winner was a voted candidate"), WinnersOutsideCandidates, 0);
+	TestEqual(TEXT("Snapshot covers every faction"), SaveHandle->GetFactionPopularityStates().Num(), Index.GetEntries().Num());
+	TestTrue(TEXT("Synthetic definitions stayed current (no routed content re-resolve)"),
+		FARFactionBenchmarkAccess::IsSeedCurrent(*Faction, *Lookup));
+
+	AddInfo(FString::Printf(
+		TEXT("FactionBenchmark preset=%s factions=%d rules=%d cycles=%d rescoredFactions=%lld fullSum=%.2f"),
+		Scale.Name, Index.GetEntries().Num(), Scale.Factions * Scale.RulesPerFaction, Scale.Cycles, RescoredFactions, FullSum));
+	for (const FTiming& Timing : Timings)
+	{
+		AddInfo(FString::Printf(
+			TEXT("FactionBenchmark preset=%s path=%s totalMs=%.4f meanMs=%.6f samples=%d"),
+			Scale.Name, *Timing.Path, Timing.Total(), Timing.Mean(), Timing.SamplesMs.Num()));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
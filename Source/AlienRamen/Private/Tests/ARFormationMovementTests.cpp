@@ -0,0 +1,58 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "ARFormationMovementComponent.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARFormationMovementEvaluateTest,
+	"AlienRamen.Enemy.FormationMovement.Evaluate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARFormationMovementEvaluateTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	FARFormationPathShape Shape;
+	Shape.HoldSwayAmplitude = 50.f;
+	Shape.HoldSwayPeriod = 4.f;
+
+	FARFormationMotionState Entry;
+	Entry.Phase = EARFormationMotionPhase::Entering;
+	Entry.StartLocation = FVector(1000.f, 0.f, 0.f);
+	Entry.SlotLocation = FVector(600.f, 200.f, 0.f);
+	Entry.StartServerTime = 10.f;
+	Entry.EntryDuration = 2.f;
+
+	const float Tolerance = 0.5f;
+	TestTrue(TEXT("Entry starts at spawn"), UARFormationMovementComponent::EvaluateLocation(Entry, Shape, 10.f).Equals(Entry.StartLocation, Tolerance));
+	TestTrue(TEXT("Time before start clamps to spawn"), UARFormationMovementComponent::EvaluateLocation(Entry, Shape, 5.f).Equals(Entry.StartLocation, Tolerance));
+	TestTrue(TEXT("Linear entry midpoint"), UARFormationMovementComponent::EvaluateLocation(Entry, Shape, 11.f).Equals(FVector(800.f, 100.f, 0.f), Tolerance));
+	TestTrue(TEXT("Entry ends at slot"), UARFormationMovementComponent::EvaluateLocation(Entry, Shape, 12.f).Equals(Entry.SlotLocation, Tolerance));
+
+	// Entering past its duration must match the hold segment the server switches to, so clients stay continuous.
+	FARFormationMotionState Hold = Entry;
+	Hold.Phase = EARFormationMotionPhase::Holding;
+	Hold.StartLocation = Entry.SlotLocation;
+	Hold.StartServerTime = 12.f;
+	const FVector HoldQuarter = UARFormationMovementComponent::EvaluateLocation(Hold, Shape, 13.f);
+	TestTrue(TEXT("Hold sway peaks at a quarter period"), HoldQuarter.Equals(Entry.SlotLocation + FVector(0.f, 50.f, 0.f), Tolerance));
+	TestTrue(TEXT("Late entry evaluates as hold"), UARFormationMovementComponent::EvaluateLocation(Entry, Shape, 13.f).Equals(HoldQuarter, Tolerance));
+
+	Hold.bFlipY = true;
+	TestTrue(TEXT("Y flip mirrors hold sway"),
+		UARFormationMovementComponent::EvaluateLocation(Hold, Shape, 13.f).Equals(Entry.SlotLocation - FVector(0.f, 50.f, 0.f), Tolerance));
+
+	FARFormationMotionState Dive;
+	Dive.Phase = EARFormationMotionPhase::Diving;
+	Dive.StartLocation = FVector(600.f, 200.f, 0.f);
+	Dive.DiveDirection = FVector(-1.f, 0.f, 0.f);
+	Dive.DiveSpeed = 300.f;
+	Dive.StartServerTime = 20.f;
+	TestTrue(TEXT("Dive is linear in time"),
+		UARFormationMovementComponent::EvaluateLocation(Dive, Shape, 22.f).Equals(FVector(0.f, 200.f, 0.f), Tolerance));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,66 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "GameplayTagUtilities.h"
+#include "GameplayTagsManager.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARGameplayTagUtilitiesHierarchyTest,
+	"AlienRamen.Tags.Hierarchy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARGameplayTagUtilitiesHierarchyTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(TEXT("Progression.Dialogue.Choice")), false);
+	const FGameplayTag Parent = FGameplayTag::RequestGameplayTag(FName(TEXT("Progression.Dialogue")), false);
+	const FGameplayTag Top = FGameplayTag::RequestGameplayTag(FName(TEXT("Progression")), false);
+	if (!TestTrue(TEXT("Test tags exist"), Tag.IsValid() && Parent.IsValid() && Top.IsValid()))
+	{
+		return false;
+	}
+
+	// Each call twice: the first builds the cache entry, the second reads it.
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		TestEqual(TEXT("Depth"), UGameplayTagUtilities::GetTagDepth(Tag), 3);
+		TestEqual(TEXT("Invalid tag has no depth"), UGameplayTagUtilities::GetTagDepth(FGameplayTag()), 0);
+
+		FGameplayTag Out;
+		TestTrue(TEXT("Parent resolves"), UGameplayTagUtilities::TryGetParentTag(Tag, Out) && Out == Parent);
+		TestTrue(TEXT("Ancestor resolves"), UGameplayTagUtilities::TryGetAncestorTag(Tag, 2, Out) && Out == Top);
+		TestFalse(TEXT("Ancestor above the top level fails"), UGameplayTagUtilities::TryGetAncestorTag(Tag, 3, Out));
+		TestTrue(TEXT("Top level resolves"), UGameplayTagUtilities::TryGetTopLevelTag(Tag, Out) && Out == Top);
+		TestTrue(TEXT("Tag at depth resolves"), UGameplayTagUtilities::TryGetTagAtDepth(Tag, 2, Out) && Out == Parent);
+		TestFalse(TEXT("Top-level tag has no parent"), UGameplayTagUtilities::TryGetParentTag(Top, Out));
+
+		FGameplayTagContainer Prefixes;
+		TestTrue(TEXT("Prefixes resolve"), UGameplayTagUtilities::TryGetAllPrefixTags(Tag, Prefixes));
+		TestEqual(TEXT("Prefix count"), Prefixes.Num(), 3);
+
+		TArray<FGameplayTag> Children;
+		bool bFoundAny = false;
+		FGameplayTag FirstChild;
+		TestTrue(TEXT("Children query accepts valid tag"), UGameplayTagUtilities::GetDirectChildrenOfTag(Top, Children, bFoundAny, FirstChild));
+		TestTrue(TEXT("Direct children include the next level"), Children.Contains(Parent));
+		TestFalse(TEXT("Direct children exclude grandchildren"), Children.Contains(Tag));
+
+		// Must agree with the engine's own subtree query filtered by depth.
+		const FGameplayTagContainer Subtree = UGameplayTagsManager::Get().RequestGameplayTagChildren(Top);
+		int32 ExpectedDirect = 0;
+		for (const FGameplayTag Descendant : Subtree)
+		{
+			if (Descendant.RequestDirectParent() == Top)
+			{
+				++ExpectedDirect;
+			}
+		}
+		TestEqual(TEXT("Direct child count matches the engine subtree"), Children.Num(), ExpectedDirect);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
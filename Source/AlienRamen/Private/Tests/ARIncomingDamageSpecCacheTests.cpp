@@ -0,0 +1,94 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "AbilitySystemComponent.h"
+#include "AREnemyIncomingDamageEffect.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Misc/ScopeExit.h"
+
+namespace ARIncomingDamageSpecCacheTest
+{
+	// Actor owning a registered ASC with initialized actor info, as a spawned enemy would have.
+	static UAbilitySystemComponent* SpawnActorWithASC(UWorld& World)
+	{
+		AActor* Owner = World.SpawnActor<AActor>();
+		if (!Owner)
+		{
+			return nullptr;
+		}
+
+		UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Owner);
+		ASC->RegisterComponent();
+		ASC->InitAbilityActorInfo(Owner, Owner);
+		return ASC;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARIncomingDamageSpecCacheTest,
+	"AlienRamen.GAS.IncomingDamageSpecCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARIncomingDamageSpecCacheTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	using namespace ARIncomingDamageSpecCacheTest;
+
+	// MakeEffectContext needs initialized actor info, so targets and offenders live in a throwaway game world.
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	ON_SCOPE_EXIT
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	};
+
+	UAbilitySystemComponent* ASC = SpawnActorWithASC(*World);
+	UAbilitySystemComponent* OtherASC = SpawnActorWithASC(*World);
+	AActor* OffenderA = World->SpawnActor<AActor>();
+	AActor* OffenderB = World->SpawnActor<APawn>();
+	if (!TestNotNull(TEXT("Target ASC"), ASC) || !TestNotNull(TEXT("Other target ASC"), OtherASC)
+		|| !TestNotNull(TEXT("Offender A"), OffenderA) || !TestNotNull(TEXT("Offender B"), OffenderB))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Target actor info initialized"), ASC->AbilityActorInfo.IsValid() && ASC->GetAvatarActor() != nullptr);
+	const FName DamageName = UAREnemyIncomingDamageEffect::GetDamageDataName();
+
+	FARIncomingDamageSpecCache Cache;
+	const FGameplayEffectSpec* First = Cache.Prepare(*ASC, OffenderA, 5.f);
+	if (!TestNotNull(TEXT("Spec builds"), First))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Magnitude written"), First->GetSetByCallerMagnitude(DamageName, false), 5.f);
+	TestTrue(TEXT("Instigator is the offender"), First->GetContext().GetOriginalInstigator() == OffenderA);
+
+	const FGameplayEffectSpec* Second = Cache.Prepare(*ASC, OffenderA, 12.f);
+	TestTrue(TEXT("Same source reuses the spec"), Second == First);
+	TestEqual(TEXT("Reuse updates the magnitude"), Second->GetSetByCallerMagnitude(DamageName, false), 12.f);
+
+	const FGameplayEffectSpec* Other = Cache.Prepare(*ASC, OffenderB, 3.f);
+	TestTrue(TEXT("Different source gets its own spec"), Other && Other != First);
+	TestTrue(TEXT("Other instigator kept"), Other && Other->GetContext().GetOriginalInstigator() == OffenderB);
+	TestEqual(TEXT("First source magnitude untouched"), First->GetSetByCallerMagnitude(DamageName, false), 12.f);
+
+	const FGameplayEffectSpec* Anonymous = Cache.Prepare(*ASC, nullptr, 1.f);
+	TestTrue(TEXT("Null offender is a valid source"), Anonymous && Anonymous->GetContext().GetOriginalInstigator() != OffenderA);
+
+	const FGameplayEffectSpec* Moved = Cache.Prepare(*OtherASC, OffenderA, 7.f);
+	if (TestNotNull(TEXT("Spec builds for a new ASC"), Moved))
+	{
+		TestEqual(TEXT("Rebuilt spec magnitude"), Moved->GetSetByCallerMagnitude(DamageName, false), 7.f);
+		TestTrue(TEXT("Rebuilt spec keeps the offender"), Moved->GetContext().GetOriginalInstigator() == OffenderA);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,426 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "ARBenchmarkTestUtils.h"
+#include "ARDialogueTypes.h"
+#include "ARFactionTypes.h"
+#include "ARSaveGame.h"
+#include "ARSaveIndexGame.h"
+#include "ARSaveSubsystem.h"
+#include "GameplayTagsManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "UObject/StrongObjectPtr.h"
+
+/** Friend of UARSaveSubsystem: reaches the index-parameterized paths so the benchmark never touches the player's index. */
+struct FARSaveBenchmarkAccess
+{
+	static bool ListSaves(const UARSaveSubsystem& Subsystem, const TCHAR* IndexSlotName, TArray<FARSaveSlotDescriptor>& OutSlots, FARSaveResult& OutResult)
+	{
+		return Subsystem.ListSavesInIndex(IndexSlotName, OutSlots, OutResult);
+	}
+
+	static UARSaveGame* LoadWithRollback(const UARSaveSubsystem& Subsystem, const FName SlotBaseName, int32& OutResolvedRevision, FARSaveResult& OutResult, const TCHAR* IndexSlotName)
+	{
+		return Subsystem.LoadSaveObjectWithRollback(SlotBaseName, INDEX_NONE, OutResolvedRevision, OutResult, IndexSlotName);
+	}
+
+	static bool PersistCanonicalSave(UARSaveSubsystem& Subsystem, const TArray<uint8>& SaveBytes, const FName SlotBaseName, const int32 SlotNumber, const TCHAR* IndexSlotName, FARSaveResult& OutResult)
+	{
+		return Subsystem.PersistCanonicalSaveToIndex(SaveBytes, SlotBaseName, SlotNumber, IndexSlotName, OutResult);
+	}
+};
+
+namespace ARSaveBenchmark
+{
+	static const TCHAR* SlotPrefix = TEXT("ARBench_");
+	static constexpr int32 UserIndex = 0;
+
+	/** Synthetic campaign size. Presets are exposed as complex-test parameters. */
+	struct FScale
+	{
+		const TCHAR* Name = TEXT("");
+		int32 Players = 2;
+		int32 Npcs = 8;
+		int32 HistoryRowsPerPlayer = 1;
+		int32 SeenNodesPerHistoryRow = 16;
+		int32 CanonicalChoices = 8;
+		int32 Factions = 4;
+		int32 Revisions = 5;
+		int32 IndexEntries = 8;
+		int32 Iterations = 10;
+	};
+
+	static const FScale Presets[] = {
+		{ TEXT("Small"), 2, 8, 1, 16, 8, 4, 5, 8, 20 },
+		{ TEXT("Medium"), 2, 32, 4, 64, 64, 8, 10, 32, 10 },
+		{ TEXT("Large"), 4, 128, 16, 256, 256, 16, 20, 128, 5 },
+		{ TEXT("Veteran"), 4, 512, 64, 1024, 1024, 32, 50, 512, 3 },
+	};
+
+	using ARBenchmarkTestUtils::FTiming;
+	using ARBenchmarkTestUtils::Measure;
+
+	// Revision slots follow UARSaveSubsystem's "<Base>__<Revision>" naming so its rollback walk finds them.
+	static FName BuildSlotBaseName(const FScale& Scale)
+	{
+		return FName(*FString::Printf(TEXT("%s%s"), SlotPrefix, Scale.Name));
+	}
+
+	static FString BuildSlotName(const FScale& Scale, const int32 Revision)
+	{
+		return FString::Printf(TEXT("%s__%d"), *BuildSlotBaseName(Scale).ToString(), Revision);
+	}
+
+	static FString BuildIndexSlotName(const FScale& Scale)
+	{
+		return FString::Printf(TEXT("%s%s_Index"), SlotPrefix, Scale.Name);
+	}
+
+	static FARPlayerIdentity BuildIdentity(const int32 PlayerIndex)
+	{
+		FARPlayerIdentity Identity;
+		Identity.LegacyId = 1000 + PlayerIndex;
+		Identity.DisplayName = FText::FromString(FString::Printf(TEXT("BenchPlayer_%d"), PlayerIndex));
+		Identity.PlayerSlot = (PlayerIndex % 2 == 0) ? EARPlayerSlot::P1 : EARPlayerSlot::P2;
+		Identity.UniqueNetIdString = FString::Printf(TEXT("765611980000%05d"), PlayerIndex);
+		Identity.UniqueNetIdType = TEXT("STEAM");
+		return Identity;
+	}
+
+	/**
+	 * Builds a save filled to Scale. Tags are drawn round-robin from the registered tag dictionary because
+	 * unregistered names do not survive FGameplayTag serialization.
+	 */
+	static UARSaveGame* BuildSyntheticSave(const FScale& Scale, const TArray<FGameplayTag>& TagPool)
+	{
+		UARSaveGame* Save = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+		if (!Save || TagPool.Num() == 0)
+		{
+			return Save;
+		}
+
+		int32 TagCursor = 0;
+		auto NextTag = [&TagPool, &TagCursor]() -> FGameplayTag
+		{
+			const FGameplayTag Tag = TagPool[TagCursor % TagPool.Num()];
+			++TagCursor;
+			return Tag;
+		};
+
+		Save->Money = 123456;
+		Save->Scrap = 4321;
+		Save->Cycles = Scale.Revisions * 3;
+		Save->FactionClout = 5;
+		Save->SaveSlot = FName(*FString::Printf(TEXT("%s%s"), SlotPrefix, Scale.Name));
+		Save->LastSaved = FDateTime::UtcNow();
+		Save->Meat.RedAmount = 10;
+		Save->Meat.BlueAmount = 20;
+		Save->Meat.WhiteAmount = 30;
+
+		for (int32 Index = 0; Index < FMath::Min(Scale.SeenNodesPerHistoryRow, TagPool.Num()); ++Index)
+		{
+			Save->Unlocks.AddTag(NextTag());
+			Save->ProgressionTags.AddTag(NextTag());
+		}
+
+		for (int32 PlayerIndex = 0; PlayerIndex < Scale.Players; ++PlayerIndex)
+		{
+			FARPlayerStateSaveData& PlayerData = Save->GetMutablePlayerStates().AddDefaulted_GetRef();
+			PlayerData.Identity = BuildIdentity(PlayerIndex);
+			PlayerData.CharacterPicked = EARCharacterChoice::Brother;
+			for (int32 LoadoutIndex = 0; LoadoutIndex < 8; ++LoadoutIndex)
+			{
+				PlayerData.LoadoutTags.AddTag(NextTag());
+			}
+
+			for (int32 Row = 0; Row < Scale.HistoryRowsPerPlayer; ++Row)
+			{
+				FARPlayerDialogueHistoryState& History = Save->GetMutablePlayerDialogueHistoryStates().AddDefaulted_GetRef();
+				History.Identity = PlayerData.Identity;
+				History.Identity.LegacyId += Row * Scale.Players;
+				for (int32 Seen = 0; Seen < Scale.SeenNodesPerHistoryRow; ++Seen)
+				{
+					History.SeenNodeTags.AddTag(NextTag());
+				}
+			}
+		}
+
+		for (int32 NpcIndex = 0; NpcIndex < Scale.Npcs; ++NpcIndex)
+		{
+			FARNpcRelationshipState& Npc = Save->GetMutableNpcRelationshipStates().AddDefaulted_GetRef();
+			Npc.NpcTag = NextTag();
+			Npc.LoveRating = NpcIndex % 10;
+			Npc.CurrentWantTag = NextTag();
+			Npc.bCurrentWantSatisfied = (NpcIndex % 3) == 0;
+		}
+
+		for (int32 ChoiceIndex = 0; ChoiceIndex < Scale.CanonicalChoices; ++ChoiceIndex)
+		{
+			FARDialogueCanonicalChoiceState& Choice = Save->GetMutableDialogueCanonicalChoiceStates().AddDefaulted_GetRef();
+			Choice.NodeTag = NextTag();
+			Choice.ChoiceTag = NextTag();
+		}
+
+		for (int32 FactionIndex = 0; FactionIndex < Scale.Factions; ++FactionIndex)
+		{
+			FARFactionRuntimeState& Faction = Save->GetMutableFactionPopularityStates().AddDefaulted_GetRef();
+			Faction.FactionTag = NextTag();
+			Faction.Popularity = static_cast<float>(FactionIndex) * 1.5f;
+			Save->ActiveFactionEffectTags.AddTag(NextTag());
+		}
+
+		return Save;
+	}
+
+	static UARSaveIndexGame* BuildSyntheticIndex(const FScale& Scale)
+	{
+		UARSaveIndexGame* Index = Cast<UARSaveIndexGame>(UGameplayStatics::CreateSaveGameObject(UARSaveIndexGame::StaticClass()));
+		if (!Index)
+		{
+			return nullptr;
+		}
+
+		for (int32 EntryIndex = 0; EntryIndex < Scale.IndexEntries; ++EntryIndex)
+		{
+			FARSaveSlotDescriptor& Entry = Index->SlotNames.AddDefaulted_GetRef();
+			Entry.SlotName = FName(*FString::Printf(TEXT("%s%s_%d"), SlotPrefix, Scale.Name, EntryIndex));
+			Entry.SlotNumber = EntryIndex % FMath::Max(1, Scale.Revisions);
+			Entry.SaveVersion = UARSaveGame::GetCurrentSchemaVersion();
+			Entry.CyclesPlayed = EntryIndex;
+			Entry.LastSavedTime = FDateTime::UtcNow();
+			Entry.Money = EntryIndex * 10;
+		}
+		return Index;
+	}
+
+	static void DeleteBenchmarkSlots(const FScale& Scale)
+	{
+		for (int32 Revision = 0; Revision < Scale.Revisions; ++Revision)
+		{
+			const FString SlotName = BuildSlotName(Scale, Revision);
+			if (UGameplayStatics::DoesSaveGameExist(SlotName, UserIndex))
+			{
+				UGameplayStatics::DeleteGameInSlot(SlotName, UserIndex);
+			}
+		}
+
+		const FString IndexSlotName = BuildIndexSlotName(Scale);
+		if (UGameplayStatics::DoesSaveGameExist(IndexSlotName, UserIndex))
+		{
+			UGameplayStatics::DeleteGameInSlot(IndexSlotName, UserIndex);
+		}
+	}
+
+	static FString BuildReportJson(const FScale& Scale, const int64 SaveBytes, const TArray<FTiming>& Timings)
+	{
+		FString Json = TEXT("{\n");
+		Json += FString::Printf(TEXT("\t\"preset\": \"%s\",\n"), Scale.Name);
+		Json += FString::Printf(TEXT("\t\"schemaVersion\": %d,\n"), UARSaveGame::GetCurrentSchemaVersion());
+		Json += FString::Printf(
+			TEXT("\t\"scale\": { \"players\": %d, \"npcs\": %d, \"historyRowsPerPlayer\": %d, \"seenNodesPerHistoryRow\": %d, \"canonicalChoices\": %d, \"factions\": %d, \"revisions\": %d, \"indexEntries\": %d, \"iterations\": %d },\n"),
+			Scale.Players, Scale.Npcs, Scale.HistoryRowsPerPlayer, Scale.SeenNodesPerHistoryRow,
+			Scale.CanonicalChoices, Scale.Factions, Scale.Revisions, Scale.IndexEntries, Scale.Iterations);
+		Json += FString::Printf(TEXT("\t\"saveBytes\": %lld,\n"), SaveBytes);
+		Json += TEXT("\t\"timings\": [\n");
+		for (int32 Index = 0; Index < Timings.Num(); ++Index)
+		{
+			const FTiming& Timing = Timings[Index];
+			Json += FString::Printf(
+				TEXT("\t\t{ \"path\": \"%s\", \"bytes\": %lld, \"minMs\": %.4f, \"medianMs\": %.4f, \"meanMs\": %.4f, \"samples\": %d }%s\n"),
+				*Timing.Path, Timing.Bytes, Timing.Min(), Timing.Median(), Timing.Mean(), Timing.SamplesMs.Num(),
+				Index + 1 < Timings.Num() ? TEXT(",") : TEXT(""));
+		}
+		Json += TEXT("\t]\n}\n");
+		return Json;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FARSaveBenchmarkTest,
+	"AlienRamen.Save.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FARSaveBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const ARSaveBenchmark::FScale& Preset : ARSaveBenchmark::Presets)
+	{
+		OutBeautifiedNames.Add(Preset.Name);
+		OutTestCommands.Add(Preset.Name);
+	}
+}
+
+bool FARSaveBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace ARSaveBenchmark;
+
+	const FScale* ScalePtr = ARBenchmarkTestUtils::FindPreset(Presets, Parameters);
+	if (!ScalePtr)
+	{
+		AddError(FString::Printf(TEXT("Unknown save benchmark preset '%s'."), *Parameters));
+		return false;
+	}
+	const FScale& Scale = *ScalePtr;
+
+	FGameplayTagContainer AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, true);
+	TArray<FGameplayTag> TagPool;
+	AllTags.GetGameplayTagArray(TagPool);
+	if (!TestTrue(TEXT("Registered gameplay tags available for synthetic saves"), TagPool.Num() > 0))
+	{
+		return false;
+	}
+
+	// Rooted for the duration of the run; the measured paths allocate enough to trigger GC.
+	const TStrongObjectPtr<UARSaveGame> SaveHandle(BuildSyntheticSave(Scale, TagPool));
+	const TStrongObjectPtr<UARSaveIndexGame> IndexHandle(BuildSyntheticIndex(Scale));
+	UARSaveGame* Save = SaveHandle.Get();
+	UARSaveIndexGame* Index = IndexHandle.Get();
+	if (!TestNotNull(TEXT("Synthetic save"), Save) || !TestNotNull(TEXT("Synthetic index"), Index))
+	{
+		return false;
+	}
+
+	DeleteBenchmarkSlots(Scale);
+	ON_SCOPE_EXIT
+	{
+		DeleteBenchmarkSlots(Scale);
+	};
+
+	TArray<FTiming> Timings;
+
+	TArray<uint8> SaveBytes;
+	Timings.Add(Measure(TEXT("SaveGameToMemory"), Scale.Iterations, [&](int32)
+	{
+		SaveBytes.Reset();
+		UGameplayStatics::SaveGameToMemory(Save, SaveBytes);
+	}));
+	Timings.Last().Bytes = SaveBytes.Num();
+	if (!TestTrue(TEXT("Synthetic save serialized"), SaveBytes.Num() > 0))
+	{
+		return false;
+	}
+
+	Timings.Add(Measure(TEXT("LoadGameFromMemory"), Scale.Iterations, [&](int32)
+	{
+		UGameplayStatics::LoadGameFromMemory(SaveBytes);
+	}));
+	Timings.Last().Bytes = SaveBytes.Num();
+
+	// Sectioned saves defer everything but header/core to first access; this is the worst case where all of it is read.
+	Timings.Add(Measure(TEXT("LoadGameFromMemoryHydrated"), Scale.Iterations, [&](int32)
+	{
+		if (UARSaveGame* Loaded = Cast<UARSaveGame>(UGameplayStatics::LoadGameFromMemory(SaveBytes)))
+		{
+			Loaded->HydrateAllSections();
+		}
+	}));
+	Timings.Last().Bytes = SaveBytes.Num();
+
+	Timings.Add(Measure(TEXT("ValidateAndSanitize"), Scale.Iterations, [&](int32)
+	{
+		Save->ValidateAndSanitize(nullptr);
+	}));
+
+	const FString PrimarySlot = BuildSlotName(Scale, 0);
+	Timings.Add(Measure(TEXT("SaveGameToSlot"), Scale.Iterations, [&](int32)
+	{
+		UGameplayStatics::SaveGameToSlot(Save, PrimarySlot, UserIndex);
+	}));
+	Timings.Last().Bytes = SaveBytes.Num();
+
+	bool bLoadedFromSlot = true;
+	Timings.Add(Measure(TEXT("LoadGameFromSlot"), Scale.Iterations, [&](int32)
+	{
+		bLoadedFromSlot &= Cast<UARSaveGame>(UGameplayStatics::LoadGameFromSlot(PrimarySlot, UserIndex)) != nullptr;
+	}));
+	Timings.Last().Bytes = SaveBytes.Num();
+	TestTrue(TEXT("Synthetic save reloads from slot"), bLoadedFromSlot);
+
+	// Real UARSaveSubsystem paths, pointed at a benchmark-only index slot. The subsystem is not attached to a
+	// game instance; these paths only touch slot storage.
+	const TStrongObjectPtr<UARSaveSubsystem> Subsystem(NewObject<UARSaveSubsystem>(GetTransientPackage()));
+	const FString IndexSlot = BuildIndexSlotName(Scale);
+	const FName SlotBase = BuildSlotBaseName(Scale);
+	const int32 LatestRevision = Scale.Revisions - 1;
+
+	FARSaveSlotDescriptor& RollbackEntry = Index->SlotNames.AddDefaulted_GetRef();
+	RollbackEntry.SlotName = SlotBase;
+	RollbackEntry.SlotNumber = LatestRevision;
+	RollbackEntry.SaveVersion = UARSaveGame::GetCurrentSchemaVersion();
+	UGameplayStatics::SaveGameToSlot(Index, IndexSlot, UserIndex);
+	TArray<uint8> IndexBytes;
+	UGameplayStatics::SaveGameToMemory(Index, IndexBytes);
+
+	int32 ListedSlots = 0;
+	Timings.Add(Measure(TEXT("ListSaves"), Scale.Iterations, [&](int32)
+	{
+		TArray<FARSaveSlotDescriptor> OutSlots;
+		FARSaveResult Result;
+		FARSaveBenchmarkAccess::ListSaves(*Subsystem, *IndexSlot, OutSlots, Result);
+		ListedSlots = OutSlots.Num();
+	}));
+	Timings.Last().Bytes = IndexBytes.Num();
+	TestEqual(TEXT("ListSaves returns every synthetic index entry"), ListedSlots, Scale.IndexEntries + 1);
+
+	// Newest half of the revisions are corrupt, so each load walks down to the first revision that deserializes.
+	const TArray<uint8> CorruptBytes = { 0xDE, 0xAD, 0xBE, 0xEF };
+	const int32 FirstCorruptRevision = Scale.Revisions / 2;
+	for (int32 Revision = 0; Revision < Scale.Revisions; ++Revision)
+	{
+		const FString SlotName = BuildSlotName(Scale, Revision);
+		if (Revision >= FirstCorruptRevision)
+		{
+			UGameplayStatics::SaveDataToSlot(CorruptBytes, SlotName, UserIndex);
+		}
+		else
+		{
+			UGameplayStatics::SaveGameToSlot(Save, SlotName, UserIndex);
+		}
+	}
+
+	int32 ResolvedRevision = INDEX_NONE;
+	Timings.Add(Measure(TEXT("LoadWithRollback"), Scale.Iterations, [&](int32)
+	{
+		FARSaveResult Result;
+		FARSaveBenchmarkAccess::LoadWithRollback(*Subsystem, SlotBase, ResolvedRevision, Result, *IndexSlot);
+	}));
+	TestEqual(TEXT("Rollback resolves to newest intact revision"), ResolvedRevision, FirstCorruptRevision - 1);
+
+	// Server serializes the canonical save; the client persists the bytes through the real sync endpoint.
+	bool bPersisted = true;
+	Timings.Add(Measure(TEXT("CanonicalSyncRoundTrip"), Scale.Iterations, [&](int32)
+	{
+		TArray<uint8> WireBytes;
+		UGameplayStatics::SaveGameToMemory(Save, WireBytes);
+		FARSaveResult Result;
+		bPersisted &= FARSaveBenchmarkAccess::PersistCanonicalSave(*Subsystem, WireBytes, SlotBase, 0, *IndexSlot, Result);
+	}));
+	Timings.Last().Bytes = SaveBytes.Num();
+	TestTrue(TEXT("Canonical sync persisted"), bPersisted);
+
+	for (const FTiming& Timing : Timings)
+	{
+		AddInfo(FString::Printf(
+			TEXT("SaveBenchmark preset=%s path=%s bytes=%lld minMs=%.4f medianMs=%.4f meanMs=%.4f"),
+			Scale.Name, *Timing.Path, Timing.Bytes, Timing.Min(), Timing.Median(), Timing.Mean()));
+	}
+
+	const FString ReportPath = FPaths::Combine(
+		FPaths::ProjectSavedDir(), TEXT("Automation"), TEXT("Benchmarks"), FString::Printf(TEXT("SaveBenchmark_%s.json"), Scale.Name));
+	if (FFileHelper::SaveStringToFile(BuildReportJson(Scale, SaveBytes.Num(), Timings), *ReportPath))
+	{
+		AddInfo(FString::Printf(TEXT("SaveBenchmark report written to %s"), *ReportPath));
+	}
+	else
+	{
+		AddWarning(FString::Printf(TEXT("SaveBenchmark failed to write report to %s"), *ReportPath));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
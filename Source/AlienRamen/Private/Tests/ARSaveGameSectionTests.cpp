@@ -0,0 +1,216 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include "ARSaveGame.h"
+#include "Kismet/GameplayStatics.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+struct FARSaveGameSectionTestAccess
+{
+	static const TArray<uint8>& GetPendingSectionBytes(const UARSaveGame& Save, const EARSaveSection Section)
+	{
+		return Save.PendingSectionBytes[static_cast<int32>(Section)];
+	}
+};
+
+namespace ARSaveGameSectionTestUtils
+{
+	static UARSaveGame* MakeSeededSave(FGameplayTag NodeTag, FGameplayTag NpcTag, FGameplayTag FactionTag)
+	{
+		UARSaveGame* Save = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+		if (!Save)
+		{
+			return nullptr;
+		}
+
+		Save->Money = 250;
+
+		FARPlayerStateSaveData& Player = Save->GetMutablePlayerStates().AddDefaulted_GetRef();
+		Player.Identity.PlayerSlot = EARPlayerSlot::P1;
+		Player.CyclesPlayed = 3;
+
+		FARNpcRelationshipState& Npc = Save->GetMutableNpcRelationshipStates().AddDefaulted_GetRef();
+		Npc.NpcTag = NpcTag;
+		Npc.LoveRating = 5;
+
+		FARPlayerDialogueHistoryState& History = Save->GetMutablePlayerDialogueHistoryStates().AddDefaulted_GetRef();
+		History.Identity.PlayerSlot = EARPlayerSlot::P1;
+		History.SeenNodeTags.AddTag(NodeTag);
+
+		FARFactionRuntimeState& Faction = Save->GetMutableFactionPopularityStates().AddDefaulted_GetRef();
+		Faction.FactionTag = FactionTag;
+		Faction.Popularity = 0.75f;
+		return Save;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARSaveGameLegacyInlineMigrationTest,
+	"AlienRamen.Save.Sections.LegacyInlineMigration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARSaveGameLegacyInlineMigrationTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	const FGameplayTag NodeTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Dialogue.Node")), false);
+	const FGameplayTag NpcTag = FGameplayTag::RequestGameplayTag(FName(TEXT("NPC.Identity")), false);
+	const FGameplayTag FactionTag = FGameplayTag::RequestGameplayTag(FName(TEXT("NPC")), false);
+	if (!TestTrue(TEXT("Test tags exist"), NodeTag.IsValid() && NpcTag.IsValid() && FactionTag.IsValid()))
+	{
+		return false;
+	}
+
+	UARSaveGame* Legacy = ARSaveGameSectionTestUtils::MakeSeededSave(NodeTag, NpcTag, FactionTag);
+	if (!TestNotNull(TEXT("Created legacy save"), Legacy))
+	{
+		return false;
+	}
+	Legacy->SaveGameVersion = UARSaveGame::LegacyInlineSchemaVersion;
+
+	// A non-persistent writer takes the plain tagged path, which is exactly the v6 layout: every field inline, no
+	// section table after the tagged block.
+	TArray<uint8> LegacyBytes;
+	{
+		FMemoryWriter Writer(LegacyBytes, /*bIsPersistent*/ false);
+		FObjectAndNameAsStringProxyArchive Proxy(Writer, false);
+		Legacy->Serialize(Proxy);
+	}
+
+	UARSaveGame* Migrated = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+	if (!TestNotNull(TEXT("Created load target"), Migrated))
+	{
+		return false;
+	}
+	{
+		FMemoryReader Reader(LegacyBytes, /*bIsPersistent*/ true);
+		FObjectAndNameAsStringProxyArchive Proxy(Reader, true);
+		Migrated->Serialize(Proxy);
+		TestFalse(TEXT("Legacy inline bytes load without error"), Proxy.IsError());
+	}
+
+	TestEqual(TEXT("Legacy load keeps its schema version"), Migrated->SaveGameVersion, UARSaveGame::LegacyInlineSchemaVersion);
+	TestTrue(TEXT("Legacy load hydrates Players inline"), Migrated->IsSectionHydrated(EARSaveSection::Players));
+	TestTrue(TEXT("Legacy load hydrates Factions inline"), Migrated->IsSectionHydrated(EARSaveSection::Factions));
+	TestEqual(TEXT("Core progression survives"), Migrated->Money, 250);
+	TestTrue(TEXT("Player row survives"), Migrated->GetPlayerStates().Num() == 1 && Migrated->GetPlayerStates()[0].CyclesPlayed == 3);
+	TestTrue(TEXT("NPC row survives"), Migrated->GetNpcRelationshipStates().Num() == 1 && Migrated->GetNpcRelationshipStates()[0].LoveRating == 5);
+	TestTrue(TEXT("Faction row survives"), Migrated->GetFactionPopularityStates().Num() == 1
+		&& FMath::IsNearlyEqual(Migrated->GetFactionPopularityStates()[0].Popularity, 0.75f));
+
+	const int32 NodeIndex = Migrated->FindDialogueNodeIndex(NodeTag);
+	if (TestTrue(TEXT("Legacy seen tags are compacted on load"), NodeIndex != INDEX_NONE && Migrated->GetPlayerDialogueHistoryStates().Num() == 1))
+	{
+		TestTrue(TEXT("Compacted node is seen"), Migrated->GetPlayerDialogueHistoryStates()[0].HasSeenNodeIndex(NodeIndex));
+		TestTrue(TEXT("Compacted row drops its tags"), Migrated->GetPlayerDialogueHistoryStates()[0].SeenNodeTags.IsEmpty());
+	}
+
+	// The next write uses the section table; reading it back leaves every section pending until first access.
+	TArray<uint8> SectionedBytes;
+	if (!TestTrue(TEXT("Migrated save serializes"), UGameplayStatics::SaveGameToMemory(Migrated, SectionedBytes)))
+	{
+		return false;
+	}
+
+	UARSaveGame* Reloaded = Cast<UARSaveGame>(UGameplayStatics::LoadGameFromMemory(SectionedBytes));
+	if (!TestNotNull(TEXT("Sectioned save deserializes"), Reloaded))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Tagged block loads eagerly"), Reloaded->Money, 250);
+	TestFalse(TEXT("Players section is pending after load"), Reloaded->IsSectionHydrated(EARSaveSection::Players));
+	TestFalse(TEXT("Factions section is pending after load"), Reloaded->IsSectionHydrated(EARSaveSection::Factions));
+
+	TestTrue(TEXT("Players hydrate on first access"), Reloaded->GetPlayerStates().Num() == 1 && Reloaded->GetPlayerStates()[0].CyclesPlayed == 3);
+	TestTrue(TEXT("Players section is hydrated after access"), Reloaded->IsSectionHydrated(EARSaveSection::Players));
+	TestFalse(TEXT("Hydrating one section leaves the others pending"), Reloaded->IsSectionHydrated(EARSaveSection::Factions));
+	TestFalse(TEXT("Dialogue stays pending"), Reloaded->IsSectionHydrated(EARSaveSection::Dialogue));
+
+	TestTrue(TEXT("Factions hydrate on access"), Reloaded->GetFactionPopularityStates().Num() == 1
+		&& Reloaded->GetFactionPopularityStates()[0].FactionTag == FactionTag);
+	TestEqual(TEXT("History keeps its compacted node index"), Reloaded->FindDialogueNodeIndex(NodeTag), NodeIndex);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FARSaveGameCopySectionsPassThroughTest,
+	"AlienRamen.Save.Sections.CopyPassThrough",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FARSaveGameCopySectionsPassThroughTest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	const FGameplayTag NodeTag = FGameplayTag::RequestGameplayTag(FName(TEXT("Dialogue.Node")), false);
+	const FGameplayTag NpcTag = FGameplayTag::RequestGameplayTag(FName(TEXT("NPC.Identity")), false);
+	const FGameplayTag FactionTag = FGameplayTag::RequestGameplayTag(FName(TEXT("NPC")), false);
+	if (!TestTrue(TEXT("Test tags exist"), NodeTag.IsValid() && NpcTag.IsValid() && FactionTag.IsValid()))
+	{
+		return false;
+	}
+
+	UARSaveGame* Seeded = ARSaveGameSectionTestUtils::MakeSeededSave(NodeTag, NpcTag, FactionTag);
+	TArray<uint8> Bytes;
+	if (!TestNotNull(TEXT("Created save"), Seeded) || !TestTrue(TEXT("Save serializes"), UGameplayStatics::SaveGameToMemory(Seeded, Bytes)))
+	{
+		return false;
+	}
+
+	UARSaveGame* Source = Cast<UARSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes));
+	UARSaveGame* Dest = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+	if (!TestNotNull(TEXT("Source deserializes"), Source) || !TestNotNull(TEXT("Created destination"), Dest))
+	{
+		return false;
+	}
+
+	const TArray<uint8> SourcePlayersBytes = FARSaveGameSectionTestAccess::GetPendingSectionBytes(*Source, EARSaveSection::Players);
+	const TArray<uint8> SourceFactionBytes = FARSaveGameSectionTestAccess::GetPendingSectionBytes(*Source, EARSaveSection::Factions);
+	TestTrue(TEXT("Loaded sections hold stored bytes"), SourcePlayersBytes.Num() > 0 && SourceFactionBytes.Num() > 0);
+
+	const EARSaveSection CopiedSections[] = { EARSaveSection::Players, EARSaveSection::Factions };
+	Dest->CopySectionsFrom(*Source, CopiedSections);
+
+	TestFalse(TEXT("Copy does not hydrate the source"), Source->IsSectionHydrated(EARSaveSection::Players));
+	TestFalse(TEXT("Copied Players stay pending"), Dest->IsSectionHydrated(EARSaveSection::Players));
+	TestFalse(TEXT("Copied Factions stay pending"), Dest->IsSectionHydrated(EARSaveSection::Factions));
+	TestTrue(TEXT("Players bytes pass through unchanged"),
+		FARSaveGameSectionTestAccess::GetPendingSectionBytes(*Dest, EARSaveSection::Players) == SourcePlayersBytes);
+	TestTrue(TEXT("Faction bytes pass through unchanged"),
+		FARSaveGameSectionTestAccess::GetPendingSectionBytes(*Dest, EARSaveSection::Factions) == SourceFactionBytes);
+	TestTrue(TEXT("Uncopied sections keep the destination's own state"), Dest->IsSectionHydrated(EARSaveSection::Dialogue)
+		&& Dest->GetNpcRelationshipStates().IsEmpty());
+
+	// Writing the destination stores the copied sections as-is, and they still decode to the original rows.
+	TArray<uint8> DestBytes;
+	if (!TestTrue(TEXT("Destination serializes"), UGameplayStatics::SaveGameToMemory(Dest, DestBytes)))
+	{
+		return false;
+	}
+
+	UARSaveGame* Reloaded = Cast<UARSaveGame>(UGameplayStatics::LoadGameFromMemory(DestBytes));
+	if (!TestNotNull(TEXT("Destination deserializes"), Reloaded))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Re-saved Players bytes are identical"),
+		FARSaveGameSectionTestAccess::GetPendingSectionBytes(*Reloaded, EARSaveSection::Players) == SourcePlayersBytes);
+	TestTrue(TEXT("Copied Players decode"), Reloaded->GetPlayerStates().Num() == 1 && Reloaded->GetPlayerStates()[0].CyclesPlayed == 3);
+	TestTrue(TEXT("Copied Factions decode"), Reloaded->GetFactionPopularityStates().Num() == 1
+		&& FMath::IsNearlyEqual(Reloaded->GetFactionPopularityStates()[0].Popularity, 0.75f));
+
+	// Hydrated sources copy their arrays instead.
+	Source->GetPlayerStates();
+	UARSaveGame* HydratedDest = Cast<UARSaveGame>(UGameplayStatics::CreateSaveGameObject(UARSaveGame::StaticClass()));
+	const EARSaveSection PlayersOnly[] = { EARSaveSection::Players };
+	HydratedDest->CopySectionsFrom(*Source, PlayersOnly);
+	TestTrue(TEXT("Hydrated copy is hydrated"), HydratedDest->IsSectionHydrated(EARSaveSection::Players));
+	TestEqual(TEXT("Hydrated copy carries the rows"), HydratedDest->GetPlayerStates().Num(), 1);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
 #include "ARContentLookupSettings.generated.h"
 
 class UContentLookupRegistry;
@@ -20,5 +21,29 @@ public:
 
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Data")
 	TSoftObjectPtr<UContentLookupRegistry> RegistryAsset;
+
+	// Stream every routed DataTable asynchronously when the game instance starts instead of sync-loading on first lookup.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Warmup")
+	bool bWarmupTablesOnStartup = true;
+
+	// Routes whose rows' soft object/class references are also streamed once their table is in (e.g. enemy classes).
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Warmup")
+	FGameplayTagContainer WarmupSoftReferenceRootTags;
+
+	// Log a warning whenever a routed DataTable still has to be loaded synchronously.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Warmup")
+	bool bReportSyncTableLoads = true;
+
+	// Serve routed rows from the baked content pack in packaged builds (the editor always reads the DataTables).
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Content Pack")
+	bool bUseContentPack = true;
+
+	// Pack location relative to the project content directory; produced by the ARBakeContentPack commandlet.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Content Pack")
+	FString ContentPackPath = TEXT("ContentPack/ARContent.arpack");
+
+	// Routes left out of the pack because their consumers need the UDataTable itself (GetDataTableForRootTag users).
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Content Pack")
+	FGameplayTagContainer ContentPackExcludedRootTags;
 };
 
@@ -0,0 +1,89 @@
+/**
+ * @file ARContentPack.h
+ * @brief Baked binary pack of registry-routed DataTable rows for Alien Ramen.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/SoftObjectPath.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+class UContentLookupRegistry;
+class UDataTable;
+struct FARContentPackHeader;
+struct FARContentPackRouteRecord;
+struct FARContentPackRowRecord;
+
+// One routed table as input to FARContentPack::Build/Verify.
+struct FARContentPackSourceRoute
+{
+	FGameplayTag RootTag;
+	FSoftObjectPath TablePath;
+	const UDataTable* Table = nullptr;
+};
+
+/**
+ * Read-only view over a baked content pack (see UARBakeContentPackCommandlet).
+ *
+ * Layout (little endian, offsets from file start, 8-byte aligned sections):
+ *   header | route records | row records (sorted by row-name hash per route) | UTF-8 string block | row payloads
+ *
+ * Row payloads are tagged-property serialized rows (names/objects as strings), so a pack survives additive
+ * row-struct changes; Verify() checks a pack against the source tables field by field.
+ * The file is memory-mapped when the platform allows it, otherwise read once into memory.
+ */
+class ALIENRAMEN_API FARContentPack
+{
+public:
+	static constexpr uint32 Magic = 0x50435241; // "ARCP"
+	static constexpr uint32 Version = 1;
+
+	FARContentPack();
+	~FARContentPack();
+	FARContentPack(const FARContentPack&) = delete;
+	FARContentPack& operator=(const FARContentPack&) = delete;
+
+	bool LoadFromFile(const FString& Path, FString& OutError);
+	bool LoadFromMemory(TArray<uint8>&& Bytes, FString& OutError);
+	void Reset();
+	bool IsLoaded() const { return Data != nullptr; }
+
+	int32 GetRouteCount() const;
+	int32 FindRoute(const FGameplayTag& RootTag) const;
+	FString GetRouteTablePath(int32 RouteIndex) const;
+	FString GetRouteRowStructPath(int32 RouteIndex) const;
+	void GetRouteRowNames(int32 RouteIndex, TArray<FName>& OutRowNames) const;
+
+	// Returns a pack-global row index, or INDEX_NONE. Binary search on the route's fixed-layout row index.
+	int32 FindRow(int32 RouteIndex, FName RowName) const;
+
+	// Deserializes one row into Dest, which must hold an initialized RowStruct.
+	bool DeserializeRow(int32 RowIndex, const UScriptStruct* RowStruct, void* Dest) const;
+
+	// Bakes the given routes into OutBytes.
+	static bool Build(TConstArrayView<FARContentPackSourceRoute> SourceRoutes, TArray<uint8>& OutBytes, FString& OutError);
+
+	// Compares every source row against its baked copy. Returns true when everything matches.
+	bool Verify(TConstArrayView<FARContentPackSourceRoute> SourceRoutes, TArray<FString>& OutMismatches) const;
+
+	// Loads (synchronously) the registry's routed tables, skipping ExcludedRootTags. Used by the bake commandlet and tests.
+	static void GatherSourceRoutes(const UContentLookupRegistry* Registry, const FGameplayTagContainer& ExcludedRootTags, TArray<FARContentPackSourceRoute>& OutRoutes);
+
+	static uint64 HashRowName(FName RowName);
+
+private:
+	bool BindMemory(const uint8* InData, int64 InSize, FString& OutError);
+	FString GetString(uint32 Offset) const;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	TArray<uint8> OwnedBytes;
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	const FARContentPackHeader* Header = nullptr;
+	const FARContentPackRouteRecord* Routes = nullptr;
+	const FARContentPackRowRecord* Rows = nullptr;
+};
@@ -0,0 +1,102 @@
+/**
+ * @file ARContinuousFireAbility.h
+ * @brief Native held-trigger primary fire ability for Alien Ramen.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbility.h"
+#include "ARContinuousFireAbility.generated.h"
+
+/** Fixed-rate shot accumulator behind UARContinuousFireAbility. Plain arithmetic over times and rates. */
+struct ALIENRAMEN_API FARFireAccumulator
+{
+	// Starts a trigger press. The first press fires on the next step; a re-press inside the cadence waits it out.
+	void Begin(double Now, float FireRate);
+
+	// Advances to Now and returns the shots that came due, at most MaxShots (any backlog beyond it is dropped).
+	int32 Step(double Now, float FireRate, int32 MaxShots);
+
+	// Seconds since shot ShotIndex (0 = oldest) of the last emitting step came due; 0 for the newest shot on a step boundary.
+	float GetShotTimeOffset(int32 ShotIndex, int32 ShotCount) const;
+
+	// Seconds between consecutive shots of the last emitting step.
+	float GetShotInterval() const { return 1.f / FMath::Max(LastFireRate, 0.01f); }
+
+	float Pending = 0.f;
+	// Accumulator remainder and fire rate at the last emission, for GetShotTimeOffset.
+	float LastRemainder = 0.f;
+	float LastFireRate = 1.f;
+	double LastStepTime = 0.0;
+	double LastShotTime = 0.0;
+	bool bHasFired = false;
+};
+
+/**
+ * Primary fire that activates once while the trigger is held and emits shots from a fixed-rate accumulator.
+ * - Cadence reads the FireRate attribute every step, so the weapon's base rate effect and fire-rate upgrades apply
+ *   exactly as they do for UMMC_FireCooldownDuration (one shot per 1/FireRate seconds).
+ * - Authority spawns the primary weapon's ProjectileClass. Projectiles replicate as actors; there is no per-shot
+ *   activation, cooldown effect or RPC. Shots emitted together are advanced along their velocity by how long ago
+ *   each came due, so a step's batch leaves evenly spaced instead of stacked at the muzzle.
+ * - The weapon's DamageEffect/BaseDamage are not applied here: projectiles own their hit damage, as with the
+ *   per-shot fire ability this replaces.
+ * - BP_OnShotsFired runs once per step with that step's shot count, on the server and the predicting client.
+ *   Simulated proxies get the same step as one unreliable ship multicast (count plus shot spacing), see
+ *   AARPlayerCharacterInvader::BP_OnRemoteShotsFired.
+ * - Abilities are activated by tag without input IDs, so InputReleased never fires. The trigger-release path must
+ *   end it with CancelAbilityByTag; until then it keeps firing.
+ */
+UCLASS(Blueprintable)
+class ALIENRAMEN_API UARContinuousFireAbility : public UGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UARContinuousFireAbility();
+
+	virtual void ActivateAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		const FGameplayEventData* TriggerEventData) override;
+
+	virtual void EndAbility(
+		const FGameplayAbilitySpecHandle Handle,
+		const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo,
+		bool bReplicateEndAbility,
+		bool bWasCancelled) override;
+
+protected:
+	// Seconds between accumulator steps. Shots that come due inside one step are emitted together.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AR|Ship|Weapon", meta = (ClampMin = "0.005"))
+	float StepInterval = 1.f / 60.f;
+
+	// Cap on shots emitted in one step; a hitch drops the backlog instead of bursting it.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AR|Ship|Weapon", meta = (ClampMin = "1"))
+	int32 MaxShotsPerStep = 4;
+
+	// Projectile spawn point relative to the ship, in ship space.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AR|Ship|Weapon")
+	FVector MuzzleOffset = FVector(100.f, 0.f, 0.f);
+
+	// Authority only. Default spawns the primary weapon's ProjectileClass ShotCount times at the muzzle, each
+	// advanced by GetShotTimeOffset.
+	UFUNCTION(BlueprintNativeEvent, Category = "AR|Ship|Weapon")
+	void SpawnShotProjectiles(int32 ShotCount);
+
+	// Seconds since shot ShotIndex (0 = oldest) of the current step came due; 0 for the newest shot on a step boundary.
+	UFUNCTION(BlueprintPure, Category = "AR|Ship|Weapon")
+	float GetShotTimeOffset(int32 ShotIndex, int32 ShotCount) const;
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "AR|Ship|Weapon")
+	void BP_OnShotsFired(int32 ShotCount);
+
+private:
+	void StepFire();
+	float GetCurrentFireRate() const;
+
+	FTimerHandle StepTimerHandle;
+	FARFireAccumulator Accumulator;
+};
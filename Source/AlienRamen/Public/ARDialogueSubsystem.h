@@ -22,6 +22,7 @@ class ALIENRAMEN_API UARDialogueSubsystem : public UGameInstanceSubsystem
 public:
 	UARDialogueSubsystem();
 	virtual ~UARDialogueSubsystem() override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Dialogue")
@@ -43,6 +44,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Dialogue")
 	bool HasUnlockedDialogueForNpcForAnyPlayer(FGameplayTag NpcTag) const;
 
+	// Adds every NPC with a dialogue node gated on one of the changed tags (or a parent of one) to OutNpcTags.
+	// Seen history, canonical choices and relationship state only affect their own NPC, so they are not tracked here.
+	void GatherNpcsAffectedByTagChanges(
+		const FGameplayTagContainer& ChangedProgressionTags,
+		const FGameplayTagContainer& ChangedUnlockTags,
+		TSet<FGameplayTag>& OutNpcTags) const;
+
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Dialogue")
 	bool GetLocalViewForController(const AARPlayerController* RequestingController, FARDialogueClientView& OutView) const;
 
@@ -57,5 +65,13 @@ private:
 	FARDialogueRuntimeState& GetRuntimeState();
 	const FARDialogueRuntimeState& GetRuntimeState() const;
 
+	// Pre-sorted dialogue rows for one NPC (priority desc, then node tag), or null if it has none.
+	// The per-NPC index is built on first use and rebuilt when content lookup reports a content change.
+	const TArray<FARDialogueNodeRow>* FindCandidateRowsForNpc(FGameplayTag NpcTag) const;
+	bool EnsureCandidateIndex() const;
+
+	UFUNCTION()
+	void HandleContentWarmupCompleted();
+
 	mutable FARDialogueRuntimeState* RuntimeState = nullptr;
 };
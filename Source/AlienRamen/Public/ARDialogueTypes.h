@@ -146,8 +146,43 @@ struct ALIENRAMEN_API FARPlayerDialogueHistoryState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
 	FARPlayerIdentity Identity;
 
+	// Legacy (schema <= 7) seen set. UARSaveGame::CompactDialogueHistory folds it into SeenNodeBits and empties it.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
 	FGameplayTagContainer SeenNodeTags;
+
+	// One bit per stable dialogue node index (see UARSaveGame::FindOrAddDialogueNodeIndex).
+	UPROPERTY(EditAnywhere, Category = "Dialogue")
+	TArray<uint32> SeenNodeBits;
+
+	bool HasSeenNodeIndex(const int32 NodeIndex) const
+	{
+		const int32 Word = NodeIndex >> 5;
+		return NodeIndex >= 0 && SeenNodeBits.IsValidIndex(Word) && (SeenNodeBits[Word] & (1u << (NodeIndex & 31))) != 0;
+	}
+
+	// Returns true when the bit was not already set.
+	bool MarkNodeIndexSeen(const int32 NodeIndex)
+	{
+		if (NodeIndex < 0)
+		{
+			return false;
+		}
+
+		const int32 Word = NodeIndex >> 5;
+		if (Word >= SeenNodeBits.Num())
+		{
+			SeenNodeBits.SetNumZeroed(Word + 1);
+		}
+
+		const uint32 Mask = 1u << (NodeIndex & 31);
+		if ((SeenNodeBits[Word] & Mask) != 0)
+		{
+			return false;
+		}
+
+		SeenNodeBits[Word] |= Mask;
+		return true;
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -15,14 +15,19 @@
 #include "StateTreeEvents.h"
 #include "GameFramework/Character.h"
 #include "ARInvaderTypes.h"
+#include "AREnemyIncomingDamageEffect.h"
 #include "AREnemyBase.generated.h"
 
 class AAREnemyAIController;
+class UAREnemyStateTreeExecutorSubsystem;
+class UARInvaderDirectorSubsystem;
 class UAbilitySystemComponent;
 class UARAttributeSetCore;
+class UARFormationMovementComponent;
 class UAREnemyAttributeSet;
 class UARStateTreeAIComponent;
 class UGameplayEffect;
+class UStateTree;
 struct FOnAttributeChangeData;
 
 UCLASS()
@@ -36,6 +41,12 @@ public:
 	// IAbilitySystemInterface
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
 
+	// Soft paths of the common and best-matching archetype startup ability sets, for async preloading.
+	static void GetStartupAbilitySetPaths(const FGameplayTag& ArchetypeTag, TArray<FSoftObjectPath>& OutPaths);
+
+	// Compiles ArchetypeTag's startup grant list into Director's cache if its ability sets are loaded; no-op otherwise.
+	static void PrewarmStartupAbilitySet(UARInvaderDirectorSubsystem& Director, const FGameplayTag& ArchetypeTag);
+
 	UFUNCTION(BlueprintCallable, Category = "AR|Enemy|GAS")
 	UAbilitySystemComponent* GetASC() const { return AbilitySystemComponent; }
 
@@ -193,6 +204,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AR|Enemy|Invader")
 	bool HasFormationTargetWorldLocation() const { return bHasFormationTargetWorldLocation; }
 
+	// Kinematic entry/hold/dive movement; inactive unless enabled on the enemy Blueprint.
+	UFUNCTION(BlueprintPure, Category = "AR|Enemy|Invader")
+	UARFormationMovementComponent* GetFormationMovement() const { return FormationMovement; }
+
 	// Convenience accessors for controller-owned StateTree runtime.
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Enemy|AI|State")
 	AAREnemyAIController* GetEnemyAIController() const;
@@ -200,6 +215,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Enemy|AI|State")
 	UARStateTreeAIComponent* GetEnemyStateTreeComponent() const;
 
+	// True when this enemy has no controller and its StateTree runs in the shared executor.
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Enemy|AI|State")
+	bool IsRunningInSharedStateTreeExecutor() const { return bUsesSharedStateTreeExecutor; }
+
+	// Skips the per-enemy AI controller when the shared executor can run SharedExecutorStateTree.
+	virtual void SpawnDefaultController() override;
+
 	// Sends a fully-authored StateTree event via this enemy's AI controller (authority only).
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Enemy|AI|State", meta = (BlueprintAuthorityOnly))
 	bool SendEnemyStateTreeEvent(const FStateTreeEvent& Event);
@@ -236,6 +258,7 @@ protected:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	void InitAbilityActorInfo();
+	void InitializeEnemyRuntime();
 	void ApplyStartupAbilitySet();
 	void ClearStartupAbilitySet();
 	void ApplyRuntimeEnemyEffects(const TArray<TSubclassOf<UGameplayEffect>>& Effects);
@@ -269,6 +292,11 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AR|Enemy|GAS")
 	TObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
 
+	// Tree run by UAREnemyStateTreeExecutorSubsystem when bUseSharedEnemyStateTreeExecutor is enabled.
+	// Must use UARStateTreeEnemySchema; otherwise the enemy falls back to its AI controller.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Alien Ramen|Enemy|AI|State")
+	TObjectPtr<UStateTree> SharedExecutorStateTree;
+
 	// StateTree-friendly alias so tasks/conditions can bind ASC directly from Actor context.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AR|Enemy|GAS")
 	TObjectPtr<UAbilitySystemComponent> StateTreeASC;
@@ -279,6 +307,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AR|Enemy|GAS")
 	TObjectPtr<UAREnemyAttributeSet> EnemyAttributeSet;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AR|Enemy|Invader")
+	TObjectPtr<UARFormationMovementComponent> FormationMovement;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_EnemyColor, Category = "AR|Enemy|Gameplay")
 	EARAffinityColor EnemyColor = EARAffinityColor::Red;
 
@@ -365,6 +396,7 @@ private:
 	bool bUpdatingEnemyColorFromTags = false;
 	bool bApplyingEnemyColorTags = false;
 	bool bCountedAsLeak = false;
+	bool bUsesSharedStateTreeExecutor = false;
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AR|Enemy|Invader", meta = (AllowPrivateAccess = "true"))
 	bool bHasEnteredScreen = false;
 	bool bHasEnteredGameplayScreen = false;
@@ -377,9 +409,11 @@ private:
 
 	TWeakObjectPtr<AActor> LastDamageInstigatorActor;
 	float LastDamageInstigatorServerTime = -1.0f;
+	FARIncomingDamageSpecCache IncomingDamageSpecs;
 
 	TMap<FGameplayTag, int32> ASCStateTagRefCounts;
 
+	UAREnemyStateTreeExecutorSubsystem* GetSharedStateTreeExecutor() const;
 	void TryDispatchWavePhaseEvent();
 	void TryDispatchEnteredScreenEvent();
 	void TryDispatchInFormationEvent();
@@ -6,8 +6,11 @@
 
 #include "CoreMinimal.h"
 #include "GameplayEffect.h"
+#include "UObject/ObjectKey.h"
 #include "AREnemyIncomingDamageEffect.generated.h"
 
+class UAbilitySystemComponent;
+
 /**
  * Runtime damage effect used to route damage through IncomingDamage meta-attribute.
  */
@@ -18,4 +21,28 @@ class ALIENRAMEN_API UAREnemyIncomingDamageEffect : public UGameplayEffect
 
 public:
 	UAREnemyIncomingDamageEffect();
+
+	// SetByCaller name carrying the damage magnitude.
+	static FName GetDamageDataName();
+};
+
+/**
+ * Incoming-damage specs for one ASC, one per damage source (offender).
+ *
+ * The first hit from a source builds the context (instigator = offender) and the spec; later hits only write the
+ * new SetByCaller magnitude. Applying a spec copies it, so the cached one is never mutated by GAS. The cache resets
+ * itself when used with a different ASC (e.g. the ship's PlayerState ASC after a re-possess).
+ */
+class ALIENRAMEN_API FARIncomingDamageSpecCache
+{
+public:
+	// Returns the spec to apply to ASC for this hit, or null if the damage spec could not be built.
+	const FGameplayEffectSpec* Prepare(UAbilitySystemComponent& ASC, AActor* Offender, float Damage);
+	void Reset();
+
+private:
+	static constexpr int32 MaxCachedSources = 16;
+
+	TWeakObjectPtr<UAbilitySystemComponent> OwnerASC;
+	TMap<TObjectKey<AActor>, FGameplayEffectSpecHandle> SpecsBySource;
 };
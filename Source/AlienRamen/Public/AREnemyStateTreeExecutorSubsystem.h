@@ -0,0 +1,119 @@
+/**
+ * @file AREnemyStateTreeExecutorSubsystem.h
+ * @brief Shared, controller-less StateTree execution for invader enemies.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "StateTreeEvents.h"
+#include "StateTreeInstanceData.h"
+#include "ARInvaderTypes.h"
+#include "ARStateTreeAIComponent.h"
+#include "AREnemyStateTreeExecutorSubsystem.generated.h"
+
+class AAREnemyBase;
+class UStateTree;
+struct FStateTreeExecutionContext;
+
+/** One enemy's tree run inside the shared executor. */
+USTRUCT()
+struct FAREnemyStateTreeInstance
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<AAREnemyBase> Enemy;
+
+	UPROPERTY()
+	TObjectPtr<UStateTree> StateTree = nullptr;
+
+	UPROPERTY()
+	FStateTreeInstanceData InstanceData;
+
+	// Active state tags currently pushed onto the enemy ASC (the controller tag bridge, without a controller).
+	FGameplayTagContainer AppliedStateTags;
+	uint16 ObservedStateChangeCount = 0;
+	int32 StartAttemptCounter = 0;
+	int32 LastSentWavePhaseWaveId = INDEX_NONE;
+	EARWavePhase LastSentWavePhase = EARWavePhase::Berserk;
+	int32 LastSentEnteredScreenWaveId = INDEX_NONE;
+	int32 LastSentInFormationWaveId = INDEX_NONE;
+	bool bStartRequested = false;
+	bool bRunning = false;
+	bool bPendingRemoval = false;
+};
+
+/**
+ * Runs invader enemy StateTrees from one world-level batched update instead of a per-enemy AI controller and
+ * StateTree component.
+ *
+ * Enemies opt in with UARInvaderDirectorSettings::bUseSharedEnemyStateTreeExecutor plus a SharedExecutorStateTree
+ * authored with UARStateTreeEnemySchema; they then spawn without a controller. Starts requested by wave context are
+ * picked up by the next batch (no per-enemy next-tick timer), active state tags are mirrored onto the enemy ASC like
+ * the controller bridge does, and wave events are deduped per enemy. Server only.
+ */
+UCLASS()
+class ALIENRAMEN_API UAREnemyStateTreeExecutorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	// Returns false when StateTree cannot run without a controller (schema other than UARStateTreeEnemySchema).
+	bool RegisterEnemy(AAREnemyBase& Enemy, UStateTree& StateTree);
+	void UnregisterEnemy(AAREnemyBase& Enemy, const FString& Reason);
+	bool IsEnemyRegistered(const AAREnemyBase& Enemy) const;
+
+	// Starts the enemy's tree in the next batch once it has wave context. Idempotent while running.
+	void RequestStart(AAREnemyBase& Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Enemy|AI|State")
+	bool IsEnemyStateTreeRunning(const AAREnemyBase* Enemy) const;
+
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Enemy|AI|State")
+	FGameplayTagContainer GetEnemyActiveStateTags(const AAREnemyBase* Enemy) const;
+
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Enemy|AI|State")
+	int32 GetNumRegisteredEnemies() const { return Instances.Num() + PendingInstances.Num(); }
+
+	bool SendStateTreeEvent(AAREnemyBase& Enemy, const FStateTreeEvent& Event);
+	void NotifyWavePhaseChanged(AAREnemyBase& Enemy, int32 WaveInstanceId, EARWavePhase NewPhase);
+	void NotifyEnemyEnteredScreen(AAREnemyBase& Enemy, int32 WaveInstanceId);
+	void NotifyEnemyInFormation(AAREnemyBase& Enemy, int32 WaveInstanceId);
+
+private:
+	FAREnemyStateTreeInstance* FindInstance(const AAREnemyBase& Enemy);
+	const FAREnemyStateTreeInstance* FindInstance(const AAREnemyBase& Enemy) const;
+
+	bool MakeExecutionContextReady(FStateTreeExecutionContext& Context, AAREnemyBase& Enemy, const UStateTree& StateTree) const;
+	void TryStartInstance(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy);
+	void TickInstance(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, float DeltaTime);
+	void StopInstance(FAREnemyStateTreeInstance& Instance, const FString& Reason);
+	void RefreshStateTags(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, const FStateTreeExecutionContext& Context);
+	void ApplyStateTags(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, const FGameplayTagContainer& NewTags);
+	bool SendWaveEvent(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy, const FGameplayTag& EventTag, int32 WaveInstanceId);
+	void ReplayWaveFacts(FAREnemyStateTreeInstance& Instance, AAREnemyBase& Enemy);
+	void FlushStructuralChanges();
+	void RebuildInstanceIndex();
+
+	// Batch storage; indices are stable during Tick (adds go to PendingInstances, removals are marked).
+	UPROPERTY(Transient)
+	TArray<FAREnemyStateTreeInstance> Instances;
+
+	UPROPERTY(Transient)
+	TArray<FAREnemyStateTreeInstance> PendingInstances;
+
+	TMap<TObjectKey<AAREnemyBase>, int32> InstanceIndexByEnemy;
+
+	// Shared by every enemy running the same tree asset.
+	FARStateTreeStateTagReader StateTagReader;
+
+	bool bTickingInstances = false;
+};
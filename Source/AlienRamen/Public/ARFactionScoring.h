@@ -0,0 +1,58 @@
+/**
+ * @file ARFactionScoring.h
+ * @brief Cached faction definitions and incremental popularity-rule scoring for Alien Ramen.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ARFactionTypes.h"
+
+/**
+ * Session cache of resolved faction rows plus a condition-tag -> faction index over their popularity rules.
+ *
+ * UpdateModifierDeltas diffs the progression tags against the set last scored and re-scores only factions
+ * with a rule on a changed tag (or a parent of one, since rules match hierarchically). The owner rebuilds the
+ * index when the underlying content changes. No UObject dependencies, so it can be driven headless.
+ */
+class ALIENRAMEN_API FARFactionScoringIndex
+{
+public:
+	struct FEntry
+	{
+		FGameplayTag FactionTag;
+		FARFactionDefinitionRow Definition;
+		float ModifierDelta = 0.0f;
+	};
+
+	struct FRankedFaction
+	{
+		int32 EntryIndex = INDEX_NONE;
+		float DriftedPopularity = 0.0f;
+		float EffectiveScore = 0.0f;
+	};
+
+	void Reset();
+	void Build(TArray<FEntry>&& InEntries);
+	bool IsBuilt() const { return bBuilt; }
+
+	const TArray<FEntry>& GetEntries() const { return Entries; }
+	const FEntry* FindEntry(const FGameplayTag& FactionTag) const;
+
+	// Brings every entry's ModifierDelta up to date with ProgressionTags. Returns how many factions were re-scored.
+	int32 UpdateModifierDeltas(const FGameplayTagContainer& ProgressionTags);
+
+	// Applies one cycle of drift to each faction's prior popularity (persisted value, else BasePopularity) and
+	// returns factions ordered by effective score, then tag. Call UpdateModifierDeltas first.
+	void RankWithDrift(const TMap<FGameplayTag, float>& PersistedPopularity, TArray<FRankedFaction>& OutRanked) const;
+
+	static float ComputeModifierDelta(const FARFactionDefinitionRow& Row, const FGameplayTagContainer& ProgressionTags);
+	static float ClampPopularity(const FARFactionDefinitionRow& Row, float Value);
+
+private:
+	TArray<FEntry> Entries;
+	TMap<FGameplayTag, int32> EntryIndexByTag;
+	TMap<FGameplayTag, TArray<int32>> EntriesByConditionTag;
+	FGameplayTagContainer ScoredProgressionTags;
+	bool bBuilt = false;
+	bool bScored = false;
+};
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "ARFactionScoring.h"
 #include "ARFactionTypes.h"
 #include "ARFactionSubsystem.generated.h"
 
@@ -56,26 +57,29 @@ public:
 	FAROnFactionElectionFinalized OnFactionElectionFinalized;
 
 private:
+#if WITH_DEV_AUTOMATION_TESTS
+	// Lets the faction benchmark seed the scoring index with synthetic definitions instead of routed content.
+	friend struct FARFactionBenchmarkAccess;
+#endif
+
 	struct FFactionResolvedDef
 	{
 		FGameplayTag FactionTag;
-		FARFactionDefinitionRow Definition;
 		float EffectiveScore = 0.0f;
 		float DriftedPopularity = 0.0f;
 	};
 
 	bool EnsureElectionSnapshot();
-	bool BuildResolvedDefinitions(TArray<FFactionResolvedDef>& OutDefs, FString& OutError) const;
+	// Resolves every faction row once per content serial (see UContentLookupSubsystem::GetContentSerial).
+	bool EnsureDefinitionCache(FString& OutError);
+	bool BuildResolvedDefinitions(TArray<FFactionResolvedDef>& OutDefs, FString& OutError);
 	bool ResolveFactionDefinition(const FGameplayTag& FactionTag, FARFactionDefinitionRow& OutRow, FString& OutError) const;
-	float ComputeModifierDelta(const FARFactionDefinitionRow& Row, const FGameplayTagContainer& ProgressionTags) const;
 	void CommitPopularitySnapshotToSave(UARSaveSubsystem* SaveSubsystem) const;
 	bool TryResolveWinnerFromVotes(const TArray<FGameplayTag>& RankedFactions, FGameplayTag& OutWinner, EARFactionWinnerReason& OutReason) const;
 	bool ApplyWinner(UARSaveSubsystem* SaveSubsystem, const FGameplayTag& WinnerFactionTag, EARFactionWinnerReason Reason);
 
 	static int32 FindVoteIndexBySlot(const TArray<FARFactionVoteSelection>& InVotes, EARPlayerSlot Slot);
 	static bool IsFactionInCandidates(const TArray<FGameplayTag>& Candidates, const FGameplayTag& FactionTag);
-	static bool SortByScoreThenTag(const FFactionResolvedDef& A, const FFactionResolvedDef& B);
-	static float ClampPopularity(const FARFactionDefinitionRow& Row, float Value);
 	static FGameplayTag BuildFactionTagFromRootAndLeaf(const FGameplayTag& RootTag, FName LeafRowName);
 
 	UPROPERTY(Transient)
@@ -92,4 +96,7 @@ private:
 
 	UPROPERTY(Transient)
 	bool bSnapshotValid = false;
+
+	FARFactionScoringIndex ScoringIndex;
+	uint32 ScoringContentSerial = 0;
 };
@@ -0,0 +1,166 @@
+/**
+ * @file ARFormationMovementComponent.h
+ * @brief Kinematic entry/hold/dive movement for invader enemies.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/MovementComponent.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/NetSerialization.h"
+#include "ARFormationMovementComponent.generated.h"
+
+class AAREnemyBase;
+class UCurveFloat;
+
+UENUM(BlueprintType)
+enum class EARFormationMotionPhase : uint8
+{
+	None = 0,
+	Entering = 1,
+	Holding = 2,
+	Diving = 3
+};
+
+/** Authored path shape shared by every enemy of a class. */
+USTRUCT(BlueprintType)
+struct FARFormationPathShape
+{
+	GENERATED_BODY()
+
+	// Normalized entry time -> normalized progress along spawn->slot. Linear when unset.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Entry")
+	TObjectPtr<UCurveFloat> EntryProgressCurve = nullptr;
+
+	// Normalized entry time -> sideways offset (perpendicular to spawn->slot, on the gameplay plane). Should be 0 at both ends.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Entry")
+	TObjectPtr<UCurveFloat> EntryLateralCurve = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Entry")
+	float EntryLateralScale = 1.f;
+
+	// Entry duration is spawn->slot distance over move speed, clamped to this range.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Entry", meta = (ClampMin = "0.01"))
+	float MinEntryDuration = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Entry", meta = (ClampMin = "0.01"))
+	float MaxEntryDuration = 6.f;
+
+	// Side-to-side sway around the formation slot while holding (along world Y). 0 disables.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hold", meta = (ClampMin = "0.0"))
+	float HoldSwayAmplitude = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hold", meta = (ClampMin = "0.01"))
+	float HoldSwayPeriod = 2.f;
+};
+
+/** Replicated motion segment. Changes only on phase transitions; positions in between are evaluated from time. */
+USTRUCT(BlueprintType)
+struct FARFormationMotionState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	EARFormationMotionPhase Phase = EARFormationMotionPhase::None;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	FVector_NetQuantize10 StartLocation = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	FVector_NetQuantize10 SlotLocation = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	FVector_NetQuantizeNormal DiveDirection = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	float StartServerTime = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	float EntryDuration = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	float DiveSpeed = 0.f;
+
+	// Wave mirror flags; entry lateral offsets and hold sway are mirrored to match the mirrored spawn layout.
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	bool bFlipX = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Formation")
+	bool bFlipY = false;
+};
+
+/**
+ * Kinematic replacement for character movement on invader enemies.
+ *
+ * Positions are evaluated analytically from a replicated motion segment (entry curve -> formation slot -> hold sway,
+ * or straight-line dive), so there is no per-frame physics step or network smoothing. The capsule is only swept when
+ * it blocks one of SweepTriggerChannels; otherwise it is placed directly and clients evaluate the same segment
+ * locally with actor movement replication off. While swept, the server stays authoritative and replicates movement.
+ *
+ * Off unless activated (enable Auto Activate on the enemy Blueprint); while active, the character movement
+ * component is suspended.
+ */
+UCLASS(ClassGroup = (AlienRamen), BlueprintType, meta = (BlueprintSpawnableComponent))
+class ALIENRAMEN_API UARFormationMovementComponent : public UMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	UARFormationMovementComponent();
+
+	virtual void BeginPlay() override;
+	virtual void Activate(bool bReset = false) override;
+	virtual void Deactivate() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Starts an entry from the current location to the owner's formation target (authority only).
+	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Enemy|Movement", meta = (BlueprintAuthorityOnly))
+	bool StartFormationEntry(bool bInFlipX, bool bInFlipY);
+
+	// Leaves the formation in a straight line. Speed <= 0 uses the owner's MoveSpeed attribute.
+	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Enemy|Movement", meta = (BlueprintAuthorityOnly))
+	bool StartDive(FVector WorldDirection, float Speed = 0.f);
+
+	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Enemy|Movement", meta = (BlueprintAuthorityOnly))
+	void StopFormationMovement();
+
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Enemy|Movement")
+	EARFormationMotionPhase GetMotionPhase() const { return MotionState.Phase; }
+
+	// Re-reads capsule collision responses; call after they change.
+	void RefreshSweepRequirement();
+
+	bool IsSweepRequired() const { return bSweepRequired; }
+
+	// Pure evaluation of a segment at ServerTime. Entering past its duration evaluates as holding.
+	static FVector EvaluateLocation(const FARFormationMotionState& State, const FARFormationPathShape& Shape, float ServerTime);
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Alien Ramen|Enemy|Movement")
+	FARFormationPathShape PathShape;
+
+	// The capsule is swept only when it blocks one of these; projectiles and drops sweep themselves. Empty by default
+	// so enemies are placed directly; add Player here only if enemies must be stopped by player capsules.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Alien Ramen|Enemy|Movement")
+	TArray<TEnumAsByte<ECollisionChannel>> SweepTriggerChannels;
+
+	UFUNCTION()
+	void OnRep_MotionState();
+
+private:
+	AAREnemyBase* GetOwnerEnemy() const;
+	float GetServerTimeSeconds() const;
+	float ResolveOwnerMoveSpeed() const;
+	void SetMotionState(const FARFormationMotionState& NewState);
+	void AdvanceServerPhase(float ServerTime);
+	void ApplyMovementMode();
+	void SuspendCharacterMovement(bool bSuspend);
+
+	UPROPERTY(ReplicatedUsing = OnRep_MotionState)
+	FARFormationMotionState MotionState;
+
+	// Server-decided; clients simulate locally only while this is false.
+	UPROPERTY(ReplicatedUsing = OnRep_MotionState)
+	bool bSweepRequired = false;
+};
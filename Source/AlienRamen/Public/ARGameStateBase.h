@@ -302,6 +302,34 @@ public:
 
 	virtual bool ApplyStateFromStruct_Implementation(const FInstancedStruct& SavedState) override;
 
+	/**
+	 * Typed IStructSerializable fast path shared by the mode state structs (FAR*GameStateData). Registered per struct in
+	 * the constructor; writes fields directly, matching the by-name reflection copy it replaces.
+	 */
+	template <typename TState>
+	void ExtractTypedState(TState& OutState) const
+	{
+		OutState.Unlocks = Unlocks;
+		OutState.Money = Money;
+		OutState.Scrap = Scrap;
+		OutState.Meat = Meat;
+		OutState.Cycles = Cycles;
+		OutState.ActiveFactionTag = ActiveFactionTag;
+		OutState.ActiveFactionEffectTags = ActiveFactionEffectTags;
+	}
+
+	template <typename TState>
+	void ApplyTypedState(const TState& State)
+	{
+		Unlocks = State.Unlocks;
+		Money = State.Money;
+		Scrap = State.Scrap;
+		Meat = State.Meat;
+		Cycles = State.Cycles;
+		ActiveFactionTag = State.ActiveFactionTag;
+		ActiveFactionEffectTags = State.ActiveFactionEffectTags;
+	}
+
 	/** Called by SaveSubsystem after hydration completes to inform UI widgets. */
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Save")
 	void NotifyHydratedFromSave();
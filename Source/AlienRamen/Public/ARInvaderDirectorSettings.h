@@ -63,6 +63,10 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Enemy|Abilities")
 	TArray<FAREnemyArchetypeAbilitySetEntry> EnemyArchetypeAbilitySets;
 
+	// Enemies with a SharedExecutorStateTree spawn without an AI controller and run in UAREnemyStateTreeExecutorSubsystem.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Enemy|AI")
+	bool bUseSharedEnemyStateTreeExecutor = false;
+
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Data")
 	FName InitialStageRow;
 
@@ -208,7 +212,7 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "SoftCaps")
 	bool bBlockSpawnsWhenEnemySoftCapExceeded = false;
 
-	// Number of eligible wave definitions to peek ahead when preloading enemy classes.
+	// Number of eligible wave definitions to peek ahead when preloading enemy classes and startup ability sets.
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "SoftCaps", meta=(ClampMin="0", UIMin="0"))
 	int32 EnemyPreloadWaveLookahead = 2;
 
@@ -18,6 +18,9 @@ class AARPlayerStateBase;
 class AARGameStateBase;
 class UAbilitySystemComponent;
 struct FStreamableHandle;
+struct FGameplayEffectSpec;
+struct FAREnemyCompiledStartupSet;
+struct FPropertyChangedEvent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAROnInvaderRunEndedSignature, EARInvaderRunEndReason, Reason);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAROnInvaderEnemyLeakedSignature, int32, NewLeakCount, int32, Delta);
@@ -123,7 +126,23 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Alien Ramen|Invader")
 	FAROnInvaderPlayerDeadChangedSignature OnPlayerDeadChanged;
 
+	// Enemy startup ability sets compiled by AAREnemyBase, per archetype tag. Dropped with the subsystem, on
+	// Blueprint reinstancing and on ability set/director settings edits, so entries never outlive their classes.
+	TMap<FGameplayTag, TSharedPtr<FAREnemyCompiledStartupSet>>& GetCompiledStartupSets() { return CompiledStartupSets; }
+
 private:
+	void HandleObjectsReinstanced(const TMap<UObject*, UObject*>& ReplacementMap);
+#if WITH_EDITOR
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+#endif
+
+	// Enemy effect spec built once per wave and effect class. Specs that read their source are re-pointed at each enemy.
+	struct FCachedEnemyEffectSpec
+	{
+		TSharedPtr<FGameplayEffectSpec> Spec;
+		bool bRequiresSourceContext = false;
+	};
+
 	struct FWaveRuntimeInternal
 	{
 		int32 WaveInstanceId = INDEX_NONE;
@@ -141,6 +160,8 @@ private:
 		FName StageRowName = NAME_None;
 		EARWavePhase Phase = EARWavePhase::Active;
 		TArray<TWeakObjectPtr<class AAREnemyBase>> SpawnedEnemies;
+		// Stage, wave and spawn-entry effects, built on first use by any enemy of this wave.
+		TMap<TObjectKey<UClass>, FCachedEnemyEffectSpec> EnemyEffectSpecs;
 	};
 
 	void TickDirector(float DeltaTime);
@@ -179,12 +200,15 @@ private:
 	bool TransitionWavePhase(FWaveRuntimeInternal& Wave, EARWavePhase NewPhase);
 	bool SelectWave(FName& OutWaveRow, FARWaveDefRow& OutWaveDef, bool& bOutColorSwap);
 	bool SelectStage(FName& OutStageRow, FARStageDefRow& OutStageDef, const TSet<FName>* ExcludedRows = nullptr);
-	bool ResolveEnemyDefinitionByTag(FGameplayTag EnemyIdentifierTag, FARInvaderEnemyDefRow& OutDef, FString& OutError);
+	// Returns the resident DataTable row (no copy) or a cached normalized row for legacy/incomplete rows.
+	// The pointer stays valid across further resolves until the director resets; do not store it beyond that.
+	const FARInvaderEnemyDefRow* ResolveEnemyDefinitionByTag(FGameplayTag EnemyIdentifierTag, FString& OutError);
 	void PreloadEnemyClassesForWaveCandidates();
 	void PreloadEnemyClass(const TSoftClassPtr<AAREnemyBase>& EnemyClassRef);
+	void PreloadEnemyAbilitySets(const FGameplayTag& ArchetypeTag);
 	FVector ComputeFormationTargetLocation(const FARWaveEnemySpawnDef& SpawnDef, bool bFlipX, bool bFlipY) const;
 	FVector ComputeSpawnLocation(const FARWaveEnemySpawnDef& SpawnDef, int32 SpawnOrdinal, bool bFlipX, bool bFlipY) const;
-	void ApplyEnemyGameplayEffects(class AAREnemyBase* Enemy, const FARWaveDefRow& WaveDef, const FARWaveEnemySpawnDef& SpawnDef);
+	void ApplyEnemyGameplayEffects(class AAREnemyBase* Enemy, FWaveRuntimeInternal& Wave, const FARWaveEnemySpawnDef& SpawnDef);
 	bool IsInsideGameplayBounds(const FVector& Location) const;
 	bool IsInsideEnteredScreenBounds(const FVector& Location) const;
 	UARInvaderRuntimeStateComponent* GetOrCreateRuntimeComponent();
@@ -265,8 +289,17 @@ private:
 	TObjectPtr<UDataTable> WaveTable = nullptr;
 	TObjectPtr<UDataTable> StageTable = nullptr;
 
-	TMap<FGameplayTag, FARInvaderEnemyDefRow> EnemyDefinitionCache;
+	// Normalized copies for rows that cannot be served in place (legacy row structs, missing tag/health defaults).
+	// Shared refs keep each row at a stable address: ResolveEnemyDefinitionByTag callers hold the returned pointer
+	// across further lookups. Entries live until the cache is reset between director sessions.
+	TMap<FGameplayTag, TSharedRef<FARInvaderEnemyDefRow>> EnemyDefinitionCache;
 	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> EnemyClassPreloadHandles;
+	TMap<FGameplayTag, TSharedPtr<FStreamableHandle>> EnemyAbilitySetPreloadHandles;
+	TMap<FGameplayTag, TSharedPtr<FAREnemyCompiledStartupSet>> CompiledStartupSets;
+	FDelegateHandle ObjectsReinstancedHandle;
+#if WITH_EDITOR
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
 
 	TMap<TWeakObjectPtr<class AAREnemyBase>, float> OffscreenDurationByEnemy;
 
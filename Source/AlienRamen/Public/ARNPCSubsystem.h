@@ -9,14 +9,59 @@
 #include "ARDialogueTypes.h"
 #include "ARNPCSubsystem.generated.h"
 
+class UARSaveGame;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAROnNpcTalkableChanged, FGameplayTag, NpcTag, bool, bNewTalkable);
 
+// Refers to one NPC's relationship state in the current save. Resolves to null once the save is swapped or the state moves.
+struct FARNpcStateHandle
+{
+	FGameplayTag NpcTag;
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * Tag -> slot index over a save's NpcRelationshipStates array.
+ *
+ * The save array stays the only copy of the state; writes through resolved pointers land in it directly, so a
+ * commit never has to merge anything back. The index is rebuilt when the bound save changes, when the save's
+ * rows serial changes (SetNpcRelationshipStates, sanitize, section copy/decode; this also catches same-size
+ * rewrites), when the array size changes outside AddState, or when a slot no longer holds the tag it was indexed
+ * under. Each rebuild bumps the generation, invalidating outstanding handles.
+ */
+class ALIENRAMEN_API FARNpcStateRegistry
+{
+public:
+	void Reset();
+
+	FARNpcStateHandle FindHandle(UARSaveGame* SaveGame, FGameplayTag NpcTag);
+	FARNpcStateHandle AddState(UARSaveGame* SaveGame, const FARNpcRelationshipState& State);
+	FARNpcRelationshipState* Resolve(UARSaveGame* SaveGame, const FARNpcStateHandle& Handle) const;
+
+	int32 Num() const { return IndexByTag.Num(); }
+	uint32 GetGeneration() const { return Generation; }
+
+private:
+	void SyncWith(UARSaveGame* SaveGame);
+	void Rebuild(UARSaveGame* SaveGame);
+
+	TWeakObjectPtr<UARSaveGame> BoundSaveGame;
+	TMap<FGameplayTag, int32> IndexByTag;
+	int32 IndexedStateCount = 0;
+	uint32 IndexedStatesSerial = 0;
+	uint32 Generation = 0;
+};
+
 UCLASS()
 class ALIENRAMEN_API UARNPCSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
 
 public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|NPC")
@@ -25,6 +70,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|NPC")
 	bool TryGetNpcRelationshipState(FGameplayTag NpcTag, FARNpcRelationshipState& OutState) const;
 
+	// Native, copy-free access. The pointer is into the current save and is valid until the next NPC state change.
+	const FARNpcRelationshipState* FindNpcRelationshipState(FGameplayTag NpcTag) const;
+
+	// Handles stay resolvable across calls until the save is replaced or its NPC array is rewritten.
+	FARNpcStateHandle FindNpcStateHandle(FGameplayTag NpcTag) const;
+	const FARNpcRelationshipState* ResolveNpcStateHandle(const FARNpcStateHandle& Handle) const;
+
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|NPC")
 	bool IsNpcTalkable(FGameplayTag NpcTag) const;
 
@@ -34,10 +86,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|NPC")
 	void RefreshAllNpcTalkableStates();
 
+	// Re-evaluates only NPCs whose dialogue nodes are gated on one of the changed tags.
+	// Progression tag changes from UARSaveSubsystem and unlock changes from AARGameStateBase are routed here automatically.
+	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|NPC")
+	void RefreshNpcTalkableStatesForChangedTags(const FGameplayTagContainer& ChangedProgressionTags, const FGameplayTagContainer& ChangedUnlockTags);
+
 	UPROPERTY(BlueprintAssignable, Category = "Alien Ramen|NPC")
 	FAROnNpcTalkableChanged OnNpcTalkableChanged;
 
 private:
+	UFUNCTION()
+	void HandleProgressionTagChanged(FGameplayTag ProgressionTag, bool bAdded);
+
+	FARNpcRelationshipState* FindOrAddNpcState(UARSaveGame* SaveGame, FGameplayTag NpcTag);
+	UARSaveGame* GetCurrentSaveGame() const;
+
+	mutable FARNpcStateRegistry NpcStates;
+
 	UPROPERTY(Transient)
 	TMap<FGameplayTag, bool> NpcTalkableCache;
 };
@@ -9,6 +9,8 @@
 
 #include "CoreMinimal.h"
 #include "ARPlayerCharacterBase.h"
+#include "AREnemyIncomingDamageEffect.h"
+#include "ARPlayerTypes.h"
 #include "GameplayTagContainer.h"
 #include "GameplayAbilitySpec.h"
 #include "GameplayEffectTypes.h"
@@ -28,8 +30,53 @@ class UARWeaponDefinition;
 class UARAbilitySet;
 class UARPickupCollectorComponent;
 class AARInvaderDropBase;
+class UContentLookupSubsystem;
 struct FTimerHandle;
 struct FOnAttributeChangeData;
+struct FStreamableHandle;
+struct FARLoadoutRowPlan;
+
+/**
+ * Index from ability tag to the ASC's activatable specs that match it, for tag-based activation.
+ *
+ * Every asset tag and grant-time (dynamic source) tag of a spec is indexed as an exact match, and each of its
+ * parents as a parent match, so one map probe per query tag replaces scoring every spec. SyncWith rebuilds when the
+ * ASC changes, when the owner marks it dirty after granting/clearing, or when the ASC's spec handles or levels no
+ * longer match the indexed ones (covers replicated grants on clients). That check compares integers only.
+ */
+class ALIENRAMEN_API FARAbilityTagIndex
+{
+public:
+	static constexpr int32 ExactMatchScore = 100;
+	static constexpr int32 ParentMatchScore = 10;
+
+	void Reset();
+	void MarkDirty() { bDirty = true; }
+	void SyncWith(const UAbilitySystemComponent& ASC);
+
+	// Highest score, then highest level, then lowest spec index, across all query tags.
+	bool PickBest(const FGameplayTagContainer& InTagsToMatch, FGameplayAbilitySpecHandle& OutHandle) const;
+
+	// Every spec matching Tag (exactly or as a parent), in ASC spec order.
+	void CollectMatches(const FGameplayTag& Tag, TArray<FGameplayAbilitySpecHandle>& OutHandles) const;
+
+private:
+	struct FEntry
+	{
+		FGameplayAbilitySpecHandle Handle;
+		int32 Score = 0;
+		int32 Level = 0;
+		int32 SpecIndex = INDEX_NONE;
+	};
+
+	bool IsStale(const UAbilitySystemComponent& ASC) const;
+	void Rebuild(const UAbilitySystemComponent& ASC);
+
+	TWeakObjectPtr<const UAbilitySystemComponent> IndexedASC;
+	TArray<TPair<FGameplayAbilitySpecHandle, int32>> IndexedSpecs;
+	TMap<FGameplayTag, TArray<FEntry>> EntriesByTag;
+	bool bDirty = true;
+};
 
 /**
  * Base ship character for Alien Ramen.
@@ -74,6 +121,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AR|Ship|GAS", meta = (BlueprintAuthorityOnly))
 	bool ApplyDamageToTargetViaGAS(AActor* Target, float DamageOverride = -1.f);
 
+	// One continuous-fire step, batched for simulated proxies: ShotCount shots, the newest NewestShotOffset seconds
+	// old and each older one ShotInterval before it. Projectiles still replicate as their own actors.
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastPrimaryShotsFired(uint8 ShotCount, float NewestShotOffset, float ShotInterval);
+
 	/** Client request path for pickup collection; server validates range and collection state. */
 	UFUNCTION(Server, Reliable)
 	void ServerRequestCollectInvaderDrop(AARInvaderDropBase* Drop);
@@ -101,6 +153,11 @@ public:
 	static void LogAllPropertiesOnStruct(const UScriptStruct* StructType);
 
 protected:
+	// Simulated proxies only: another player's ship fired a continuous-fire step. ShotTimeOffsets (oldest first) are
+	// the seconds since each shot came due, matching UARContinuousFireAbility::GetShotTimeOffset on the server.
+	UFUNCTION(BlueprintImplementableEvent, Category = "AR|Ship|Weapon")
+	void BP_OnRemoteShotsFired(int32 ShotCount, const TArray<float>& ShotTimeOffsets);
+
 	virtual void BeginPlay() override;
 
 	// Server: possession
@@ -132,6 +189,11 @@ protected:
 	// Stats, StartupAbilities, StartupEffects, ShipTags, MovementType, PrimaryWeapon(optional)
 	void ApplyResolvedRowBaseline(const FInstancedStruct& RowStruct);
 
+	// Row fields above, resolved once per row struct (name-prefix matching is done at compile time only). Plans are
+	// dropped on every possession and PlayerState change, so they never outlive a recompiled user-defined struct
+	// for longer than one possession; callers hold the returned ref across Blueprint calls.
+	TSharedRef<const FARLoadoutRowPlan> FindOrCompileLoadoutRowPlan(const UScriptStruct& RowStruct) const;
+
 	// Reads LoadoutTags from PlayerState even if it's only defined in a BP child (reflection).
 	bool GetPlayerLoadoutTags(FGameplayTagContainer& OutLoadoutTags) const;
 
@@ -140,18 +202,35 @@ protected:
 
 	// Resolve a row using ContentLookupSubsystem (returns an InstancedStruct)
 	bool ResolveRowFromTag(FGameplayTag Tag, FInstancedStruct& OutRow, FString& OutError) const;
-	bool TryApplyServerLoadoutFromPlayerState(bool bLogErrors);
-	void RetryServerLoadoutInit();
+
+	// Resolves the loadout rows (ship first, then optional secondary and hat), streams in their soft assets and
+	// applies them. Returns false while the loadout is not ready: OnLoadoutTagsChanged retries missing tags; a missing
+	// PlayerState/ASC or unresolved row is retried on ASC init, content warmup completion and a bounded timer.
+	bool RequestServerLoadoutApply(bool bLogErrors);
+	bool ResolveServerLoadoutRows(const FGameplayTagContainer& LoadoutTags, TArray<FInstancedStruct>& OutRows, bool bLogErrors) const;
+	void ApplyServerLoadoutRows(const FGameplayTagContainer& LoadoutTags, const TArray<FInstancedStruct>& Rows);
+	void BindLoadoutReadiness(AARPlayerStateBase* PlayerStateToWatch);
+	void CancelPendingServerLoadout();
+	void ScheduleServerLoadoutRetry();
+	void StopServerLoadoutRetries();
+	void HandleServerLoadoutRetryTimer();
+
+	UFUNCTION()
+	void HandleContentWarmupCompleted();
+
+	UFUNCTION()
+	void HandleLoadoutTagsChanged(
+		AARPlayerStateBase* SourcePlayerState,
+		EARPlayerSlot SourcePlayerSlot,
+		const FGameplayTagContainer& NewLoadoutTags,
+		const FGameplayTagContainer& OldLoadoutTags);
 
 	// -------------------------
 	// Internal activation helpers
 	// -------------------------
 
-	// Returns true if this spec matches ANY tag in TagContainer (exact match is preferred in scoring).
-	static bool SpecMatchesAnyTag(const FGameplayAbilitySpec& Spec, const FGameplayTagContainer& InTagsToMatch, int32& OutBestScore);
-
-	// Pick one matching ability handle deterministically.
-	static bool PickBestMatchingAbilityHandle(
+	// Pick one matching ability handle deterministically (see FARAbilityTagIndex::PickBest).
+	bool PickBestMatchingAbilityHandle(
 		UAbilitySystemComponent* ASC,
 		const FGameplayTagContainer& InTagsToMatch,
 		FGameplayAbilitySpecHandle& OutHandle
@@ -181,10 +260,25 @@ protected:
 	UPROPERTY(Transient)
 	bool bServerLoadoutApplied = false;
 
-	UPROPERTY(Transient)
-	int32 LoadoutInitRetryCount = 0;
+	// PlayerState whose OnLoadoutTagsChanged re-requests the loadout until it has been applied.
+	TWeakObjectPtr<AARPlayerStateBase> LoadoutReadinessSource;
+
+	// In-flight stream of the resolved rows' soft assets; completions from older requests are ignored.
+	TSharedPtr<FStreamableHandle> LoadoutPreloadHandle;
+	uint32 LoadoutRequestSerial = 0;
+
+	// Compiled row plans for this pawn, keyed by row struct (see FindOrCompileLoadoutRowPlan).
+	mutable TMap<TObjectKey<UScriptStruct>, TSharedRef<const FARLoadoutRowPlan>> LoadoutRowPlans;
 
-	FTimerHandle LoadoutInitRetryTimer;
+	// Set while possessed by a gameplay controller and the loadout has not applied yet.
+	bool bServerLoadoutRequested = false;
+
+	// Fallback retries for failures no loadout-tag change will fix; reset on possess.
+	FTimerHandle LoadoutRetryTimerHandle;
+	int32 LoadoutRetryCount = 0;
+
+	// Content lookup whose OnWarmupCompleted re-requests the loadout.
+	TWeakObjectPtr<UContentLookupSubsystem> LoadoutWarmupSource;
 
 	// Runtime weapon tuning effect (formerly applied from BP _Init).
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AR|Ship|Weapon")
@@ -199,6 +293,11 @@ protected:
 
 	FDelegateHandle MoveSpeedChangedDelegateHandle;
 
+	FARAbilityTagIndex AbilityTagIndex;
+
+	// Server-only; reused across hits from the same offender.
+	FARIncomingDamageSpecCache IncomingDamageSpecs;
+
 	// ---- BP row struct field names (must match your row struct fields) ----
 	static const FName NAME_PrimaryWeapon;
 	static const FName NAME_StartupAbilities;
@@ -528,6 +528,11 @@ protected:
 	void EvaluateLifeStateFromASC();
 	void BroadcastCoreAttributeChanged(EARCoreAttributeType AttributeType, float NewValue, float OldValue);
 	void SetSpiceMeter_Internal(float NewSpiceValue);
+
+	// Server: marks replicated state dirty. At most one ForceNetUpdate is issued per frame, after actor ticks.
+	// High-churn requests are additionally held to HighChurnNetUpdateMinInterval unless a normal request joins them.
+	void RequestNetUpdate(bool bHighChurn = false);
+	void FlushPendingNetUpdate(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds);
 	bool EnsureReadyPrerequisitesForRun();
 	void EvaluateTravelReadinessAndBroadcast();
 
@@ -589,6 +594,15 @@ protected:
 	UPROPERTY(Transient)
 	bool bCachedTravelReady = false;
 
+	// Minimum real-time seconds between forced net updates requested only by high-churn fields (spice meter, combo).
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Alien Ramen|Replication", meta = (ClampMin = "0.0"))
+	float HighChurnNetUpdateMinInterval = 0.1f;
+
+	bool bNetUpdatePending = false;
+	bool bPendingNetUpdateHighChurnOnly = false;
+	double LastForcedNetUpdateRealTime = -1.0;
+	FDelegateHandle PostActorTickDelegateHandle;
+
 	FDelegateHandle HealthChangedDelegateHandle;
 	FDelegateHandle MaxHealthChangedDelegateHandle;
 	FDelegateHandle SpiceChangedDelegateHandle;
@@ -11,6 +11,19 @@
 #include "ARSaveTypes.h"
 #include "ARSaveGame.generated.h"
 
+/**
+ * Lazily-deserialized save sections. Header + core progression stay in the tagged property block so slot
+ * browsing and lobby hydration never pay for them; each section below is stored as an opaque blob after it.
+ */
+enum class EARSaveSection : uint8
+{
+	Players = 0,
+	Dialogue,
+	DialogueHistory,
+	Factions,
+	Count
+};
+
 /** Canonical save payload persisted to disk; schema is versioned manually via CurrentSchemaVersion. */
 UCLASS(BlueprintType)
 class ALIENRAMEN_API UARSaveGame : public USaveGame
@@ -18,11 +31,17 @@ class ALIENRAMEN_API UARSaveGame : public USaveGame
 	GENERATED_BODY()
 
 public:
-	static constexpr int32 CurrentSchemaVersion = 6;
+	static constexpr int32 CurrentSchemaVersion = 8;
 	static constexpr int32 MinSupportedSchemaVersion = 6;
+	// v6 stored every field inline in the tagged block; loads migrate on the next write.
+	static constexpr int32 LegacyInlineSchemaVersion = 6;
+	// v8 replaced per-player SeenNodeTags containers with bitsets over DialogueNodeTags. Compaction keys off rows that
+	// still carry SeenNodeTags rather than SaveGameVersion, which v7 saves may have omitted as a default-equal value.
 
 	UARSaveGame();
 
+	virtual void Serialize(FArchive& Ar) override;
+
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save|Meta")
 	static int32 GetCurrentSchemaVersion() { return CurrentSchemaVersion; }
 
@@ -65,10 +84,6 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|Progression")
 	FGameplayTagContainer ActiveFactionEffectTags;
 
-	// Persistent background popularity state for faction ranking/drift.
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|Progression")
-	TArray<FARFactionRuntimeState> FactionPopularityStates;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|Meta")
 	FName SaveSlot = NAME_None;
 
@@ -81,26 +96,127 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|Meta")
 	FDateTime LastSaved;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save")
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
+	bool FindPlayerStateDataBySlot(EARPlayerSlot Slot, FARPlayerStateSaveData& OutData, int32& OutIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
+	bool FindPlayerStateDataByIdentity(const FARPlayerIdentity& Identity, FARPlayerStateSaveData& OutData, int32& OutIndex) const;
+
+	// Section accessors. Each deserializes its section on first access after load; they also back the Blueprint
+	// getters/setters of the private section arrays below.
+	UFUNCTION(BlueprintGetter, Category = "Alien Ramen|Save")
+	const TArray<FARPlayerStateSaveData>& GetPlayerStates() const;
+
+	UFUNCTION(BlueprintSetter, Category = "Alien Ramen|Save")
+	void SetPlayerStates(const TArray<FARPlayerStateSaveData>& InPlayerStates);
+
+	UFUNCTION(BlueprintGetter, Category = "Alien Ramen|Save|NPC")
+	const TArray<FARNpcRelationshipState>& GetNpcRelationshipStates() const;
+
+	UFUNCTION(BlueprintSetter, Category = "Alien Ramen|Save|NPC")
+	void SetNpcRelationshipStates(const TArray<FARNpcRelationshipState>& InStates);
+
+	UFUNCTION(BlueprintGetter, Category = "Alien Ramen|Save|Dialogue")
+	const TArray<FARDialogueCanonicalChoiceState>& GetDialogueCanonicalChoiceStates() const;
+
+	UFUNCTION(BlueprintSetter, Category = "Alien Ramen|Save|Dialogue")
+	void SetDialogueCanonicalChoiceStates(const TArray<FARDialogueCanonicalChoiceState>& InStates);
+
+	UFUNCTION(BlueprintGetter, Category = "Alien Ramen|Save|Dialogue")
+	const TArray<FARPlayerDialogueHistoryState>& GetPlayerDialogueHistoryStates() const;
+
+	UFUNCTION(BlueprintSetter, Category = "Alien Ramen|Save|Dialogue")
+	void SetPlayerDialogueHistoryStates(const TArray<FARPlayerDialogueHistoryState>& InStates);
+
+	UFUNCTION(BlueprintGetter, Category = "Alien Ramen|Save|Progression")
+	const TArray<FARFactionRuntimeState>& GetFactionPopularityStates() const;
+
+	UFUNCTION(BlueprintSetter, Category = "Alien Ramen|Save|Progression")
+	void SetFactionPopularityStates(const TArray<FARFactionRuntimeState>& InStates);
+
+	TArray<FARPlayerStateSaveData>& GetMutablePlayerStates();
+	// In-place edits and appends only; replacing or reordering rows must go through SetNpcRelationshipStates so the
+	// rows serial below changes.
+	TArray<FARNpcRelationshipState>& GetMutableNpcRelationshipStates();
+
+	// Changes whenever NpcRelationshipStates is replaced or has rows removed (set, copy, decode, sanitize), so
+	// index caches over it (FARNpcStateRegistry) can detect rewrites that keep the size.
+	uint32 GetNpcRelationshipStatesSerial() const { return NpcRelationshipStatesSerial; }
+	TArray<FARDialogueCanonicalChoiceState>& GetMutableDialogueCanonicalChoiceStates();
+	TArray<FARPlayerDialogueHistoryState>& GetMutablePlayerDialogueHistoryStates();
+	TArray<FARFactionRuntimeState>& GetMutableFactionPopularityStates();
+
+	// Stable seen-history bit index for a dialogue node, or INDEX_NONE if no player has seen it in this save.
+	int32 FindDialogueNodeIndex(FGameplayTag NodeTag) const;
+	int32 FindOrAddDialogueNodeIndex(FGameplayTag NodeTag);
+
+	// Folds legacy SeenNodeTags into SeenNodeBits. Runs on section hydrate and before the section is written.
+	// Returns the number of tags migrated.
+	int32 CompactDialogueHistory();
+
+	bool IsSectionHydrated(EARSaveSection Section) const;
+
+	// Deserializes every pending section (editor tooling/details views that read fields by reflection).
+	void HydrateAllSections();
+
+	/**
+	 * Copies the given sections from Source without deserializing ones Source has not touched:
+	 * untouched sections move across as their stored bytes.
+	 */
+	void CopySectionsFrom(const UARSaveGame& Source, TConstArrayView<EARSaveSection> Sections);
+
+	int32 ValidateAndSanitize(TArray<FString>* OutWarnings);
+
+private:
+#if WITH_DEV_AUTOMATION_TESTS
+	// Lets the save-format tests compare stored section bytes across copies.
+	friend struct FARSaveGameSectionTestAccess;
+#endif
+
+	void EnsureSectionHydrated(EARSaveSection Section) const;
+	void HydrateSection(EARSaveSection Section);
+	void MarkSectionHydrated(EARSaveSection Section);
+	void EncodeSection(EARSaveSection Section, TArray<uint8>& OutBytes) const;
+	void SerializeSectionProperties(FArchive& Ar, EARSaveSection Section);
+	void SerializeSectioned(FArchive& Ar);
+	int32 SanitizePlayersSection(TArray<FString>* OutWarnings);
+	int32 SanitizeDialogueSection(TArray<FString>* OutWarnings);
+
+	// Players section.
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetPlayerStates, BlueprintSetter = SetPlayerStates, Category = "Save", meta = (AllowPrivateAccess = "true"))
 	TArray<FARPlayerStateSaveData> PlayerStates;
 
-	// Global per-NPC relationship state and wants.
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|NPC")
+	// Dialogue section: global per-NPC relationship state and wants.
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetNpcRelationshipStates, BlueprintSetter = SetNpcRelationshipStates, Category = "Save|NPC", meta = (AllowPrivateAccess = "true"))
 	TArray<FARNpcRelationshipState> NpcRelationshipStates;
 
-	// Canonical branch outcomes for choice nodes.
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|Dialogue")
+	// Dialogue section: canonical branch outcomes for choice nodes.
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetDialogueCanonicalChoiceStates, BlueprintSetter = SetDialogueCanonicalChoiceStates, Category = "Save|Dialogue", meta = (AllowPrivateAccess = "true"))
 	TArray<FARDialogueCanonicalChoiceState> DialogueCanonicalChoiceStates;
 
-	// Per-player node seen history.
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|Dialogue")
+	// DialogueHistory section: per-player node seen history as bitsets over DialogueNodeTags.
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetPlayerDialogueHistoryStates, BlueprintSetter = SetPlayerDialogueHistoryStates, Category = "Save|Dialogue", meta = (AllowPrivateAccess = "true"))
 	TArray<FARPlayerDialogueHistoryState> PlayerDialogueHistoryStates;
 
-	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
-	bool FindPlayerStateDataBySlot(EARPlayerSlot Slot, FARPlayerStateSaveData& OutData, int32& OutIndex) const;
+	// DialogueHistory section: append-only node table. A node's position is its bit in every history row, so
+	// entries are never removed or reordered (a tag deleted from config keeps its slot).
+	UPROPERTY(EditAnywhere, Category = "Save|Dialogue")
+	TArray<FGameplayTag> DialogueNodeTags;
 
-	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
-	bool FindPlayerStateDataByIdentity(const FARPlayerIdentity& Identity, FARPlayerStateSaveData& OutData, int32& OutIndex) const;
+	// Factions section: persistent background popularity state for faction ranking/drift.
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetFactionPopularityStates, BlueprintSetter = SetFactionPopularityStates, Category = "Save|Progression", meta = (AllowPrivateAccess = "true"))
+	TArray<FARFactionRuntimeState> FactionPopularityStates;
 
-	int32 ValidateAndSanitize(TArray<FString>* OutWarnings);
+	// Stored bytes for sections not yet deserialized since load. Empty once hydrated.
+	TArray<uint8> PendingSectionBytes[static_cast<int32>(EARSaveSection::Count)];
+
+	// Bit per EARSaveSection; set when the UPROPERTY arrays are authoritative.
+	uint8 HydratedSectionMask = 0;
+
+	uint32 NpcRelationshipStatesSerial = 0;
+
+	// Transient reverse lookup over DialogueNodeTags; rebuilt when the table changes size underneath it.
+	void EnsureDialogueNodeLookup() const;
+	mutable TMap<FGameplayTag, int32> DialogueNodeIndexByTag;
+	mutable int32 IndexedDialogueNodeCount = 0;
 };
@@ -8,6 +8,8 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "ARSaveTypes.h"
 #include "StructUtils/InstancedStruct.h"
+#include "Containers/Ticker.h"
+#include "Engine/TimerHandle.h"
 #include "ARSaveSubsystem.generated.h"
 
 class UARSaveGame;
@@ -20,8 +22,29 @@ class UWorld;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAROnSaveOperationCompleted, const FARSaveResult&, Result);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAROnSaveOperationFailed, const FARSaveResult&, Result);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAROnGameLoaded);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAROnProgressionTagChanged, FGameplayTag, ProgressionTag, bool, bAdded);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAROnSaveOperationStarted);
 
+/** In-memory PlayerState handoff captured before travel and consumed when the player is re-hydrated on the new map. */
+USTRUCT()
+struct FARTravelPlayerSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	FARPlayerIdentity Identity;
+
+	UPROPERTY(Transient)
+	EARCharacterChoice CharacterPicked = EARCharacterChoice::None;
+
+	UPROPERTY(Transient)
+	FGameplayTagContainer LoadoutTags;
+
+	// Typed IStructSerializable state (ClassStateStruct of the source PlayerState).
+	UPROPERTY(Transient)
+	FInstancedStruct State;
+};
+
 /** GameInstance subsystem that owns save/load/list/delete plus travel-save orchestration. */
 UCLASS()
 class ALIENRAMEN_API UARSaveSubsystem : public UGameInstanceSubsystem
@@ -79,9 +102,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
 	bool FormatTimeSinceLastSave(FText& OutText) const;
 
-	// Whether a save is currently running (authority only, sync path).
+	// Whether a save is currently running (authority only), including a background disk write still in flight.
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
-	bool IsSaveInProgress() const { return bSaveInProgress; }
+	bool IsSaveInProgress() const { return bSaveInProgress || bAsyncWriteInFlight; }
+
+	// Whether a post-travel save is queued and waiting for the destination map to finish hydrating.
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
+	bool HasDeferredTravelSave() const { return bDeferredTravelSavePending; }
 
 	// Marks save dirty; autosave can later persist.
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Save")
@@ -105,6 +132,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Faction")
 	void SetFactionClout(int32 NewFactionClout);
 
+	/**
+	 * Reports a low-load flow boundary (director flow change, stage selection, shop entry, pause). When the save is dirty,
+	 * a background-write autosave is queued for the next engine tick; returns true when one was queued.
+	 * Dirty state that never reaches a boundary is flushed once MaxAutosaveStalenessSeconds elapses.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Save", meta = (BlueprintAuthorityOnly))
+	bool NotifyAutosaveBoundary(EARAutosaveBoundary Boundary);
+
 	// Attempts an autosave only if dirty; returns true if a save was executed.
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Save", meta = (BlueprintAuthorityOnly))
 	bool RequestAutosaveIfDirty(bool bCreateNewRevision, FARSaveResult& OutResult);
@@ -119,7 +154,9 @@ public:
 	/**
 	 * Authority-only travel helper used by UI/Blueprints.
 	 *
-	 * Flow: optional readiness gate -> capture GameState travel snapshot -> optional disk save -> ServerTravel with enforced listen option.
+	 * Flow: optional readiness gate -> capture typed GameState/PlayerState travel snapshots in memory -> ServerTravel with
+	 * enforced listen option. When bPersistSaveBeforeTravel is set, the disk save is deferred until the destination map has
+	 * hydrated from the snapshots and is then written in the background.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Travel", meta = (BlueprintAuthorityOnly))
 	bool RequestServerTravel(
@@ -151,8 +188,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
 	bool HasPendingTravelGameStateData() const { return PendingTravelGameStateData.IsValid(); }
 
-	// Applies player-specific save payload onto Requester if identity (or optional slot fallback) is found in CurrentSaveGame.
-	// Returns true when a matching player row was found and applied.
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Save")
+	bool HasPendingTravelPlayerSnapshots() const { return PendingTravelPlayerSnapshots.Num() > 0; }
+
+	// Applies player-specific payload onto Requester: a matching in-memory travel snapshot wins, otherwise the identity
+	// (or optional slot fallback) row in CurrentSaveGame. Returns true when a matching snapshot or row was applied.
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Save")
 	bool TryHydratePlayerStateFromCurrentSave(AARPlayerStateBase* Requester, bool bAllowSlotFallback = true);
 
@@ -182,13 +222,38 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Alien Ramen|Save")
 	FAROnGameLoaded OnGameLoaded;
 
+	// Fired by AddProgressionTag/RemoveProgressionTag when the tag set actually changes (not on load; see OnGameLoaded).
+	UPROPERTY(BlueprintAssignable, Category = "Alien Ramen|Progression")
+	FAROnProgressionTagChanged OnProgressionTagChanged;
+
 protected:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
 private:
+#if WITH_DEV_AUTOMATION_TESTS
+	// Lets the save benchmark drive the real list/rollback/sync paths against its own index slot.
+	friend struct FARSaveBenchmarkAccess;
+	// Lets the faction benchmark install a synthetic current save without touching slot storage.
+	friend struct FARFactionBenchmarkAccess;
+#endif
+
 	bool ArePlayersReadyForTravel(bool bSkipReadyChecks, FString& OutError) const;
 	bool CaptureGameStateForTravel(UWorld* World);
+	int32 CapturePlayerStatesForTravel(UWorld* World);
+	bool TryApplyTravelPlayerSnapshot(AARPlayerStateBase* Requester, bool bAllowSlotFallback);
+	void QueueDeferredTravelSave();
+	void ScheduleDeferredTravelSaveFlush(float DelaySeconds);
+	void FlushDeferredTravelSave();
+	void HandlePostLoadMapWithWorld(UWorld* LoadedWorld);
+	float GetSaveThrottleRemainingSeconds() const;
+	void ArmAutosaveStalenessTimer(float DelaySeconds);
+	void ArmAutosaveStalenessRetry(EARAutosaveBoundary Boundary, float RetrySeconds);
+	void HandleAutosaveStalenessExpired();
+	void FlushScheduledAutosave();
+	bool TryRunScheduledAutosave(EARAutosaveBoundary Boundary);
+	bool SaveCurrentGameInternal(FName SlotBaseName, bool bCreateNewRevision, FARSaveResult& OutResult, bool bUseDebugSaves, bool bBackgroundWrite);
+	bool FinalizeSaveWrite(UARSaveGame* SaveObject, UARSaveIndexGame* IndexObj, FName SlotBase, int32 SlotNumber, const TCHAR* IndexSlotName, const TArray<uint8>& SaveBytes, FARSaveResult& OutResult);
 	static FString EnsureListenOption(const FString& InURLOrOptions);
 
 	static FName NormalizeSlotBaseName(FName SlotBaseName);
@@ -201,6 +266,8 @@ private:
 	bool SaveIndex(UARSaveIndexGame* IndexObj, FARSaveResult& OutResult) const;
 	bool SaveSaveObject(UARSaveGame* SaveObject, FName SlotBaseName, int32 SlotNumber, FARSaveResult& OutResult) const;
 	UARSaveGame* LoadSaveObjectWithRollback(FName SlotBaseName, int32 RevisionOrLatest, int32& OutResolvedSlotNumber, FARSaveResult& OutResult, const TCHAR* IndexSlotName) const;
+	bool ListSavesInIndex(const TCHAR* IndexSlotName, TArray<FARSaveSlotDescriptor>& OutSlots, FARSaveResult& OutResult) const;
+	bool PersistCanonicalSaveToIndex(const TArray<uint8>& SaveBytes, FName SlotBaseName, int32 SlotNumber, const TCHAR* IndexSlotName, FARSaveResult& OutResult);
 	void PruneOldRevisions(FName SlotBaseName, int32 LatestRevision) const;
 	void GatherRuntimeData(UARSaveGame* SaveObject);
 	void BroadcastSaveFailure(const FARSaveResult& Result);
@@ -224,9 +291,34 @@ private:
 	UPROPERTY(Transient)
 	FInstancedStruct PendingTravelGameStateData;
 
+	UPROPERTY(Transient)
+	TArray<FARTravelPlayerSnapshot> PendingTravelPlayerSnapshots;
+
 	UPROPERTY(Transient)
 	bool bSaveInProgress = false;
 
+	// Set while a background slot write is running; index/prune/broadcast happen on its completion.
+	UPROPERTY(Transient)
+	bool bAsyncWriteInFlight = false;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UARSaveGame> InFlightSaveGame;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UARSaveIndexGame> InFlightSaveIndex;
+
+	UPROPERTY(Transient)
+	bool bDeferredTravelSavePending = false;
+
+	FTimerHandle DeferredTravelSaveTimerHandle;
+	FDelegateHandle PostLoadMapHandle;
+
+	UPROPERTY(Transient)
+	EARAutosaveBoundary PendingAutosaveBoundary = EARAutosaveBoundary::None;
+
+	FTSTicker::FDelegateHandle ScheduledAutosaveTickerHandle;
+	FTimerHandle AutosaveStalenessTimerHandle;
+
 	UPROPERTY(Transient)
 	bool bSaveDirty = false;
 
@@ -237,6 +329,19 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Alien Ramen|Save", meta = (AllowPrivateAccess = "true"))
 	float MinSaveIntervalSeconds = 1.0f;
 
+	// Fallback delay (seconds) after the destination map loads before a deferred travel save is flushed, used when
+	// no GameState hydration arrives to trigger it sooner.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Alien Ramen|Save", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float DeferredTravelSaveFallbackSeconds = 2.0f;
+
+	// When true, dirty state is autosaved only at reported flow boundaries (plus the staleness bound below).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Alien Ramen|Save", meta = (AllowPrivateAccess = "true"))
+	bool bAutosaveAtSafeBoundaries = true;
+
+	// Upper bound (seconds) a dirty save may wait for a boundary before it is flushed anyway. 0 disables the bound.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Alien Ramen|Save", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float MaxAutosaveStalenessSeconds = 300.0f;
+
 	// When true, successful saves emit an Info log with slot/revision/time (useful for audit during debug).
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Alien Ramen|Save", meta = (AllowPrivateAccess = "true"))
 	bool bLogSaveSuccess = false;
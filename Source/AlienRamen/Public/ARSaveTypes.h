@@ -22,6 +22,18 @@ enum class EARSaveResultCode : uint8
 	Unknown
 };
 
+// Low-load moments at which queued dirty state may be autosaved (see UARSaveSubsystem::NotifyAutosaveBoundary).
+UENUM(BlueprintType)
+enum class EARAutosaveBoundary : uint8
+{
+	None = 0,
+	InvaderFlowTransition,
+	StageSelected,
+	ShopEntry,
+	Pause,
+	MaxStaleness
+};
+
 USTRUCT(BlueprintType)
 struct ALIENRAMEN_API FARMeatTypeAmount
 {
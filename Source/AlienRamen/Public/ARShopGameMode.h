@@ -17,5 +17,6 @@ public:
 	AARShopGameMode();
 
 protected:
+	virtual void BeginPlay() override;
 	virtual bool PreStartTravel(const FString& URL, const FString& Options, bool bSkipReadyChecks) override;
 };
@@ -9,16 +9,47 @@
 #include "Components/StateTreeAIComponent.h"
 #include "ARStateTreeAIComponent.generated.h"
 
+class UStateTree;
 class UStateTreeSchema;
+struct FStateTreeReadOnlyExecutionContext;
 
 DECLARE_MULTICAST_DELEGATE_TwoParams(
 	FAROnActiveStateTagsChangedNative,
 	const FGameplayTagContainer& /*AddedTags*/,
 	const FGameplayTagContainer& /*RemovedTags*/);
 
+/**
+ * Resolves the gameplay tags of a running tree's active states (root tree and linked subtrees).
+ * State tags are indexed by state handle once per tree asset, so reading the active set does no per-state lookups.
+ */
+class ALIENRAMEN_API FARStateTreeStateTagReader
+{
+public:
+	// Drops the per-asset tables; tree assets can be recompiled between runs (editor).
+	void Reset() { StateTagTables.Reset(); }
+
+	// Returns false, leaving OutTags untouched, when the context cannot be read this frame.
+	bool CollectActiveStateTags(const FStateTreeReadOnlyExecutionContext& Context, const UStateTree& RootStateTree, FGameplayTagContainer& OutTags);
+
+	static void ComputeTagDelta(
+		const FGameplayTagContainer& OldTags,
+		const FGameplayTagContainer& NewTags,
+		FGameplayTagContainer& OutAddedTags,
+		FGameplayTagContainer& OutRemovedTags);
+
+private:
+	const TArray<FGameplayTag>& GetStateTagTable(const UStateTree& StateTree);
+
+	TMap<TObjectKey<UStateTree>, TArray<FGameplayTag>> StateTagTables;
+};
+
 /**
  * Enemy-focused StateTree AI component that tracks active state tags at runtime
  * and emits add/remove deltas whenever the active state-tag set changes.
+ *
+ * Active states are re-read only when the tree reports a state change (execution state StateChangeCount) or
+ * logic starts/stops, so an idle tree costs one counter compare per tick. Deltas from ticks are published once
+ * per frame, after the tree has ticked.
  */
 UCLASS(ClassGroup = AI, Blueprintable, meta = (BlueprintSpawnableComponent))
 class ALIENRAMEN_API UARStateTreeAIComponent : public UStateTreeAIComponent
@@ -40,9 +71,17 @@ public:
 
 private:
 	void RefreshActiveStateTags();
+	void FlushActiveStateTags();
 	void EmitTagDelta(const FGameplayTagContainer& NewTags);
 
 private:
+	// Tags as last published to OnActiveStateTagsChanged listeners.
 	UPROPERTY(Transient)
 	FGameplayTagContainer CurrentActiveStateTags;
+
+	FGameplayTagContainer PendingActiveStateTags;
+	FARStateTreeStateTagReader StateTagReader;
+	uint16 ObservedStateChangeCount = 0;
+	bool bActiveStateTagsDirty = true;
+	bool bHasPendingActiveStateTags = false;
 };
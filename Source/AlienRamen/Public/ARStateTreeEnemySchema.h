@@ -0,0 +1,32 @@
+/**
+ * @file ARStateTreeEnemySchema.h
+ * @brief ARStateTreeEnemySchema header for Alien Ramen.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/StateTreeComponentSchema.h"
+
+#include "ARStateTreeEnemySchema.generated.h"
+
+/**
+ * Controller-less StateTree schema for enemies run by UAREnemyStateTreeExecutorSubsystem.
+ * Context: ContextActorClass = AAREnemyBase only. Tasks that need an AI controller must use the AI schema instead.
+ */
+UCLASS(BlueprintType, EditInlineNew, CollapseCategories, meta = (DisplayName = "AR StateTree Enemy Schema (Shared Executor)", CommonSchema))
+class ALIENRAMEN_API UARStateTreeEnemySchema : public UStateTreeComponentSchema
+{
+	GENERATED_BODY()
+
+public:
+	UARStateTreeEnemySchema(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void SyncContextDescriptorTypes();
+};
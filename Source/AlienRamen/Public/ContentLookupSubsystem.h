@@ -10,9 +10,14 @@
 #include "Engine/DataAsset.h"
 #include "StructUtils/InstancedStruct.h"
 #include "UObject/SoftObjectPtr.h"
+#include "ARContentPack.h"
 #include "ContentLookupSubsystem.generated.h"
 
 class UDataTable;
+class UContentLookupSubsystem;
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FContentLookupWarmupCompleted);
 
 USTRUCT(BlueprintType)
 struct FContentLookupRoute
@@ -39,11 +44,86 @@ public:
 	TArray<FContentLookupRoute> Routes;
 };
 
+// Native index entry: one fully-qualified content tag pre-resolved to its route, row name and row memory.
+struct FContentLookupTagIndexEntry
+{
+	int32 RouteIndex = INDEX_NONE;
+	FName RowName;
+
+	// Points into the bound table's RowMap (or a materialized pack row); null until bound or when the row is missing.
+	const uint8* RowData = nullptr;
+
+	// Row in the baked content pack when the route is pack-served; materialized on first lookup.
+	int32 PackRowIndex = INDEX_NONE;
+};
+
+// Native index route: registry route plus the row source (table or content pack) bound to its index entries.
+struct FContentLookupIndexedRoute
+{
+	FGameplayTag RootTag;
+	TSoftObjectPtr<UDataTable> DataTable;
+	TWeakObjectPtr<UDataTable> BoundTable;
+	TArray<FGameplayTag> Tags;
+
+	// Owner of the bound row memory: the DataTable, or the subsystem for pack-served routes.
+	TWeakObjectPtr<const UObject> RowOwner;
+	const UScriptStruct* RowStruct = nullptr;
+	int32 PackRouteIndex = INDEX_NONE;
+	bool bBound = false;
+#if WITH_EDITOR
+	FDelegateHandle TableChangedHandle;
+#endif
+};
+
+// A content pack row deserialized on demand; owned by UContentLookupSubsystem.
+struct FContentLookupPackedRow
+{
+	const UScriptStruct* RowStruct = nullptr;
+	uint8* Memory = nullptr;
+};
+
+/**
+ * Non-owning const view of a resident routed row.
+ * The row memory belongs to its owner (the cached DataTable, or UContentLookupSubsystem for content pack rows).
+ * The view captures the subsystem's content serial and reports invalid once the owner dies or routed row memory
+ * may have been released (ClearCache/SetRegistry, index rebuild, editor reimport). Copy the row if it must persist.
+ */
+template <typename TRow>
+struct TContentLookupRowView
+{
+	TContentLookupRowView() = default;
+	TContentLookupRowView(const UContentLookupSubsystem* InLookup, uint32 InContentSerial, const UObject* InOwner, const TRow* InRow)
+		: Lookup(InLookup)
+		, Owner(InOwner)
+		, Row(InRow)
+		, ContentSerial(InContentSerial)
+	{
+	}
+
+	bool IsValid() const;
+	explicit operator bool() const { return IsValid(); }
+
+	const TRow* Get() const { return IsValid() ? Row : nullptr; }
+	const TRow& operator*() const { check(IsValid()); return *Row; }
+	const TRow* operator->() const { check(IsValid()); return Row; }
+	const UObject* GetOwner() const { return Owner.Get(); }
+
+private:
+	TWeakObjectPtr<const UContentLookupSubsystem> Lookup;
+	TWeakObjectPtr<const UObject> Owner;
+	const TRow* Row = nullptr;
+	uint32 ContentSerial = 0;
+};
+
 /**
  * ContentLookupSubsystem
  *
  * - Routes a GameplayTag to a DataTable based on RootTag prefix matching.
  * - Uses the tag leaf (last segment after '.') as the DataTable RowName by default.
+ * - Routed tables (and configured row soft references) are streamed asynchronously at startup; see StartWarmup.
+ * - In packaged builds, routes baked into the content pack (ARContentPack.h) are served from it without loading their tables.
+ * - Every registered tag under a route root is indexed up front (on init and registry change), so a
+ *   lookup is a single hash probe; row pointers are bound the first time a route's table is needed.
  *
  * Example:
  *   Unlocks.Ships.Sammy
@@ -60,6 +140,8 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	// ---- Registry Source ----
 	// Runtime override (optional). If set, this takes priority over project settings RegistryAsset.
 	UPROPERTY(Transient, BlueprintReadOnly, Category = "Alien Ramen|Content Lookup")
@@ -75,10 +157,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Content Lookup")
 	void SetRegistry(UContentLookupRegistry* InRegistry);
 
-	// Clears cached loaded tables (useful during PIE iteration).
+	// Clears cached loaded tables and rebuilds the tag index (useful during PIE iteration).
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Content Lookup")
 	void ClearCache();
 
+	// Streams every routed DataTable asynchronously, then the row soft references of the routes listed in
+	// UARContentLookupSettings::WarmupSoftReferenceRootTags. Restarts any warmup already in flight.
+	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Content Lookup")
+	void StartWarmup();
+
+	// True once the current warmup has finished (tables that failed to stream are logged and skipped).
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Content Lookup")
+	bool IsWarmupComplete() const { return bWarmupComplete; }
+
+	// Number of routed tables that had to be loaded synchronously this session.
+	UFUNCTION(BlueprintPure, Category = "Alien Ramen|Content Lookup")
+	int32 GetSyncTableLoadCount() const { return SyncTableLoadCount; }
+
+	// Fired when warmup completes (e.g. to release a loading screen).
+	UPROPERTY(BlueprintAssignable, Category = "Alien Ramen|Content Lookup")
+	FContentLookupWarmupCompleted OnWarmupCompleted;
+
+	// Changes whenever routed row memory may have changed (index rebuild, registry swap, editor table edit).
+	// Native caches derived from rows compare against it instead of subscribing to each table.
+	uint32 GetContentSerial();
+
+	// Current serial without building the tag index (for row views checking staleness).
+	uint32 PeekContentSerial() const { return ContentSerial; }
+
 	// Convenience: checks existence without returning the row struct.
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Content Lookup")
 	bool DoesRowExistForTag(FGameplayTag Tag, FString& OutError);
@@ -97,6 +203,38 @@ public:
 		FString& OutError
 	);
 
+	// Native zero-copy lookup: returns the resident row memory, its row struct and the object owning that memory
+	// (the DataTable, or this subsystem for content pack rows). Allocates nothing on success once the row is resident;
+	// OutError is only written on failure.
+	const uint8* FindRowDataByTag(
+		FGameplayTag Tag,
+		const UScriptStruct*& OutRowStruct,
+		const UObject*& OutRowOwner,
+		FString& OutError
+	);
+
+	// Typed form of FindRowDataByTag. Fails (invalid view) when the routed table's RowStruct is not TRow or a child of it.
+	template <typename TRow>
+	TContentLookupRowView<TRow> FindRowViewByTag(FGameplayTag Tag, FString& OutError)
+	{
+		const UScriptStruct* RowStruct = nullptr;
+		const UObject* RowOwner = nullptr;
+		const uint8* RowData = FindRowDataByTag(Tag, RowStruct, RowOwner, OutError);
+		if (!RowData)
+		{
+			return TContentLookupRowView<TRow>();
+		}
+
+		if (!RowStruct->IsChildOf(TRow::StaticStruct()))
+		{
+			OutError = FString::Printf(TEXT("Row struct '%s' for tag '%s' is not '%s'."),
+				*GetNameSafe(RowStruct), *Tag.ToString(), *GetNameSafe(TRow::StaticStruct()));
+			return TContentLookupRowView<TRow>();
+		}
+
+		return TContentLookupRowView<TRow>(this, ContentSerial, RowOwner, reinterpret_cast<const TRow*>(RowData));
+	}
+
 	// Returns all row names for the DataTable routed by RootTag.
 	// Useful for systems that need to rank/select across an entire content family.
 	UFUNCTION(BlueprintCallable, Category = "Alien Ramen|Content Lookup")
@@ -140,9 +278,73 @@ private:
 	// Internal: choose active registry (runtime override first, else loaded asset).
 	UContentLookupRegistry* GetActiveRegistry();
 
-	// Internal: resolve table by prefix match.
+	// Internal: resolve table by the most specific matching route root (walks the tag's parents).
 	UDataTable* ResolveTableForTag(FGameplayTag Tag, FGameplayTag& OutMatchedRoot, FString& OutError);
 
 	// Internal: load a DT (sync) and cache it.
 	UDataTable* LoadAndCacheTable(const FGameplayTag& RootTag, const TSoftObjectPtr<UDataTable>& TableRef, FString& OutError);
+
+	// ---- Warmup ----
+	void CancelWarmup();
+	void HandleWarmupTablesLoaded(uint32 Serial);
+	void HandleWarmupSoftReferencesLoaded(uint32 Serial);
+	void FinishWarmup();
+
+	TSharedPtr<FStreamableHandle> WarmupTablesHandle;
+	// Kept for the subsystem's lifetime so warmed soft references stay resident.
+	TSharedPtr<FStreamableHandle> WarmupSoftReferencesHandle;
+	uint32 WarmupSerial = 0;
+	bool bWarmupStarted = false;
+	bool bWarmupComplete = false;
+	int32 SyncTableLoadCount = 0;
+
+	// ---- Tag index ----
+	// Rebuilds tag -> route entries from the active registry. Row pointers are bound lazily per route.
+	void RebuildTagIndex();
+	void ResetTagIndex();
+	void EnsureTagIndex();
+
+	// Binds the route's row source: pack routes resolve their pack rows, table routes load the table and
+	// point every index entry at its RowMap memory.
+	bool BindIndexedRoute(int32 RouteIndex);
+	void UnbindIndexedRoute(int32 RouteIndex);
+
+	// Single-probe fast path. Returns false on a miss; callers fall back to ResolveTableForTag.
+	// OutRowData is null when the route resolved but the row does not exist.
+	bool FindIndexedRow(
+		FGameplayTag Tag,
+		FName& OutRowName,
+		const uint8*& OutRowData,
+		const UScriptStruct*& OutRowStruct,
+		const UObject*& OutRowOwner);
+
+	// ---- Content pack ----
+	void LoadContentPack();
+	const uint8* MaterializePackRow(int32 PackRowIndex, const UScriptStruct* RowStruct);
+	void ReleasePackRows();
+
+	TUniquePtr<FARContentPack> ContentPack;
+	TMap<int32, FContentLookupPackedRow> MaterializedPackRows;
+
+	// Keeps row structs of pack-served routes alive (user-defined structs are otherwise only held by their tables).
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UScriptStruct>> PackRowStructs;
+
+#if WITH_EDITOR
+	void HandleIndexedTableChanged(int32 RouteIndex);
+#endif
+
+	TMap<FGameplayTag, FContentLookupTagIndexEntry> TagIndex;
+	TMap<FGameplayTag, int32> RouteIndexByRoot;
+	TArray<FContentLookupIndexedRoute> IndexedRoutes;
+	TWeakObjectPtr<UContentLookupRegistry> IndexedRegistry;
+	bool bTagIndexBuilt = false;
+	uint32 ContentSerial = 0;
 };
+
+template <typename TRow>
+bool TContentLookupRowView<TRow>::IsValid() const
+{
+	const UContentLookupSubsystem* LookupPtr = Lookup.Get();
+	return Row != nullptr && Owner.IsValid() && LookupPtr && LookupPtr->PeekContentSerial() == ContentSerial;
+}
@@ -18,6 +18,8 @@ public:
 	// -----------------------
 	// Tag path helpers
 	// -----------------------
+	// Resolved from the gameplay tag node tree and cached per tag (depth, prefixes, direct children).
+	// Entries rebuild on their own after the tag tree is rebuilt (editor tag edits).
 	// Returns ONLY the direct children of ParentTag (one level deeper), not grandchildren.
 	// Example: Parent=Unlocks.Ships -> [Unlocks.Ships.Ship1, Unlocks.Ships.Ship2, ...]
 	UFUNCTION(BlueprintCallable, Category = "AlienRamen|Tags")
@@ -70,8 +72,4 @@ public:
 	//   Removes Unlocks.Ships.Ship1.* (except Unlocks.Ships.Ship1), then adds Laser
 	UFUNCTION(BlueprintCallable, Category = "AlienRamen|Tags")
 	static bool ReplaceTagInSlot(UPARAM(ref) FGameplayTagContainer& InOutContainer, FGameplayTag NewTag);
-
-private:
-	static bool SplitTagToParts(FGameplayTag Tag, TArray<FString>& OutParts);
-	static bool TryMakeTagFromParts(const TArray<FString>& Parts, int32 NumParts, FGameplayTag& OutTag);
 };
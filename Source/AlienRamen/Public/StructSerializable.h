@@ -9,6 +9,53 @@
 #include "StructUtils/InstancedStruct.h"
 #include "StructSerializable.generated.h"
 
+/**
+ * Native typed copy between an IStructSerializable class and one of its state structs.
+ *
+ * Extract must write every field of the state struct: the destination buffer may be reused between calls.
+ */
+struct ALIENRAMEN_API FARStructStateAccessor
+{
+	using FExtractFn = void (*)(const UObject& Source, void* OutStateMemory);
+	using FApplyFn = void (*)(UObject& Target, const void* StateMemory);
+
+	FExtractFn Extract = nullptr;
+	FApplyFn Apply = nullptr;
+};
+
+/**
+ * Registry of typed state accessors keyed by (owner class, state struct).
+ *
+ * Classes register once (typically from their CDO constructor). Lookup walks the class hierarchy, so a native
+ * registration also covers Blueprint subclasses. Pairs without an accessor use name-based reflection.
+ */
+class ALIENRAMEN_API FARStructStateAccessorRegistry
+{
+public:
+	static void Register(const UClass* OwnerClass, const UScriptStruct* StateStruct, const FARStructStateAccessor& Accessor);
+
+	/** Registers TOwner::ExtractTypedState(TState&) const / ApplyTypedState(const TState&) for the pair. */
+	template <typename TOwner, typename TState>
+	static void Register()
+	{
+		FARStructStateAccessor Accessor;
+		Accessor.Extract = [](const UObject& Source, void* OutStateMemory)
+		{
+			static_cast<const TOwner&>(Source).ExtractTypedState(*static_cast<TState*>(OutStateMemory));
+		};
+		Accessor.Apply = [](UObject& Target, const void* StateMemory)
+		{
+			static_cast<TOwner&>(Target).ApplyTypedState(*static_cast<const TState*>(StateMemory));
+		};
+		Register(TOwner::StaticClass(), TState::StaticStruct(), Accessor);
+	}
+
+	static const FARStructStateAccessor* Find(const UClass* ObjectClass, const UScriptStruct* StateStruct);
+
+	/** Cached lookup of the 'ClassStateStruct' object property used by the default GetStateStruct. */
+	static const FObjectProperty* FindClassStateStructProperty(const UClass* ObjectClass);
+};
+
 UINTERFACE(BlueprintType)
 class ALIENRAMEN_API UStructSerializable : public UInterface
 {
@@ -0,0 +1,97 @@
+#include "ARBakeContentPackCommandlet.h"
+
+#include "ARContentLookupSettings.h"
+#include "ARContentPack.h"
+#include "ARLog.h"
+#include "ContentLookupSubsystem.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UARBakeContentPackCommandlet::UARBakeContentPackCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UARBakeContentPackCommandlet::Main(const FString& Params)
+{
+	const UARContentLookupSettings* Settings = GetDefault<UARContentLookupSettings>();
+	if (!Settings)
+	{
+		UE_LOG(ARLog, Error, TEXT("[ContentPack] Missing content lookup settings."));
+		return 1;
+	}
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectContentDir(), Settings->ContentPackPath);
+	}
+	const bool bVerifyOnly = FParse::Param(*Params, TEXT("VerifyOnly"));
+	return BakeAndVerify(OutputPath, bVerifyOnly) ? 0 : 1;
+}
+
+bool UARBakeContentPackCommandlet::BakeAndVerify(const FString& OutputPath, const bool bVerifyOnly)
+{
+	const UARContentLookupSettings* Settings = GetDefault<UARContentLookupSettings>();
+	if (!Settings)
+	{
+		UE_LOG(ARLog, Error, TEXT("[ContentPack] Missing content lookup settings."));
+		return false;
+	}
+
+	UContentLookupRegistry* Registry = Settings->RegistryAsset.LoadSynchronous();
+	if (!Registry)
+	{
+		UE_LOG(ARLog, Error, TEXT("[ContentPack] Could not load registry '%s'."), *Settings->RegistryAsset.ToSoftObjectPath().ToString());
+		return false;
+	}
+
+	TArray<FARContentPackSourceRoute> SourceRoutes;
+	FARContentPack::GatherSourceRoutes(Registry, Settings->ContentPackExcludedRootTags, SourceRoutes);
+
+	if (!bVerifyOnly)
+	{
+		TArray<uint8> Bytes;
+		FString BuildError;
+		if (!FARContentPack::Build(SourceRoutes, Bytes, BuildError))
+		{
+			UE_LOG(ARLog, Error, TEXT("[ContentPack] Bake failed: %s"), *BuildError);
+			return false;
+		}
+
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), /*Tree*/ true);
+		if (!FFileHelper::SaveArrayToFile(Bytes, *OutputPath))
+		{
+			UE_LOG(ARLog, Error, TEXT("[ContentPack] Could not write '%s'."), *OutputPath);
+			return false;
+		}
+		UE_LOG(ARLog, Display, TEXT("[ContentPack] Baked %d routes into '%s' (%d bytes)."), SourceRoutes.Num(), *OutputPath, Bytes.Num());
+	}
+
+	// Always verify what is on disk, so a bake and a CI check exercise the same load path as the game.
+	FARContentPack Pack;
+	FString LoadError;
+	if (!Pack.LoadFromFile(OutputPath, LoadError))
+	{
+		UE_LOG(ARLog, Error, TEXT("[ContentPack] Could not load '%s' for verification: %s"), *OutputPath, *LoadError);
+		return false;
+	}
+
+	TArray<FString> Mismatches;
+	if (!Pack.Verify(SourceRoutes, Mismatches))
+	{
+		for (const FString& Mismatch : Mismatches)
+		{
+			UE_LOG(ARLog, Error, TEXT("[ContentPack] %s"), *Mismatch);
+		}
+		UE_LOG(ARLog, Error, TEXT("[ContentPack] Verification failed with %d mismatches; rebake the pack."), Mismatches.Num());
+		return false;
+	}
+
+	UE_LOG(ARLog, Display, TEXT("[ContentPack] Verified '%s' against %d source tables."), *OutputPath, SourceRoutes.Num());
+	return true;
+}
@@ -6,9 +6,12 @@
 #include "ARSaveIndexGame.h"
 #include "ARSaveTypes.h"
 #include "ARLoadoutSettings.h"
+#include "ARBakeContentPackCommandlet.h"
+#include "ARContentLookupSettings.h"
 
 #include "IDetailsView.h"
 #include "Editor.h"
+#include "GameDelegates.h"
 #include "LevelEditor.h"
 #include "Modules/ModuleManager.h"
 #include "PropertyEditorModule.h"
@@ -18,6 +21,7 @@
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/Paths.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
@@ -798,7 +802,7 @@ namespace ARDebugSaveEditor
 				return FReply::Handled();
 			}
 
-			for (FARPlayerStateSaveData& PlayerData : CurrentSaveObject->PlayerStates)
+			for (FARPlayerStateSaveData& PlayerData : CurrentSaveObject->GetMutablePlayerStates())
 			{
 				PlayerData.LoadoutTags = DefaultLoadout;
 			}
@@ -808,7 +812,7 @@ namespace ARDebugSaveEditor
 				SaveDetailsView->ForceRefresh();
 			}
 
-			SetStatus(FString::Printf(TEXT("Applied default loadout to %d player state entries. Press Save Current to persist."), CurrentSaveObject->PlayerStates.Num()));
+			SetStatus(FString::Printf(TEXT("Applied default loadout to %d player state entries. Press Save Current to persist."), CurrentSaveObject->GetPlayerStates().Num()));
 			return FReply::Handled();
 		}
 
@@ -862,6 +866,8 @@ namespace ARDebugSaveEditor
 				return;
 			}
 			CurrentSaveObject->SetFlags(RF_Transactional);
+			// Details view reads section arrays by reflection, so materialize any still-stored sections first.
+			CurrentSaveObject->HydrateAllSections();
 
 			TArray<UObject*> Objects;
 			Objects.Add(CurrentSaveObject.Get());
@@ -1546,10 +1552,19 @@ public:
 			.SetMenuType(ETabSpawnerMenuType::Hidden);
 
 		UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FAlienRamenEditorModule::RegisterMenus));
+
+		// Packaged builds trust the pack's rows, so every cook rebakes it from the current tables before staging.
+		FGameDelegates::Get().GetCookModificationDelegate().BindRaw(this, &FAlienRamenEditorModule::HandleCookStarted);
 	}
 
 	virtual void ShutdownModule() override
 	{
+		FCookModificationDelegate& CookDelegate = FGameDelegates::Get().GetCookModificationDelegate();
+		if (CookDelegate.IsBoundToObject(this))
+		{
+			CookDelegate.Unbind();
+		}
+
 		if (UToolMenus::TryGet())
 		{
 			UToolMenus::UnRegisterStartupCallback(this);
@@ -1560,6 +1575,23 @@ public:
 	}
 
 private:
+	void HandleCookStarted(TArray<FString>& ExtraPackagesToCook)
+	{
+		(void)ExtraPackagesToCook;
+
+		const UARContentLookupSettings* Settings = GetDefault<UARContentLookupSettings>();
+		if (!Settings || !Settings->bUseContentPack)
+		{
+			return;
+		}
+
+		const FString OutputPath = FPaths::Combine(FPaths::ProjectContentDir(), Settings->ContentPackPath);
+		if (!UARBakeContentPackCommandlet::BakeAndVerify(OutputPath, /*bVerifyOnly*/ false))
+		{
+			UE_LOG(ARLog, Error, TEXT("[ContentPack] Cook could not produce a content pack matching the DataTables; packaged builds would serve stale rows."));
+		}
+	}
+
 	TSharedRef<SDockTab> SpawnDebugSaveTab(const FSpawnTabArgs&)
 	{
 		return SNew(SDockTab)
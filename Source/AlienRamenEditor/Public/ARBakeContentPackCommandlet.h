@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ARBakeContentPackCommandlet.generated.h"
+
+/**
+ * Bakes registry-routed DataTables into the runtime content pack and verifies it against the source tables.
+ *
+ *   UnrealEditor-Cmd AlienRamen.uproject -run=ARBakeContentPack [-Output=<path>] [-VerifyOnly]
+ *
+ * Output defaults to <ProjectContentDir>/<UARContentLookupSettings::ContentPackPath>.
+ * Returns 0 on success, 1 when baking fails or the pack does not match the tables.
+ * The editor module also rebakes the pack at the start of every cook, so a staged pack always matches its tables.
+ */
+UCLASS()
+class ALIENRAMENEDITOR_API UARBakeContentPackCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UARBakeContentPackCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	// Bakes the registry's routes to OutputPath (unless bVerifyOnly) and verifies the file against the source tables.
+	static bool BakeAndVerify(const FString& OutputPath, bool bVerifyOnly);
+};